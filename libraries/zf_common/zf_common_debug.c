@@ -30,8 +30,9 @@
 ********************************************************************************************************************/
 
 // zf_common 层引用
-#include "zf_common_fifo.h"
+#include "zf_common_ring.h"
 #include "zf_common_memory.h"
+#include "zf_common_watermark.h"
 
 // 自身头文件
 #include "zf_common_debug.h"
@@ -54,15 +55,7 @@ AT_ZF_LIB_SECTION static debug_obj_struct    debug_output_obj =
 
 #if DEBUG_UART_USE_INTERRUPT                                                    // 如果启用 debug uart 接收中断
 AT_ZF_LIB_SECTION static uint8               debug_uart_buffer[DEBUG_RING_BUFFER_LEN] = {0};
-AT_ZF_LIB_SECTION static zf_fifo_obj_struct  debug_uart_fifo =
-{
-    .base_ptr       = 0,
-    .tail_ptr       = 0,
-    .write_ptr      = 0,
-    .read_ptr       = 0,
-    .step           = FIFO_DATA_8BIT,
-    .state          = 0
-};
+AT_ZF_LIB_SECTION static zf_ring_obj_struct  debug_uart_ring;
 #endif
 AT_ZF_LIB_SECTION_END
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -136,7 +129,7 @@ ZF_WEAK void debug_interrupt_protective_handler (void)
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     debug 串口中断处理函数 isr.c 中对应串口中断服务函数调用
 // 参数说明     event               中断事件
-// 参数说明     *ptr                默认传入是一个 fifo 对象
+// 参数说明     *ptr                默认传入是一个 zf_ring 对象
 // 返回参数     void
 // 使用示例     debug_interrupr_handler();
 // 备注信息     本函数需要开启 DEBUG_UART_USE_INTERRUPT 宏定义才可使用
@@ -452,8 +445,7 @@ uint8 debug_message_handler (uint8 output_level, uint8 pass, char *str, char *fi
 uint32 debug_read_ring_buffer (uint8 *data, uint32 data_len)
 {
 #if DEBUG_UART_USE_INTERRUPT                                                    // 条件编译 只有在启用串口中断才编译
-    zf_fifo_read_buffer(&debug_uart_fifo, data, &data_len, FIFO_READ_WITH_CLEAN);
-    return data_len;
+    return zf_ring_read(&debug_uart_ring, data, data_len);
 #else
     return 0;
 #endif
@@ -508,8 +500,9 @@ void debug_init (void)
     debug_output_obj.output_uart    = debug_uart_str_output_handler;
 
 #if DEBUG_UART_USE_INTERRUPT                                                    // 条件编译 只有在启用串口中断才编译
-    zf_fifo_init(&debug_uart_fifo, FIFO_DATA_8BIT, debug_uart_buffer, DEBUG_RING_BUFFER_LEN);
-    debug_uart_init_handler(&debug_output_obj, debug_uart_interrupr_handler, &debug_uart_fifo);
+    zf_ring_init(&debug_uart_ring, debug_uart_buffer, DEBUG_RING_BUFFER_LEN);
+    zf_watermark_register_ring("debug", &debug_uart_ring);
+    debug_uart_init_handler(&debug_output_obj, debug_uart_interrupr_handler, &debug_uart_ring);
 #else
     debug_uart_init_handler(&debug_output_obj, debug_uart_interrupr_handler, NULL);
 #endif
@@ -61,7 +61,7 @@
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 #define DEBUG_UART_USE_INTERRUPT        ( 1 )                                   // 是否启用 debug uart 接收中断
 #if DEBUG_UART_USE_INTERRUPT                                                    // 如果启用 debug uart 接收中断
-#define DEBUG_RING_BUFFER_LEN           ( 64 )                                  // 定义环形缓冲区大小 默认 64byte
+#define DEBUG_RING_BUFFER_LEN           ( 64 )                                  // 定义环形缓冲区大小 默认 64byte 必须为 2 的幂
 #endif  
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
@@ -136,7 +136,7 @@ void debug_interrupt_protective_handler (void);
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     debug 串口中断处理函数 isr.c 中对应串口中断服务函数调用
 // 参数说明     event               中断事件
-// 参数说明     *ptr                默认传入是一个 fifo 对象
+// 参数说明     *ptr                默认传入是一个 zf_ring 对象
 // 返回参数     void
 // 使用示例     debug_uart_interrupr_handler();
 // 备注信息     本函数需要开启 DEBUG_UART_USE_INTERRUPT 宏定义才可使用
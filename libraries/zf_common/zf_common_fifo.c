@@ -34,6 +34,26 @@
 
 // 此处定义 本文件的所有函数具体定义 这里不允许用户修改
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     FIFO 写入后更新历史最大数据量
+// 参数说明     *fifo               FIFO 对象指针
+// 参数说明     write_ptr           写入后的写指针
+// 参数说明     read_ptr            写入前获取的读指针快照
+// 返回参数     void
+// 使用示例     zf_fifo_update_peak(fifo, start_ptr, end_ptr);
+// 备注信息     在写锁定期间调用 读指针快照只可能比实际更靠前 得到的数据量不会偏小
+//-------------------------------------------------------------------------------------------------------------------
+ZF_INLINE void zf_fifo_update_peak (zf_fifo_obj_struct *fifo, uint32 write_ptr, uint32 read_ptr)
+{
+    uint32 buffer_lenght    = fifo->tail_ptr - fifo->base_ptr;
+    uint32 used_lenght      = (write_ptr == read_ptr) ? (buffer_lenght) : ((write_ptr + buffer_lenght - read_ptr) % buffer_lenght);
+
+    if(used_lenght > fifo->peak_used)
+    {
+        fifo->peak_used     = used_lenght;
+    }
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     FIFO 重置缓冲器 清空当前 FIFO 对象的内存
 // 参数说明     *fifo               FIFO 对象指针
@@ -152,6 +172,7 @@ uint8 zf_fifo_write_element (zf_fifo_obj_struct *fifo, uint32 dat)
         if(fifo->full_state)                                                    // 判断是否写满了
         {
             return_state        = FIFO_WRITE_ERROR_NO_SPACE;                    // 写满就报空间不足
+            fifo->overflow_count ++;                                            // 记录溢出次数
             fifo->write_state   = ZF_FALSE;                                     // 解除写锁定
             break;                                                              // 退出操作
         }
@@ -167,6 +188,7 @@ uint8 zf_fifo_write_element (zf_fifo_obj_struct *fifo, uint32 dat)
         }
         fifo->full_state        = (start_ptr == end_ptr);                       // 判断是否写满了 写入后写指针读指针重合就肯定是写满了
         fifo->write_ptr         = start_ptr;                                    // 写指针位移生效
+        zf_fifo_update_peak(fifo, start_ptr, end_ptr);                          // 更新历史最大数据量
 
         fifo->write_state       = ZF_FALSE;                                     // 解除写锁定
 
@@ -229,6 +251,7 @@ uint8 zf_fifo_write_buffer (zf_fifo_obj_struct *fifo, void *dat, uint32 *length)
         if(fifo->full_state)                                                    // 判断是否写满了
         {
             return_state        = FIFO_WRITE_ERROR_NO_SPACE;                    // 写满就报空间不足
+            fifo->overflow_count ++;                                            // 记录溢出次数
             fifo->write_state   = ZF_FALSE;                                     // 解除写锁定
             break;                                                              // 退出操作
         }
@@ -281,6 +304,12 @@ uint8 zf_fifo_write_buffer (zf_fifo_obj_struct *fifo, void *dat, uint32 *length)
         }
         fifo->full_state        = (start_ptr == end_ptr);                       // 判断是否写满了 写入后写指针读指针重合就肯定是写满了
         fifo->write_ptr         = start_ptr;                                    // 写指针位移生效
+        zf_fifo_update_peak(fifo, start_ptr, end_ptr);                          // 更新历史最大数据量
+
+        if(FIFO_WRITE_ERROR_PARTIAL_DONE == return_state)
+        {
+            fifo->overflow_count ++;                                            // 记录溢出次数
+        }
 
         fifo->write_state       = ZF_FALSE;                                     // 解除写锁定
         *length                 = length_temp;
@@ -727,6 +756,9 @@ uint8 zf_fifo_init (zf_fifo_obj_struct *fifo, zf_fifo_data_type_enum type, void
 
         fifo->step          = type;                                             // 数据类型 地址步进值
 
+        fifo->peak_used     = 0;                                                // 历史最大数据量
+        fifo->overflow_count= 0;                                                // 溢出次数
+
         fifo->state         = FIFO_STATE_MASK_INIT_DONE;                        // 完成配置后将状态标记为完成初始化
 
         return_state        = FIFO_OPERATION_NO_ERROR;
@@ -108,6 +108,9 @@ typedef struct
             uint8                       : 2 ;
         };
     };
+
+    uint32                  peak_used       ;                                   // 历史最大数据量 与 zf_fifo_used 单位一致
+    uint32                  overflow_count  ;                                   // 空间不足导致写入失败或部分写入的次数
 }zf_fifo_obj_struct;
 
 // 以下是 FIFO 的操作掩码等
@@ -48,6 +48,11 @@
 #include "zf_common_fifo.h"
 #include "zf_common_function.h"
 #include "zf_common_memory.h"
+#include "zf_common_pool.h"
+#include "zf_common_profile.h"
+#include "zf_common_ring.h"
+#include "zf_common_trace.h"
+#include "zf_common_watermark.h"
 //==================================================== 开源库公共层 ====================================================
 
 #endif
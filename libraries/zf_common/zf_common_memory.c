@@ -56,6 +56,8 @@ AT_ZF_LIB_SECTION_START
 // 存储于预开辟的内存池中的管理信息 本部分对于用户来说是不开放的
 AT_ZF_LIB_SECTION static memory_management_info_struct      zf_memory_management        = {0, 0, 0, 0, NULL};
 AT_ZF_LIB_SECTION static zf_memory_management_state_struct  zf_memory_management_state  = {0};
+AT_ZF_LIB_SECTION static uint32                             zf_memory_peak_used         = 0;
+AT_ZF_LIB_SECTION static uint32                             zf_memory_fail_count        = 0;
 #if   (!MEMORY_MANAGEMENT_MODE)
 uint32 memory_management_buffer[ZF_HEAP_SIZE / 4];
 #endif
@@ -209,9 +211,20 @@ ZF_WEAK void *zf_memory_malloc (memory_align_type_enum type, uint32 size)
                 break;
             }
         }
+
+        // 记录历史最大占用 用于评估内存池大小
+        if(ZF_HEAP_SIZE - zf_memory_management.size > zf_memory_peak_used)
+        {
+            zf_memory_peak_used = ZF_HEAP_SIZE - zf_memory_management.size;
+        }
     }while(0);
     zf_memory_management_state.malloc = ZF_FALSE;                               // 申请操作占用解除
 
+    if(NULL == ptr)
+    {
+        zf_memory_fail_count ++;                                                // 记录申请失败 包括互斥冲突与空间不足
+    }
+
     return ptr;
 }
 
@@ -283,6 +296,65 @@ ZF_WEAK uint8 zf_memory_free (void *ptr)
     return return_state;
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取内存池使用情况
+// 参数说明     *info               使用情况输出
+// 返回参数     uint8               ZF_NO_ERROR-成功 / ZF_ERROR-正在申请或释放 本次未获取
+// 使用示例     memory_usage_info_struct info; zf_memory_get_info(&info);
+// 备注信息     空闲总量减去最大连续空间即碎片 不要在中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_memory_get_info (memory_usage_info_struct *info)
+{
+    uint8 return_state = ZF_ERROR;
+
+    do
+    {
+        if(zf_memory_assert(NULL != info))
+        {
+            break;
+        }
+        if(zf_memory_management_state.state)                                    // 简易互斥判断
+        {
+            break;
+        }
+        zf_memory_management_state.malloc = ZF_TRUE;                            // 借用申请操作占用 避免遍历期间区块变化
+
+        memory_block_info_struct    *block_top      = zf_memory_management.block_list;
+        memory_block_info_struct    *block_bottom   = zf_memory_management.block_list;
+        uint32                      gap_size        = 0;
+        uint32                      largest_free    = 0;
+
+        // 区块信息按地址从低到高自信息栈顶向下排列 与申请时的碎片查询方式一致
+        for(uint32 memory_loop = 2; zf_memory_management.block_count >= memory_loop; memory_loop ++)
+        {
+            block_top       = zf_memory_management.block_list - (memory_loop - 2);
+            block_bottom    = zf_memory_management.block_list - (memory_loop - 1);
+            gap_size        = block_bottom->start_addr - block_top->limit_addr;
+            largest_free    = (gap_size > largest_free) ? (gap_size) : (largest_free);
+        }
+
+        // 最后一个区块到信息栈底之间 还要留出新增区块信息的位置
+        block_bottom        = zf_memory_management.block_list - zf_memory_management.block_count;
+        block_top           = block_bottom == zf_memory_management.block_list ? block_bottom : block_bottom + 1;
+        gap_size            =   zf_memory_management.limit_addr
+                            -   (zf_memory_management.block_count + 1) * sizeof(memory_block_info_struct);
+        gap_size            = (gap_size > block_top->limit_addr) ? (gap_size - block_top->limit_addr) : (0);
+        largest_free        = (gap_size > largest_free) ? (gap_size) : (largest_free);
+
+        info->total_size        = ZF_HEAP_SIZE;
+        info->used_size         = ZF_HEAP_SIZE - zf_memory_management.size;
+        info->peak_used_size    = zf_memory_peak_used;
+        info->largest_free      = largest_free;
+        info->block_count       = zf_memory_management.block_count;
+        info->fail_count        = zf_memory_fail_count;
+
+        zf_memory_management_state.malloc = ZF_FALSE;                           // 申请操作占用解除
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     内存管理初始化
 // 参数说明     void
@@ -301,6 +373,8 @@ ZF_WEAK void zf_memory_init (void)
         zf_memory_management.block_count            = 0;
 
         zf_memory_management_state.state            = 0;
+        zf_memory_peak_used                         = 0;
+        zf_memory_fail_count                        = 0;
 
         memset((void *)ZF_HEAP_START_ADDR, 0, zf_memory_management.size);
         zf_memory_management.block_list             = (memory_block_info_struct *)(ZF_HEAP_LIMIT_ADDR - sizeof(memory_block_info_struct));
@@ -40,6 +40,7 @@
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 // zf_memory_malloc                                                             // 从堆中申请对应大小内存
 // zf_memory_free                                                               // 释放指针对应堆内存
+// zf_memory_get_info                                                           // 获取内存池使用情况
 // zf_memory_init                                                               // 内存管理初始化
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
@@ -66,6 +67,16 @@ typedef struct
     vuint32                     block_count ;                                   // 当前内存池已有区块数量
     memory_block_info_struct    *block_list ;                                   // 区块信息列表顶部地址
 }memory_management_info_struct;                                                 // 动态内存池信息结构体
+
+typedef struct                                                                  // 此结构定义不允许用户修改
+{
+    uint32                      total_size      ;                               // 内存池总大小
+    uint32                      used_size       ;                               // 当前已用大小 包含区块信息占用
+    uint32                      peak_used_size  ;                               // 历史最大已用大小
+    uint32                      largest_free    ;                               // 单次可申请的最大连续空间 (按 1 字节对齐估算)
+    uint32                      block_count     ;                               // 当前区块数量
+    uint32                      fail_count      ;                               // 申请失败次数
+}memory_usage_info_struct;                                                      // 内存池使用情况 用于评估 ZF_HEAP_SIZE 是否合适
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 // 此处定义 系统内存的地址等 如果移植到新的 MCU 上需要自行匹配对应的地址等
@@ -190,6 +201,15 @@ void *zf_memory_malloc (memory_align_type_enum type, uint32 size);
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_memory_free (void *ptr);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取内存池使用情况
+// 参数说明     *info               使用情况输出
+// 返回参数     uint8               ZF_NO_ERROR-成功 / ZF_ERROR-正在申请或释放 本次未获取
+// 使用示例     memory_usage_info_struct info; zf_memory_get_info(&info);
+// 备注信息     空闲总量减去最大连续空间即碎片 不要在中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_memory_get_info (memory_usage_info_struct *info);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     内存管理初始化
 // 参数说明     void
@@ -0,0 +1,261 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_pool
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+// zf_common 层引用
+#include "zf_common_debug.h"
+
+// zf_driver 层引用
+#include "zf_driver_interrupt.h"
+
+// 自身头文件
+#include "zf_common_pool.h"
+
+// 此处定义 本文件用使用的变量与对象等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+typedef struct                                                                  // 单个级别的管理信息
+{
+    uint32                  block_size      ;
+    uint32                  block_count     ;
+    uint32                  start_addr      ;                                   // 本级别第一个块的地址
+    uint32                  limit_addr      ;                                   // 本级别最后一个块之后的地址
+    void                   *free_list       ;                                   // 空闲块链表头 块首 4 字节存放下一个空闲块地址
+    uint32                  used_count      ;
+    uint32                  peak_used_count ;
+    uint32                  alloc_count     ;
+    uint32                  fallback_count  ;
+    uint32                  fail_count      ;
+}zf_pool_class_struct;
+
+static const uint32         pool_block_size_list[ZF_POOL_CLASS_NUM]     = ZF_POOL_BLOCK_SIZE_LIST;
+static const uint32         pool_block_count_list[ZF_POOL_CLASS_NUM]    = ZF_POOL_BLOCK_COUNT_LIST;
+
+static uint64               pool_storage[ZF_POOL_STORAGE_SIZE / 8];             // 以 uint64 定义保证 8 字节对齐
+_Static_assert(0 == ZF_POOL_STORAGE_SIZE % 8, "zf_pool block sizes must be multiples of 8");
+static zf_pool_class_struct pool_class_list[ZF_POOL_CLASS_NUM];
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件的所有函数具体定义 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     从内存池申请一块内存
+// 参数说明     size                需要的字节数
+// 返回参数     void *              内存地址 8 字节对齐 / NULL - 没有空闲块或者 size 超过最大块
+// 使用示例     frame = zf_pool_malloc(sizeof(telemetry_frame_struct));
+// 备注信息     常数时间 可在中断中调用 得到的块大小为能放下 size 的最小级别
+//-------------------------------------------------------------------------------------------------------------------
+void *zf_pool_malloc (uint32 size)
+{
+    void                   *ptr         = NULL;
+    zf_pool_class_struct   *pool_class  = NULL;
+    uint32                  index       = 0;
+    uint32                  first_index = 0;
+    uint32                  primask     = 0;
+
+    do
+    {
+        if(0 == size)
+        {
+            break;
+        }
+
+        // 级别数量固定 查找最多 ZF_POOL_CLASS_NUM 次
+        for(first_index = 0; ZF_POOL_CLASS_NUM > first_index; first_index ++)
+        {
+            if(pool_class_list[first_index].block_size >= size)
+            {
+                break;
+            }
+        }
+        primask = zf_interrupt_global_disable();
+        if(ZF_POOL_CLASS_NUM <= first_index)                                    // 超过最大块 计入最大级别的失败次数
+        {
+            pool_class_list[ZF_POOL_CLASS_NUM - 1].fail_count ++;
+            zf_interrupt_global_enable(primask);
+            break;
+        }
+        for(index = first_index; ZF_POOL_CLASS_NUM > index; index ++)
+        {
+            pool_class = &pool_class_list[index];
+            if(NULL != pool_class->free_list)
+            {
+                ptr                     = pool_class->free_list;
+                pool_class->free_list   = *(void **)ptr;
+                pool_class->used_count  ++;
+                pool_class->alloc_count ++;
+                if(pool_class->used_count > pool_class->peak_used_count)
+                {
+                    pool_class->peak_used_count = pool_class->used_count;
+                }
+                break;
+            }
+        }
+        if(NULL == ptr)
+        {
+            pool_class_list[first_index].fail_count ++;
+        }
+        else if(index != first_index)
+        {
+            pool_class_list[first_index].fallback_count ++;
+        }
+        zf_interrupt_global_enable(primask);
+    }while(0);
+
+    return ptr;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     释放内存池中的一块内存
+// 参数说明     *ptr                zf_pool_malloc 返回的地址
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 地址不属于内存池或不是块起始地址
+// 使用示例     zf_pool_free(frame);
+// 备注信息     常数时间 可在中断中调用 ptr 为 NULL 时直接返回成功
+//              不检查重复释放 同一块释放两次会破坏空闲链表
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pool_free (void *ptr)
+{
+    uint8                   return_state    = ZF_ERROR;
+    zf_pool_class_struct   *pool_class      = NULL;
+    uint32                  addr            = (uint32)ptr;
+    uint32                  primask         = 0;
+
+    do
+    {
+        if(NULL == ptr)
+        {
+            return_state = ZF_NO_ERROR;
+            break;
+        }
+
+        for(uint32 index = 0; ZF_POOL_CLASS_NUM > index; index ++)
+        {
+            if(pool_class_list[index].start_addr <= addr && pool_class_list[index].limit_addr > addr)
+            {
+                pool_class = &pool_class_list[index];
+                break;
+            }
+        }
+        // 不属于内存池 或者不是块的起始地址 说明调用方传错了指针
+        if(zf_assert(NULL != pool_class && 0 == (addr - pool_class->start_addr) % pool_class->block_size))
+        {
+            break;
+        }
+
+        primask = zf_interrupt_global_disable();
+        *(void **)ptr           = pool_class->free_list;
+        pool_class->free_list   = ptr;
+        pool_class->used_count  --;
+        zf_interrupt_global_enable(primask);
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取指定级别的使用情况
+// 参数说明     index               级别编号 范围 0 - (ZF_POOL_CLASS_NUM - 1)
+// 参数说明     *info               使用情况输出
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_pool_get_info(0, &info);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pool_get_info (uint32 index, zf_pool_info_struct *info)
+{
+    uint8 return_state = ZF_ERROR;
+
+    do
+    {
+        if(ZF_POOL_CLASS_NUM <= index || NULL == info)
+        {
+            break;
+        }
+
+        const zf_pool_class_struct *pool_class = &pool_class_list[index];
+        uint32 primask = zf_interrupt_global_disable();                         // 保证各项统计来自同一时刻
+        info->block_size        = pool_class->block_size;
+        info->block_count       = pool_class->block_count;
+        info->used_count        = pool_class->used_count;
+        info->peak_used_count   = pool_class->peak_used_count;
+        info->alloc_count       = pool_class->alloc_count;
+        info->fallback_count    = pool_class->fallback_count;
+        info->fail_count        = pool_class->fail_count;
+        zf_interrupt_global_enable(primask);
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     内存池初始化
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_pool_init();
+// 备注信息     由 zf_system_clock_init 调用 重新初始化会丢弃全部已分配的块
+//-------------------------------------------------------------------------------------------------------------------
+void zf_pool_init (void)
+{
+    uint32 addr         = (uint32)pool_storage;
+    uint32 limit_addr   = (uint32)pool_storage + sizeof(pool_storage);
+
+    for(uint32 index = 0; ZF_POOL_CLASS_NUM > index; index ++)
+    {
+        zf_pool_class_struct *pool_class = &pool_class_list[index];
+
+        memset(pool_class, 0, sizeof(zf_pool_class_struct));
+        pool_class->block_size  = pool_block_size_list[index];
+        pool_class->block_count = pool_block_count_list[index];
+
+        // 块大小需为 8 的倍数且升序 各级别总和不能超过 ZF_POOL_STORAGE_SIZE
+        zf_assert(0 == pool_class->block_size % 8);
+        zf_assert(0 == index || pool_class->block_size > pool_block_size_list[index - 1]);
+        if(zf_assert(limit_addr - addr >= pool_class->block_size * pool_class->block_count))
+        {
+            pool_class->block_count = (limit_addr - addr) / pool_class->block_size;
+        }
+
+        pool_class->start_addr  = addr;
+        pool_class->limit_addr  = addr + pool_class->block_size * pool_class->block_count;
+
+        // 从后向前串成链表 申请时从低地址开始分配
+        for(uint32 block_addr = pool_class->limit_addr; block_addr > pool_class->start_addr; )
+        {
+            block_addr              -= pool_class->block_size;
+            *(void **)block_addr    = pool_class->free_list;
+            pool_class->free_list   = (void *)block_addr;
+        }
+
+        addr = pool_class->limit_addr;
+    }
+}
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -0,0 +1,140 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_pool
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+/*********************************************************************************************************************
+* 固定块内存池说明：
+*                   按块大小分为若干个大小级别 每个级别是一段连续的等长块 空闲块通过块首 4 字节串成单向链表
+*                   申请时选择能放下的最小级别 从链表头取一块 释放时按地址范围找到级别 放回链表头
+*                   申请与释放都是常数时间 与已分配的块数无关 链表操作期间短暂关中断 可在中断中调用
+*                   ------------------------------------
+*                   最小级别已用完时依次尝试更大的级别 借用次数计入 fallback_count
+*                   所有级别都没有空闲块时返回 NULL 并计入最小可用级别的 fail_count
+*                   与 zf_memory_malloc 相互独立 zf_memory_malloc 适合初始化阶段申请不释放的大块内存
+*                   本内存池适合运行期间反复申请释放的遥测帧 路径分段等固定上限的缓冲区
+********************************************************************************************************************/
+
+#ifndef _zf_common_pool_h_
+#define _zf_common_pool_h_
+
+// zf_common 层引用
+#include "zf_common_typedef.h"
+
+// 此处列举 当前支持的函数列表
+// 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// zf_pool_malloc                                                               // 从内存池申请一块内存
+// zf_pool_free                                                                 // 释放内存池中的一块内存
+
+// zf_pool_get_info                                                             // 获取指定级别的使用情况
+
+// zf_pool_init                                                                 // 内存池初始化
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 内存池的级别划分 用户可以根据自己的需要进行修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// 每个 ZF_POOL_CLASS(块大小, 块数量) 为一个级别 块大小单位为字节 必须升序且为 8 的倍数
+// 级别数量 各级别列表与总字节数均由此表推出 不需要再同步修改其他宏
+#define ZF_POOL_CLASS_TABLE(ZF_POOL_CLASS)                                          \
+    ZF_POOL_CLASS( 32 , 16 )                                                        \
+    ZF_POOL_CLASS( 64 , 16 )                                                        \
+    ZF_POOL_CLASS( 128, 8  )                                                        \
+    ZF_POOL_CLASS( 256, 4  )
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处由级别表推出 内存池的各项参数 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#define ZF_POOL_CLASS_ONE(size, count)              + 1
+#define ZF_POOL_CLASS_SIZE(size, count)             ( size ),
+#define ZF_POOL_CLASS_COUNT(size, count)            ( count ),
+#define ZF_POOL_CLASS_BYTES(size, count)            + ( size ) * ( count )
+
+#define ZF_POOL_CLASS_NUM               ( 0 ZF_POOL_CLASS_TABLE(ZF_POOL_CLASS_ONE) )        // 大小级别数量
+#define ZF_POOL_BLOCK_SIZE_LIST         { ZF_POOL_CLASS_TABLE(ZF_POOL_CLASS_SIZE) }         // 各级别块大小 字节
+#define ZF_POOL_BLOCK_COUNT_LIST        { ZF_POOL_CLASS_TABLE(ZF_POOL_CLASS_COUNT) }        // 各级别块数量
+#define ZF_POOL_STORAGE_SIZE            ( 0 ZF_POOL_CLASS_TABLE(ZF_POOL_CLASS_BYTES) )      // 总字节数
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件需要的枚举与对象结构等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+typedef struct                                                                  // 单个级别的使用情况
+{
+    uint32                  block_size                              ;           // 块大小 字节
+    uint32                  block_count                             ;           // 块总数
+    uint32                  used_count                              ;           // 当前已分配块数
+    uint32                  peak_used_count                         ;           // 历史最大已分配块数
+    uint32                  alloc_count                             ;           // 累计分配次数 包含借给更小请求的次数
+    uint32                  fallback_count                          ;           // 本级别用完后借用更大级别的次数
+    uint32                  fail_count                              ;           // 申请失败次数
+}zf_pool_info_struct;
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处列举 本文件的所有函数声明 [ 其中包括宏定义函数 ] 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     从内存池申请一块内存
+// 参数说明     size                需要的字节数
+// 返回参数     void *              内存地址 8 字节对齐 / NULL - 没有空闲块或者 size 超过最大块
+// 使用示例     frame = zf_pool_malloc(sizeof(telemetry_frame_struct));
+// 备注信息     常数时间 可在中断中调用 得到的块大小为能放下 size 的最小级别
+//-------------------------------------------------------------------------------------------------------------------
+void *zf_pool_malloc (uint32 size);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     释放内存池中的一块内存
+// 参数说明     *ptr                zf_pool_malloc 返回的地址
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 地址不属于内存池或不是块起始地址
+// 使用示例     zf_pool_free(frame);
+// 备注信息     常数时间 可在中断中调用 ptr 为 NULL 时直接返回成功
+//              不检查重复释放 同一块释放两次会破坏空闲链表
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pool_free (void *ptr);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取指定级别的使用情况
+// 参数说明     index               级别编号 范围 0 - (ZF_POOL_CLASS_NUM - 1)
+// 参数说明     *info               使用情况输出
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_pool_get_info(0, &info);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pool_get_info (uint32 index, zf_pool_info_struct *info);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     内存池初始化
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_pool_init();
+// 备注信息     由 zf_system_clock_init 调用 重新初始化会丢弃全部已分配的块
+//-------------------------------------------------------------------------------------------------------------------
+void zf_pool_init (void);
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#endif
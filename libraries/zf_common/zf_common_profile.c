@@ -0,0 +1,339 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_profile
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+// zf_common 层引用
+#include "zf_common_debug.h"
+
+// zf_driver 层引用
+#include "zf_driver_delay.h"
+#include "zf_driver_interrupt.h"
+#include "zf_driver_system.h"
+
+// 自身头文件
+#include "zf_common_profile.h"
+
+// 此处定义 本文件用使用的变量与对象等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// 用于固定值或指向的内容 主要是用少量存储占用来减少栈开销
+#if ZF_PROFILE_ENABLE
+// 中断编号表 仅 zf_profile_dump 读取优先级时使用
+static const zf_interrupt_index_enum profile_irq_index_list[PROFILE_NUM_MAX] =
+{
+    INTERRUPT_INDEX_TIM1_PIT ,  INTERRUPT_INDEX_TIM8_PIT ,
+    INTERRUPT_INDEX_TIM2_PIT ,  INTERRUPT_INDEX_TIM5_PIT ,
+    INTERRUPT_INDEX_TIM3_PIT ,  INTERRUPT_INDEX_TIM4_PIT ,
+    INTERRUPT_INDEX_TIM15_PIT,  INTERRUPT_INDEX_TIM16_PIT,
+    INTERRUPT_INDEX_TIM6_PIT ,  INTERRUPT_INDEX_TIM7_PIT ,
+
+    INTERRUPT_INDEX_UART1    ,  INTERRUPT_INDEX_UART2    ,  INTERRUPT_INDEX_UART3    ,
+
+    INTERRUPT_INDEX_EXTI0    ,  INTERRUPT_INDEX_EXTI1    ,  INTERRUPT_INDEX_EXTI2    ,
+    INTERRUPT_INDEX_EXTI3    ,  INTERRUPT_INDEX_EXTI4    ,  INTERRUPT_INDEX_EXTI9_5  ,
+    INTERRUPT_INDEX_EXTI15_10,
+
+    INTERRUPT_INDEX_ADC1     ,  INTERRUPT_INDEX_ADC2     ,  INTERRUPT_INDEX_ADC3     ,
+    INTERRUPT_INDEX_ADC4     ,  INTERRUPT_INDEX_ADC5     ,
+
+    INTERRUPT_INDEX_TIM_TS   ,
+
+    INTERRUPT_INDEX_DMA1_CH0 ,  INTERRUPT_INDEX_DMA1_CH2 ,  INTERRUPT_INDEX_DMA1_CH4 ,
+    INTERRUPT_INDEX_DMA1_CH6 ,
+};
+#endif
+
+static const char *profile_name_list[PROFILE_NUM_MAX] =
+{
+    "PIT_TIM1" ,    "PIT_TIM8" ,
+    "PIT_TIM2" ,    "PIT_TIM5" ,
+    "PIT_TIM3" ,    "PIT_TIM4" ,
+    "PIT_TIM15",    "PIT_TIM16",
+    "PIT_TIM6" ,    "PIT_TIM7" ,
+
+    "UART_1"   ,    "UART_2"   ,    "UART_3"   ,
+
+    "EXTI0"    ,    "EXTI1"    ,    "EXTI2"    ,
+    "EXTI3"    ,    "EXTI4"    ,    "EXTI9_5"  ,
+    "EXTI15_10",
+
+    "ADC_1"    ,    "ADC_2"    ,    "ADC_3"    ,
+    "ADC_4"    ,    "ADC_5"    ,
+
+    "TIM_TS"   ,
+
+    "SPI1_DMA" ,    "SPI2_DMA" ,    "SPI3_DMA" ,
+    "SPI4_DMA" ,
+};
+
+typedef struct                                                                  // 中断嵌套栈 每层记录进入时刻与被抢占的时间
+{
+    uint32                  start_cycles    ;
+    uint32                  child_cycles    ;
+}zf_profile_frame_struct;
+
+static zf_profile_info_struct   profile_info_list[PROFILE_NUM_MAX];
+static zf_profile_frame_struct  profile_frame_list[PROFILE_NEST_MAX];
+static uint32                   profile_depth = 0;
+static uint64                   profile_window_start_us = 0;                   // 统计窗口起点 用 64 位微秒时间戳 不受 CYCCNT 约 14s 回绕影响
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件的所有函数具体定义 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     中断耗时统计 进入中断服务函数
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_profile_enter(PROFILE_PIT_TIM7);
+// 备注信息     在中断服务函数开头调用 驱动内使用 zf_profile_enter 宏 统计关闭时不产生代码
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_irq_enter (zf_profile_index_enum index)
+{
+    (void)index;
+
+    // 嵌套栈操作期间屏蔽中断 避免更高优先级中断在读改写中间压栈
+    uint32 primask = __get_PRIMASK();
+    __disable_irq();
+    if(PROFILE_NEST_MAX > profile_depth)
+    {
+        profile_frame_list[profile_depth].child_cycles = 0;
+        profile_frame_list[profile_depth].start_cycles = DWT->CYCCNT;
+    }
+    profile_depth ++;
+    __set_PRIMASK(primask);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     中断耗时统计 退出中断服务函数
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_profile_exit(PROFILE_PIT_TIM7);
+// 备注信息     在中断服务函数结尾调用 记录的是净耗时 即扣除了期间被更高优先级中断抢占的时间
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_irq_exit (zf_profile_index_enum index)
+{
+    uint32 primask = __get_PRIMASK();
+    __disable_irq();
+    do
+    {
+        uint32 now_cycles = DWT->CYCCNT;
+        if(0 == profile_depth)                                                  // 统计在中断执行中途才初始化
+        {
+            break;
+        }
+        profile_depth --;
+        if(PROFILE_NEST_MAX <= profile_depth || PROFILE_NUM_MAX <= index)
+        {
+            break;
+        }
+
+        uint32 elapsed_cycles = now_cycles - profile_frame_list[profile_depth].start_cycles;
+        uint32 net_cycles = elapsed_cycles - profile_frame_list[profile_depth].child_cycles;
+        if(profile_depth)
+        {
+            profile_frame_list[profile_depth - 1].child_cycles += elapsed_cycles;
+        }
+
+        zf_profile_info_struct *info = &profile_info_list[index];
+        uint32 bin = net_cycles ? (32 - __CLZ(net_cycles)) : 0;                 // 0 周期为区间 0 其余为 floor(log2) + 1
+        if(PROFILE_HISTOGRAM_BINS <= bin)
+        {
+            bin = PROFILE_HISTOGRAM_BINS - 1;
+        }
+        info->histogram[bin] ++;
+        info->count ++;
+        info->total_cycles += net_cycles;
+        if(net_cycles < info->min_cycles)
+        {
+            info->min_cycles = net_cycles;
+        }
+        if(net_cycles > info->max_cycles)
+        {
+            info->max_cycles = net_cycles;
+        }
+    }while(0);
+    __set_PRIMASK(primask);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取指定中断的耗时统计
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 参数说明     *info               统计信息输出
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_profile_get_info(PROFILE_PIT_TIM7, &info);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_profile_get_info (zf_profile_index_enum index, zf_profile_info_struct *info)
+{
+    uint8 return_state = ZF_ERROR;
+
+    do
+    {
+        if(PROFILE_NUM_MAX <= index || NULL == info)
+        {
+            break;
+        }
+
+        uint32 primask = __get_PRIMASK();
+        __disable_irq();
+        memcpy(info, &profile_info_list[index], sizeof(zf_profile_info_struct));
+        __set_PRIMASK(primask);
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取指定中断的名称
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 返回参数     const char *        名称字符串 编号无效时返回 NULL
+// 使用示例     zf_profile_get_name(PROFILE_PIT_TIM7);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+const char *zf_profile_get_name (zf_profile_index_enum index)
+{
+    return (PROFILE_NUM_MAX > index) ? (profile_name_list[index]) : (NULL);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     清空所有统计 重新开始统计窗口
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_profile_reset();
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_reset (void)
+{
+    uint32 primask = __get_PRIMASK();
+    __disable_irq();
+    memset(profile_info_list, 0, sizeof(profile_info_list));
+    for(uint32 i = 0; PROFILE_NUM_MAX > i; i ++)
+    {
+        profile_info_list[i].min_cycles = 0xFFFFFFFF;
+    }
+    profile_window_start_us = zf_time_now_us();
+    __set_PRIMASK(primask);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     通过 printf 输出全部统计
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_profile_dump();
+// 备注信息     输出每个执行过的中断的 次数/最短/平均/最长/负载 与直方图 以及按当前中断优先级汇总的负载
+//              在主循环中调用 不要在中断中调用 负载按统计窗口 (zf_time_now_us 计时) 计算
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_dump (void)
+{
+#if ZF_PROFILE_ENABLE
+    uint64 level_cycles[INTERRUPT_PRIORITY_LOW + 1] = {0};
+    uint64 window_us     = zf_time_now_us() - profile_window_start_us;
+    uint32 cycles_per_us = zf_system_clock / 1000000;
+    zf_profile_info_struct info;
+
+    if(0 == window_us)
+    {
+        window_us = 1;
+    }
+    if(0 == cycles_per_us)
+    {
+        cycles_per_us = 1;
+    }
+    double window_cycles = (double)window_us * (double)cycles_per_us;          // 负载的分母 按微秒窗口换算 不会回绕
+
+    printf("\r\n[PROFILE] window %lu ms, cycles per us %lu\r\n",
+           (unsigned long)(window_us / 1000), (unsigned long)cycles_per_us);
+    printf("[PROFILE] name       prio      count   min(cyc)  mean(cyc)   max(cyc)  load(%%)\r\n");
+    for(uint32 i = 0; PROFILE_NUM_MAX > i; i ++)
+    {
+        zf_profile_get_info((zf_profile_index_enum)i, &info);
+        if(0 == info.count)
+        {
+            continue;
+        }
+
+        uint32 priority = zf_interrupt_get_priority(profile_irq_index_list[i]) & INTERRUPT_PRIORITY_MASK;
+        level_cycles[priority] += info.total_cycles;
+
+        printf("[PROFILE] %-10s %4lu %10lu %10lu %10lu %10lu %8.3f\r\n",
+               profile_name_list[i],
+               (unsigned long)priority,
+               (unsigned long)info.count,
+               (unsigned long)info.min_cycles,
+               (unsigned long)(info.total_cycles / info.count),
+               (unsigned long)info.max_cycles,
+               (double)info.total_cycles * 100.0 / window_cycles);
+
+        printf("[PROFILE]   log2 histogram:");
+        for(uint32 bin = 0; PROFILE_HISTOGRAM_BINS > bin; bin ++)
+        {
+            if(info.histogram[bin])
+            {
+                printf((PROFILE_HISTOGRAM_BINS - 1 == bin) ? (" >=2^%lu:%lu") : (" <2^%lu:%lu"),
+                       (unsigned long)((PROFILE_HISTOGRAM_BINS - 1 == bin) ? (bin - 1) : (bin)),
+                       (unsigned long)info.histogram[bin]);
+            }
+        }
+        printf("\r\n");
+    }
+
+    printf("[PROFILE] load per priority level:");
+    for(uint32 priority = 0; INTERRUPT_PRIORITY_LOW >= priority; priority ++)
+    {
+        if(level_cycles[priority])
+        {
+            printf(" P%lu=%.3f%%", (unsigned long)priority, (double)level_cycles[priority] * 100.0 / window_cycles);
+        }
+    }
+    printf("\r\n");
+#else
+    printf("[PROFILE] disabled, set ZF_PROFILE_ENABLE to 1 in zf_common_profile.h\r\n");
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     中断耗时统计初始化
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_profile_init();
+// 备注信息     使能 DWT 周期计数器并清空统计
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_init (void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;                                                      // Cortex-M7 需要先解锁 DWT 寄存器写访问
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    profile_depth = 0;
+    zf_profile_reset();
+}
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -0,0 +1,180 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_profile
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+#ifndef _zf_common_profile_h_
+#define _zf_common_profile_h_
+
+// zf_common 层引用
+#include "zf_common_typedef.h"
+#include "zf_common_trace.h"
+
+// 此处列举 当前支持的函数列表
+// 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// zf_profile_irq_enter                                                         // 中断耗时统计 进入中断服务函数
+// zf_profile_irq_exit                                                          // 中断耗时统计 退出中断服务函数
+
+// zf_profile_get_info                                                          // 获取指定中断的耗时统计
+// zf_profile_get_name                                                          // 获取指定中断的名称
+// zf_profile_reset                                                             // 清空所有统计 重新开始统计窗口
+// zf_profile_dump                                                              // 通过 printf 输出全部统计
+
+// zf_profile_init                                                              // 中断耗时统计初始化
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件需要的枚举与对象结构等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#define ZF_PROFILE_ENABLE               ( 0 )                                   // 中断耗时统计开关 关闭时驱动内的统计调用不产生任何代码
+
+#define PROFILE_HISTOGRAM_BINS          ( 24 )                                  // 对数直方图区间数 区间 k 统计 [2^(k-1), 2^k) 个周期 最后一个区间统计所有更长的
+#define PROFILE_NEST_MAX                ( 16 )                                  // 最大中断嵌套层数 与可用抢占优先级数量一致
+
+typedef enum                                                                    // 枚举 被统计的中断服务函数   此枚举定义不允许用户修改
+{
+    PROFILE_PIT_TIM1    ,   PROFILE_PIT_TIM8    ,
+    PROFILE_PIT_TIM2    ,   PROFILE_PIT_TIM5    ,
+    PROFILE_PIT_TIM3    ,   PROFILE_PIT_TIM4    ,
+    PROFILE_PIT_TIM15   ,   PROFILE_PIT_TIM16   ,
+    PROFILE_PIT_TIM6    ,   PROFILE_PIT_TIM7    ,
+
+    PROFILE_UART_1      ,   PROFILE_UART_2      ,   PROFILE_UART_3      ,
+
+    PROFILE_EXTI0       ,   PROFILE_EXTI1       ,   PROFILE_EXTI2       ,
+    PROFILE_EXTI3       ,   PROFILE_EXTI4       ,   PROFILE_EXTI9_5     ,
+    PROFILE_EXTI15_10   ,
+
+    PROFILE_ADC_1       ,   PROFILE_ADC_2       ,   PROFILE_ADC_3       ,
+    PROFILE_ADC_4       ,   PROFILE_ADC_5       ,
+
+    PROFILE_TIM_TS      ,
+
+    PROFILE_SPI1_DMA    ,   PROFILE_SPI2_DMA    ,   PROFILE_SPI3_DMA    ,
+    PROFILE_SPI4_DMA    ,
+
+    PROFILE_NUM_MAX     ,
+}zf_profile_index_enum;
+
+// 事件跟踪默认记录的中断 (zf_trace_isr_mask 初值)
+// ADC 中断随 PWM 触发 (电流采样 8.5kHz 电池采样 17kHz) 仅这两路就约 5 万事件/s 远超串口输出能力 默认不记录
+#define PROFILE_TRACE_ISR_MASK_DEFAULT  ( ((1UL << PROFILE_NUM_MAX) - 1) & ~(((1UL << (PROFILE_ADC_5 - PROFILE_ADC_1 + 1)) - 1) << PROFILE_ADC_1) )
+
+typedef struct                                                                  // 单个中断服务函数的耗时统计 单位为内核周期
+{
+    uint32                  count                                   ;           // 执行次数
+    uint32                  min_cycles                              ;           // 最短净耗时
+    uint32                  max_cycles                              ;           // 最长净耗时
+    uint64                  total_cycles                            ;           // 净耗时累计 用于平均值与负载
+    uint32                  histogram[PROFILE_HISTOGRAM_BINS]       ;           // 净耗时的以 2 为底对数直方图
+}zf_profile_info_struct;
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处列举 本文件的所有函数声明 [ 其中包括宏定义函数 ] 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#if ZF_PROFILE_ENABLE
+#define zf_profile_hook_enter(index)    zf_profile_irq_enter(index);
+#define zf_profile_hook_exit(index)     zf_profile_irq_exit(index);
+#else
+#define zf_profile_hook_enter(index)
+#define zf_profile_hook_exit(index)
+#endif
+
+// 驱动中断服务函数内的统计入口 同时记录事件跟踪 (zf_common_trace.h) 两者都关闭时不产生代码
+// 进入时先记录跟踪再开始计时 退出时先结束计时再记录跟踪 耗时统计不包含跟踪本身的开销
+#define zf_profile_enter(index)     do{ zf_trace_isr_enter(index); zf_profile_hook_enter(index) }while(0)
+#define zf_profile_exit(index)      do{ zf_profile_hook_exit(index) zf_trace_isr_exit(index); }while(0)
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     中断耗时统计 进入中断服务函数
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_profile_enter(PROFILE_PIT_TIM7);
+// 备注信息     在中断服务函数开头调用 驱动内使用 zf_profile_enter 宏 统计关闭时不产生代码
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_irq_enter (zf_profile_index_enum index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     中断耗时统计 退出中断服务函数
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_profile_exit(PROFILE_PIT_TIM7);
+// 备注信息     在中断服务函数结尾调用 记录的是净耗时 即扣除了期间被更高优先级中断抢占的时间
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_irq_exit (zf_profile_index_enum index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取指定中断的耗时统计
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 参数说明     *info               统计信息输出
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_profile_get_info(PROFILE_PIT_TIM7, &info);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_profile_get_info (zf_profile_index_enum index, zf_profile_info_struct *info);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取指定中断的名称
+// 参数说明     index               中断服务函数编号 (详见 zf_common_profile.h 内 zf_profile_index_enum 定义)
+// 返回参数     const char *        名称字符串 编号无效时返回 NULL
+// 使用示例     zf_profile_get_name(PROFILE_PIT_TIM7);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+const char *zf_profile_get_name (zf_profile_index_enum index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     清空所有统计 重新开始统计窗口
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_profile_reset();
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_reset (void);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     通过 printf 输出全部统计
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_profile_dump();
+// 备注信息     输出每个执行过的中断的 次数/最短/平均/最长/负载 与直方图 以及按当前中断优先级汇总的负载
+//              在主循环中调用 不要在中断中调用 负载按统计窗口 (zf_time_now_us 计时) 计算
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_dump (void);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     中断耗时统计初始化
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_profile_init();
+// 备注信息     使能 DWT 周期计数器并清空统计
+//-------------------------------------------------------------------------------------------------------------------
+void zf_profile_init (void);
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#endif
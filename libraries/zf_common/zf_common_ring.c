@@ -0,0 +1,252 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_ring
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+// 自身头文件
+#include "zf_common_ring.h"
+
+// 此处定义 本文件的所有函数具体定义 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     从读取位置开始拷贝数据 不修改读出计数
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                读出数据存放地址
+// 参数说明     length              最多拷贝的字节数
+// 返回参数     uint32              实际拷贝字节数
+// 使用示例     zf_ring_copy_out(ring, dat, length);
+// 备注信息     内部使用 供 zf_ring_read 与 zf_ring_peek 共用
+//-------------------------------------------------------------------------------------------------------------------
+static uint32 zf_ring_copy_out (zf_ring_obj_struct *ring, uint8 *dat, uint32 length)
+{
+    uint32 read_index   = ring->read_index;
+    uint32 used         = ring->write_index - read_index;
+    uint32 offset       = read_index & ring->mask;
+    uint32 first_length = 0;
+
+    ZF_DMB();                                                                   // 确认写入计数之后再读取数据
+
+    length              = (length > used) ? (used) : (length);
+    first_length        = ring->mask + 1 - offset;                              // 到缓冲区末尾的长度
+    first_length        = (length > first_length) ? (first_length) : (length);
+
+    memcpy(dat, &ring->buffer[offset], first_length);
+    memcpy(dat + first_length, ring->buffer, length - first_length);            // 回绕部分 长度可能为 0
+
+    return length;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     写入数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                数据来源地址
+// 参数说明     length              写入字节数
+// 返回参数     uint32              实际写入字节数 空间不足时只写入能放下的部分
+// 使用示例     zf_ring_write(&user_ring, data, length);
+// 备注信息     只能由写入方调用 空间不足时记录一次溢出
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_write (zf_ring_obj_struct *ring, const void *dat, uint32 length)
+{
+    const uint8 *data_ptr       = (const uint8 *)dat;
+    uint32      write_index     = ring->write_index;
+    uint32      free_length     = ring->mask + 1 - (write_index - ring->read_index);
+    uint32      offset          = write_index & ring->mask;
+    uint32      first_length    = 0;
+
+    if(length > free_length)
+    {
+        ring->overflow_count ++;
+        length                  = free_length;
+    }
+    first_length                = ring->mask + 1 - offset;
+    first_length                = (length > first_length) ? (first_length) : (length);
+
+    memcpy(&ring->buffer[offset], data_ptr, first_length);
+    memcpy(ring->buffer, data_ptr + first_length, length - first_length);
+
+    zf_ring_write_commit(ring, length);
+    return length;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     读出数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                读出数据存放地址
+// 参数说明     length              最多读出的字节数
+// 返回参数     uint32              实际读出字节数
+// 使用示例     zf_ring_read(&user_ring, data, length);
+// 备注信息     只能由读取方调用
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_read (zf_ring_obj_struct *ring, void *dat, uint32 length)
+{
+    length = zf_ring_copy_out(ring, (uint8 *)dat, length);
+    zf_ring_read_commit(ring, length);
+    return length;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     读取数据但不移除
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                读出数据存放地址
+// 参数说明     length              最多读取的字节数
+// 返回参数     uint32              实际读取字节数
+// 使用示例     zf_ring_peek(&user_ring, data, length);
+// 备注信息     只能由读取方调用 数据仍保留在缓冲区中
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_peek (zf_ring_obj_struct *ring, void *dat, uint32 length)
+{
+    return zf_ring_copy_out(ring, (uint8 *)dat, length);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     丢弃全部未读数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 返回参数     void
+// 使用示例     zf_ring_clear(&user_ring);
+// 备注信息     只能由读取方调用 调用期间写入方新写入的数据可能一并被丢弃
+//-------------------------------------------------------------------------------------------------------------------
+void zf_ring_clear (zf_ring_obj_struct *ring)
+{
+    ring->read_index = ring->write_index;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取可直接写入的连续区间
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     **span              输出 区间起始地址
+// 返回参数     uint32              区间长度 为 0 表示缓冲区已满
+// 使用示例     length = zf_ring_write_reserve(&user_ring, &span);
+// 备注信息     只能由写入方调用 区间不跨越缓冲区末尾 因此可能小于全部空闲空间
+//              向区间写入数据后调用 zf_ring_write_commit 提交 提交前读取方不可见
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_write_reserve (zf_ring_obj_struct *ring, uint8 **span)
+{
+    uint32 write_index  = ring->write_index;
+    uint32 free_length  = ring->mask + 1 - (write_index - ring->read_index);
+    uint32 offset       = write_index & ring->mask;
+    uint32 span_length  = ring->mask + 1 - offset;
+
+    *span               = &ring->buffer[offset];
+    return (free_length > span_length) ? (span_length) : (free_length);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     提交直接写入的数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     length              写入的字节数 不能超过 zf_ring_write_reserve 返回的长度
+// 返回参数     void
+// 使用示例     zf_ring_write_commit(&user_ring, length);
+// 备注信息     只能由写入方调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_ring_write_commit (zf_ring_obj_struct *ring, uint32 length)
+{
+    uint32 write_index  = ring->write_index + length;
+    uint32 used         = write_index - ring->read_index;
+
+    ZF_DMB();                                                                   // 数据写入完成后再发布写入计数
+    ring->write_index   = write_index;
+
+    if(used > ring->peak_used)
+    {
+        ring->peak_used = used;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取可直接读取的连续区间
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     **span              输出 区间起始地址
+// 返回参数     uint32              区间长度 为 0 表示缓冲区为空
+// 使用示例     length = zf_ring_read_reserve(&user_ring, &span);
+// 备注信息     只能由读取方调用 区间不跨越缓冲区末尾 因此可能小于全部未读数据
+//              处理完区间内的数据后调用 zf_ring_read_commit 释放 释放前写入方不会覆盖
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_read_reserve (zf_ring_obj_struct *ring, const uint8 **span)
+{
+    uint32 read_index   = ring->read_index;
+    uint32 used         = ring->write_index - read_index;
+    uint32 offset       = read_index & ring->mask;
+    uint32 span_length  = ring->mask + 1 - offset;
+
+    ZF_DMB();                                                                   // 确认写入计数之后再读取数据
+    *span               = &ring->buffer[offset];
+    return (used > span_length) ? (span_length) : (used);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     释放直接读取的数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     length              释放的字节数 不能超过 zf_ring_read_reserve 返回的长度
+// 返回参数     void
+// 使用示例     zf_ring_read_commit(&user_ring, length);
+// 备注信息     只能由读取方调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_ring_read_commit (zf_ring_obj_struct *ring, uint32 length)
+{
+    ZF_DMB();                                                                   // 数据读取完成后再释放空间
+    ring->read_index    = ring->read_index + length;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     环形缓冲区初始化 挂载对应缓冲区
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *buffer_addr        要挂载的缓冲区
+// 参数说明     size                缓冲区大小 字节单位 必须为 2 的幂
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_ring_init(&user_ring, buffer, sizeof(buffer));
+// 备注信息     初始化时写入方与读取方都不能在使用该对象
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_ring_init (zf_ring_obj_struct *ring, void *buffer_addr, uint32 size)
+{
+    uint8 return_state = ZF_ERROR;
+
+    do
+    {
+        if(NULL == ring || NULL == buffer_addr || 0 == size)                    // 对象或者缓冲区为空就不能操作
+        {
+            break;
+        }
+        if(size & (size - 1))                                                   // 长度必须为 2 的幂 才能用掩码计算下标
+        {
+            break;
+        }
+
+        ring->buffer            = (uint8 *)buffer_addr;
+        ring->mask              = size - 1;
+        ring->write_index       = 0;
+        ring->read_index        = 0;
+        ring->peak_used         = 0;
+        ring->overflow_count    = 0;
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
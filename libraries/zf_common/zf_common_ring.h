@@ -0,0 +1,266 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_ring
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+/*********************************************************************************************************************
+* 环形缓冲区说明：
+*                   单生产者单消费者 (SPSC) 字节环形缓冲区 用于中断与主循环之间传递串口等数据流
+*                   生产者只修改 write_index 消费者只修改 read_index 两端都不需要关中断或加锁
+*                   两个计数自由递增并自然回绕 数据量即两者之差 缓冲区长度必须为 2 的幂 下标用掩码计算
+*                   写入数据后执行 ZF_DMB 再发布 write_index 读出数据后执行 ZF_DMB 再发布 read_index
+*                   ------------------------------------
+*                   单字节读写为头文件内联函数 中断中每个字节只有几条指令
+*                   批量读写可使用 reserve/commit 直接访问缓冲区内的连续区间 避免额外拷贝
+*                   同一个对象同一时刻只能有一个写入方和一个读取方 否则需要调用方自行互斥
+*                   与 zf_fifo 不同 本缓冲区不支持清空由写入方发起 清空 (zf_ring_clear) 属于读取方操作
+********************************************************************************************************************/
+
+#ifndef _zf_common_ring_h_
+#define _zf_common_ring_h_
+
+// zf_common 层引用
+#include "zf_common_typedef.h"
+
+// zf_driver 层引用
+#include "zf_driver_interrupt.h"
+
+// 此处列举 当前支持的函数列表
+// 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// zf_ring_used                                                                 // 查询当前数据量
+// zf_ring_free                                                                 // 查询当前空闲空间
+// zf_ring_write_byte                                                           // 写入单个字节
+// zf_ring_read_byte                                                            // 读出单个字节
+
+// zf_ring_write                                                                // 写入数据
+// zf_ring_read                                                                 // 读出数据
+// zf_ring_peek                                                                 // 读取数据但不移除
+// zf_ring_clear                                                                // 丢弃全部未读数据
+
+// zf_ring_write_reserve                                                        // 获取可直接写入的连续区间
+// zf_ring_write_commit                                                         // 提交直接写入的数据
+// zf_ring_read_reserve                                                         // 获取可直接读取的连续区间
+// zf_ring_read_commit                                                          // 释放直接读取的数据
+
+// zf_ring_init                                                                 // 环形缓冲区初始化 挂载对应缓冲区
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件需要的枚举与对象结构等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+typedef struct                                                                  // 环形缓冲区管理对象
+{
+    uint8                  *buffer          ;                                   // 缓冲区地址
+    uint32                  mask            ;                                   // 缓冲区长度减一 长度必须为 2 的幂
+
+    volatile uint32         write_index     ;                                   // 累计写入字节数 只由写入方修改
+    volatile uint32         read_index      ;                                   // 累计读出字节数 只由读取方修改
+
+    uint32                  peak_used       ;                                   // 历史最大数据量 只由写入方修改
+    uint32                  overflow_count  ;                                   // 空间不足导致写入失败或部分写入的次数 只由写入方修改
+}zf_ring_obj_struct;
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处列举 本文件的所有函数声明 [ 其中包括宏定义函数 ] 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     查询当前数据量
+// 参数说明     *ring               环形缓冲区对象指针
+// 返回参数     uint32              当前未读字节数
+// 使用示例     zf_ring_used(&user_ring);
+// 备注信息     写入方调用时结果可能偏大 读取方调用时结果可能偏小 都不会导致越界
+//-------------------------------------------------------------------------------------------------------------------
+ZF_INLINE uint32 zf_ring_used (const zf_ring_obj_struct *ring)
+{
+    return ring->write_index - ring->read_index;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     查询当前空闲空间
+// 参数说明     *ring               环形缓冲区对象指针
+// 返回参数     uint32              当前可写入字节数
+// 使用示例     zf_ring_free(&user_ring);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+ZF_INLINE uint32 zf_ring_free (const zf_ring_obj_struct *ring)
+{
+    return ring->mask + 1 - zf_ring_used(ring);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     写入单个字节
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     dat                 写入的数据
+// 返回参数     uint8               ZF_NO_ERROR - 写入成功 / ZF_ERROR - 缓冲区已满 数据丢弃
+// 使用示例     zf_ring_write_byte(&user_ring, dat);
+// 备注信息     只能由写入方调用 一般在串口接收中断中使用
+//-------------------------------------------------------------------------------------------------------------------
+ZF_INLINE uint8 zf_ring_write_byte (zf_ring_obj_struct *ring, uint8 dat)
+{
+    uint32 write_index  = ring->write_index;
+    uint32 used         = write_index - ring->read_index;
+
+    if(used > ring->mask)
+    {
+        ring->overflow_count ++;
+        return ZF_ERROR;
+    }
+
+    ring->buffer[write_index & ring->mask] = dat;
+    ZF_DMB();                                                                   // 数据写入完成后再发布写入计数
+    ring->write_index   = write_index + 1;
+
+    if(used + 1 > ring->peak_used)
+    {
+        ring->peak_used = used + 1;
+    }
+    return ZF_NO_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     读出单个字节
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                读出数据存放地址
+// 返回参数     uint8               ZF_NO_ERROR - 读出成功 / ZF_ERROR - 缓冲区为空
+// 使用示例     zf_ring_read_byte(&user_ring, &dat);
+// 备注信息     只能由读取方调用
+//-------------------------------------------------------------------------------------------------------------------
+ZF_INLINE uint8 zf_ring_read_byte (zf_ring_obj_struct *ring, uint8 *dat)
+{
+    uint32 read_index   = ring->read_index;
+
+    if(ring->write_index == read_index)
+    {
+        return ZF_ERROR;
+    }
+
+    ZF_DMB();                                                                   // 确认写入计数之后再读取数据
+    *dat                = ring->buffer[read_index & ring->mask];
+    ZF_DMB();                                                                   // 数据读取完成后再释放空间
+    ring->read_index    = read_index + 1;
+    return ZF_NO_ERROR;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     写入数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                数据来源地址
+// 参数说明     length              写入字节数
+// 返回参数     uint32              实际写入字节数 空间不足时只写入能放下的部分
+// 使用示例     zf_ring_write(&user_ring, data, length);
+// 备注信息     只能由写入方调用 空间不足时记录一次溢出
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_write (zf_ring_obj_struct *ring, const void *dat, uint32 length);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     读出数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                读出数据存放地址
+// 参数说明     length              最多读出的字节数
+// 返回参数     uint32              实际读出字节数
+// 使用示例     zf_ring_read(&user_ring, data, length);
+// 备注信息     只能由读取方调用
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_read (zf_ring_obj_struct *ring, void *dat, uint32 length);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     读取数据但不移除
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *dat                读出数据存放地址
+// 参数说明     length              最多读取的字节数
+// 返回参数     uint32              实际读取字节数
+// 使用示例     zf_ring_peek(&user_ring, data, length);
+// 备注信息     只能由读取方调用 数据仍保留在缓冲区中
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_peek (zf_ring_obj_struct *ring, void *dat, uint32 length);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     丢弃全部未读数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 返回参数     void
+// 使用示例     zf_ring_clear(&user_ring);
+// 备注信息     只能由读取方调用 调用期间写入方新写入的数据可能一并被丢弃
+//-------------------------------------------------------------------------------------------------------------------
+void zf_ring_clear (zf_ring_obj_struct *ring);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取可直接写入的连续区间
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     **span              输出 区间起始地址
+// 返回参数     uint32              区间长度 为 0 表示缓冲区已满
+// 使用示例     length = zf_ring_write_reserve(&user_ring, &span);
+// 备注信息     只能由写入方调用 区间不跨越缓冲区末尾 因此可能小于全部空闲空间
+//              向区间写入数据后调用 zf_ring_write_commit 提交 提交前读取方不可见
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_write_reserve (zf_ring_obj_struct *ring, uint8 **span);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     提交直接写入的数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     length              写入的字节数 不能超过 zf_ring_write_reserve 返回的长度
+// 返回参数     void
+// 使用示例     zf_ring_write_commit(&user_ring, length);
+// 备注信息     只能由写入方调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_ring_write_commit (zf_ring_obj_struct *ring, uint32 length);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取可直接读取的连续区间
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     **span              输出 区间起始地址
+// 返回参数     uint32              区间长度 为 0 表示缓冲区为空
+// 使用示例     length = zf_ring_read_reserve(&user_ring, &span);
+// 备注信息     只能由读取方调用 区间不跨越缓冲区末尾 因此可能小于全部未读数据
+//              处理完区间内的数据后调用 zf_ring_read_commit 释放 释放前写入方不会覆盖
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_ring_read_reserve (zf_ring_obj_struct *ring, const uint8 **span);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     释放直接读取的数据
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     length              释放的字节数 不能超过 zf_ring_read_reserve 返回的长度
+// 返回参数     void
+// 使用示例     zf_ring_read_commit(&user_ring, length);
+// 备注信息     只能由读取方调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_ring_read_commit (zf_ring_obj_struct *ring, uint32 length);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     环形缓冲区初始化 挂载对应缓冲区
+// 参数说明     *ring               环形缓冲区对象指针
+// 参数说明     *buffer_addr        要挂载的缓冲区
+// 参数说明     size                缓冲区大小 字节单位 必须为 2 的幂
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_ring_init(&user_ring, buffer, sizeof(buffer));
+// 备注信息     初始化时写入方与读取方都不能在使用该对象
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_ring_init (zf_ring_obj_struct *ring, void *buffer_addr, uint32 size);
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#endif
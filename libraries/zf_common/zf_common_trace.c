@@ -0,0 +1,323 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_trace
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+
+// zf_common 层引用
+#include "zf_common_debug.h"
+#include "zf_common_profile.h"
+
+// zf_driver 层引用
+#include "zf_driver_interrupt.h"
+#include "zf_driver_system.h"
+
+// 自身头文件
+#include "zf_common_trace.h"
+
+// 此处定义 本文件用使用的变量与对象等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#define ZF_TRACE_INDEX_MASK             ( ZF_TRACE_BUFFER_SIZE - 1 )
+#define ZF_TRACE_FRAME_HEAD_SIZE        ( 5 )                                   // 帧头 2 字节 + 帧类型 1 字节 + 长度 2 字节
+
+static zf_trace_record_struct   trace_buffer[ZF_TRACE_BUFFER_SIZE];
+static volatile uint32          trace_head          = 0;                        // 写入计数 只增
+static volatile uint32          trace_tail          = 0;                        // 读出计数 只增 仅 zf_trace_drain 修改
+static volatile uint32          trace_drop_count    = 0;                        // 缓冲区满时丢弃的事件数
+static uint32                   trace_drop_reported = 0;                        // 上次信息帧输出时的丢弃数
+static uint32                   trace_drain_count   = 0;
+static uint8                    trace_state         = 0;                        // 1-已初始化
+
+volatile uint32                 zf_trace_isr_mask   = PROFILE_TRACE_ISR_MASK_DEFAULT;
+
+static const char              *trace_name_list[ZF_TRACE_KIND_NUM_MAX][ZF_TRACE_ID_MAX];
+
+// 事件帧发送缓冲 只在 zf_trace_drain 中使用
+static uint8                    trace_frame_buffer[ZF_TRACE_FRAME_HEAD_SIZE + ZF_TRACE_FRAME_RECORDS * sizeof(zf_trace_record_struct) + 1];
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件的所有函数具体定义 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     封装并发送一帧
+// 参数说明     type                帧类型 (详见 zf_common_trace.h 内 zf_trace_frame_enum 定义)
+// 参数说明     length              负载长度 负载需已放在 trace_frame_buffer[ZF_TRACE_FRAME_HEAD_SIZE] 起始处
+// 返回参数     void
+// 使用示例     zf_trace_send_frame(ZF_TRACE_FRAME_INFO, 12);
+// 备注信息     内部使用
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_trace_send_frame (zf_trace_frame_enum type, uint16 length)
+{
+    uint8 checksum = 0;
+    uint32 frame_length = ZF_TRACE_FRAME_HEAD_SIZE + length + 1;
+
+    trace_frame_buffer[0] = ZF_TRACE_FRAME_HEAD_0;
+    trace_frame_buffer[1] = ZF_TRACE_FRAME_HEAD_1;
+    trace_frame_buffer[2] = (uint8)type;
+    trace_frame_buffer[3] = (uint8)(length & 0xFF);
+    trace_frame_buffer[4] = (uint8)(length >> 8);
+    for(uint32 i = 2; frame_length - 1 > i; i ++)
+    {
+        checksum += trace_frame_buffer[i];
+    }
+    trace_frame_buffer[frame_length - 1] = checksum;
+
+    debug_uart_write_buffer(trace_frame_buffer, &frame_length);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     发送信息帧
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_trace_send_info();
+// 备注信息     内部使用
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_trace_send_info (void)
+{
+    uint8 *payload = &trace_frame_buffer[ZF_TRACE_FRAME_HEAD_SIZE];
+    uint32 value_list[3] = {zf_system_clock, trace_drop_count, DWT->CYCCNT};
+
+    for(uint32 i = 0; 3 > i; i ++)
+    {
+        payload[i * 4 + 0] = (uint8)(value_list[i]      );
+        payload[i * 4 + 1] = (uint8)(value_list[i] >> 8 );
+        payload[i * 4 + 2] = (uint8)(value_list[i] >> 16);
+        payload[i * 4 + 3] = (uint8)(value_list[i] >> 24);
+    }
+    trace_drop_reported = value_list[1];
+    zf_trace_send_frame(ZF_TRACE_FRAME_INFO, 12);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     发送全部名称帧
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_trace_send_names();
+// 备注信息     内部使用
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_trace_send_names (void)
+{
+    uint8 *payload = &trace_frame_buffer[ZF_TRACE_FRAME_HEAD_SIZE];
+
+    for(uint32 kind = 0; ZF_TRACE_KIND_NUM_MAX > kind; kind ++)
+    {
+        for(uint32 id = 0; ZF_TRACE_ID_MAX > id; id ++)
+        {
+            const char *name = trace_name_list[kind][id];
+            if(NULL == name)
+            {
+                continue;
+            }
+
+            uint16 length = 0;
+            payload[length ++] = (uint8)kind;
+            payload[length ++] = (uint8)id;
+            while('\0' != *name && ZF_TRACE_FRAME_RECORDS * sizeof(zf_trace_record_struct) > length)
+            {
+                payload[length ++] = (uint8)(*name ++);
+            }
+            zf_trace_send_frame(ZF_TRACE_FRAME_NAME, length);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     记录一个事件
+// 参数说明     type                事件类型 (详见 zf_common_trace.h 内 zf_trace_event_enum 定义)
+// 参数说明     id                  中断/任务/标记/计数 编号
+// 参数说明     value               计数事件的数值
+// 返回参数     void
+// 使用示例     zf_trace_task_enter(0);
+// 备注信息     可在任意中断中调用 内部短暂关中断 缓冲区满时丢弃新事件并计数
+//              一般通过 zf_trace_isr_enter / zf_trace_task_enter / zf_trace_marker / zf_trace_counter 等宏调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_record (zf_trace_event_enum type, uint8 id, int16 value)
+{
+    // 时间戳在关中断后读取 保证缓冲区内事件的时间戳单调
+    uint32 primask = __get_PRIMASK();
+    __disable_irq();
+    do
+    {
+        if(!trace_state)
+        {
+            break;
+        }
+        if(ZF_TRACE_BUFFER_SIZE <= trace_head - trace_tail)
+        {
+            trace_drop_count ++;
+            break;
+        }
+
+        zf_trace_record_struct *record = &trace_buffer[trace_head & ZF_TRACE_INDEX_MASK];
+        record->timestamp   = DWT->CYCCNT;
+        record->type        = (uint8)type;
+        record->id          = id;
+        record->value       = value;
+        trace_head ++;
+    }while(0);
+    __set_PRIMASK(primask);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     设置事件编号对应的名称
+// 参数说明     kind                名称类别 (详见 zf_common_trace.h 内 zf_trace_kind_enum 定义)
+// 参数说明     id                  编号 范围 0 - (ZF_TRACE_ID_MAX - 1)
+// 参数说明     *name               名称 只保存指针 需要是常量字符串
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_trace_set_name(ZF_TRACE_KIND_TASK, 0, "speed");
+// 备注信息     中断名称在 zf_trace_init 内按 zf_profile_index_enum 自动设置
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_trace_set_name (zf_trace_kind_enum kind, uint8 id, const char *name)
+{
+    uint8 return_state = ZF_ERROR;
+
+    do
+    {
+        if(ZF_TRACE_KIND_NUM_MAX <= kind || ZF_TRACE_ID_MAX <= id)
+        {
+            break;
+        }
+        trace_name_list[kind][id] = name;
+        trace_drain_count = 0;                                                  // 下一次输出时重发名称表
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     设置记录哪些中断的进入/退出
+// 参数说明     mask                bit n 对应 zf_profile_index_enum 编号 n 置位则记录
+// 返回参数     void
+// 使用示例     zf_trace_set_isr_mask(zf_trace_get_isr_mask() | (1UL << PROFILE_ADC_1));
+// 备注信息     zf_trace_init 时恢复为 PROFILE_TRACE_ISR_MASK_DEFAULT
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_set_isr_mask (uint32 mask)
+{
+    zf_trace_isr_mask = mask;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取当前记录的中断掩码
+// 参数说明     void
+// 返回参数     uint32              bit n 对应 zf_profile_index_enum 编号 n
+// 使用示例     uint32 mask = zf_trace_get_isr_mask();
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_trace_get_isr_mask (void)
+{
+    return zf_trace_isr_mask;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     通过 debug 串口输出缓冲区中的事件
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_trace_drain();
+// 备注信息     由最低优先级的周期任务调用 (调度器的 trace 任务) 只允许一个调用方 本函数阻塞发送
+//              每次最多输出 ZF_TRACE_DRAIN_RECORDS_MAX 个事件 其余留到下一次 每隔 ZF_TRACE_META_INTERVAL 次附带信息帧与名称表
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_drain (void)
+{
+    do
+    {
+        if(!trace_state)
+        {
+            break;
+        }
+
+        if(0 == trace_drain_count % ZF_TRACE_META_INTERVAL)
+        {
+            zf_trace_send_info();
+            zf_trace_send_names();
+        }
+        else if(trace_drop_count != trace_drop_reported)
+        {
+            zf_trace_send_info();                                               // 有新的丢弃 及时告知上位机此处存在空缺
+        }
+        trace_drain_count ++;
+
+        // 写入方不会覆盖尚未读出的事件 复制时不需要关中断
+        // 单次输出量受限 阻塞发送的时间不超过调用周期 剩余事件下一次继续输出
+        uint32 head = trace_head;
+        if(ZF_TRACE_DRAIN_RECORDS_MAX < head - trace_tail)
+        {
+            head = trace_tail + ZF_TRACE_DRAIN_RECORDS_MAX;
+        }
+        while(trace_tail != head)
+        {
+            uint32 count = head - trace_tail;
+            if(ZF_TRACE_FRAME_RECORDS < count)
+            {
+                count = ZF_TRACE_FRAME_RECORDS;
+            }
+
+            zf_trace_record_struct *payload = (zf_trace_record_struct *)&trace_frame_buffer[ZF_TRACE_FRAME_HEAD_SIZE];
+            for(uint32 i = 0; count > i; i ++)
+            {
+                memcpy(&payload[i], &trace_buffer[(trace_tail + i) & ZF_TRACE_INDEX_MASK], sizeof(zf_trace_record_struct));
+            }
+            trace_tail += count;
+
+            zf_trace_send_frame(ZF_TRACE_FRAME_EVENTS, (uint16)(count * sizeof(zf_trace_record_struct)));
+        }
+    }while(0);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     事件跟踪初始化
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_trace_init();
+// 备注信息     使能 DWT 周期计数器 清空缓冲区 设置中断名称
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_init (void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;                                                      // Cortex-M7 需要先解锁 DWT 寄存器写访问
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uint32 primask = __get_PRIMASK();
+    __disable_irq();
+    trace_head          = 0;
+    trace_tail          = 0;
+    trace_drop_count    = 0;
+    trace_drop_reported = 0;
+    trace_drain_count   = 0;
+    zf_trace_isr_mask   = PROFILE_TRACE_ISR_MASK_DEFAULT;
+    trace_state         = 1;
+    __set_PRIMASK(primask);
+
+    for(uint32 i = 0; PROFILE_NUM_MAX > i && ZF_TRACE_ID_MAX > i; i ++)
+    {
+        trace_name_list[ZF_TRACE_KIND_ISR][i] = zf_profile_get_name((zf_profile_index_enum)i);
+    }
+}
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
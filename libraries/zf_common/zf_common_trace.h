@@ -0,0 +1,200 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_trace
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+/*********************************************************************************************************************
+* 事件跟踪说明：
+*                   每个事件 8 字节 (DWT 周期计数时间戳 + 类型 + 编号 + 数值) 写入 RAM 环形缓冲区
+*                   中断进入/退出 由驱动内的 zf_profile_enter/exit 同时记录 编号即 zf_profile_index_enum
+*                   只记录 zf_trace_isr_mask 中置位的中断 默认值 PROFILE_TRACE_ISR_MASK_DEFAULT 不含随 PWM 触发的 ADC 中断
+*                   任务进入/退出 标记 计数 由用户代码调用对应宏记录 编号由用户自行分配并用 zf_trace_set_name 命名
+*                   由最低优先级的周期任务调用 zf_trace_drain 以二进制帧从 debug 串口输出 帧格式如下 多字节均为小端
+*                   输出带宽: 460800 波特率约 46KB/s 即约 5.7k 事件/s 事件产生速率需低于此值 否则缓冲区满后丢弃
+*                   ------------------------------------
+*                   0xA5 0x5A | 帧类型 1 字节 | 负载长度 2 字节 | 负载 | 校验 1 字节 (帧类型 长度 负载 逐字节累加和)
+*                   ZF_TRACE_FRAME_INFO     : 内核频率 Hz 4 字节 | 累计丢弃事件数 4 字节 | 当前时间戳 4 字节
+*                   ZF_TRACE_FRAME_NAME     : 名称类别 1 字节 | 编号 1 字节 | 名称字符串 (不含结束符)
+*                   ZF_TRACE_FRAME_EVENTS   : 若干个 zf_trace_record_struct
+*                   ------------------------------------
+*                   上位机使用 tools/trace2chrome.cpp 转换为 Chrome/Perfetto 可打开的 JSON
+*                   帧之间可以夹杂 printf 文本 上位机按帧头和校验重新同步
+********************************************************************************************************************/
+
+#ifndef _zf_common_trace_h_
+#define _zf_common_trace_h_
+
+// zf_common 层引用
+#include "zf_common_typedef.h"
+
+// 此处列举 当前支持的函数列表
+// 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// zf_trace_record                                                              // 记录一个事件
+// zf_trace_set_name                                                            // 设置事件编号对应的名称
+// zf_trace_set_isr_mask                                                        // 设置记录哪些中断的进入/退出
+// zf_trace_get_isr_mask                                                        // 获取当前记录的中断掩码
+
+// zf_trace_drain                                                               // 通过 debug 串口输出缓冲区中的事件
+
+// zf_trace_init                                                                // 事件跟踪初始化
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件需要的枚举与对象结构等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#define ZF_TRACE_ENABLE                 ( 0 )                                   // 事件跟踪开关 关闭时所有记录宏不产生任何代码
+
+#define ZF_TRACE_BUFFER_SIZE            ( 1024 )                                // 环形缓冲区事件数 必须为 2 的幂
+#define ZF_TRACE_FRAME_RECORDS          ( 64 )                                  // 每个事件帧最多包含的事件数
+#define ZF_TRACE_DRAIN_RECORDS_MAX      ( 128 )                                 // 每次 zf_trace_drain 最多输出的事件数 约 1KB 即 460800 波特率下阻塞约 23ms
+#define ZF_TRACE_META_INTERVAL          ( 50 )                                  // 每输出多少次重发一次名称表 便于上位机中途开始接收
+#define ZF_TRACE_ID_MAX                 ( 32 )                                  // 每个名称类别最多可命名的编号数
+
+#define ZF_TRACE_FRAME_HEAD_0           ( 0xA5 )
+#define ZF_TRACE_FRAME_HEAD_1           ( 0x5A )
+
+typedef enum                                                                    // 枚举 事件类型   此枚举定义不允许用户修改
+{
+    ZF_TRACE_EVENT_ISR_ENTER    = 1 ,
+    ZF_TRACE_EVENT_ISR_EXIT         ,
+    ZF_TRACE_EVENT_TASK_ENTER       ,
+    ZF_TRACE_EVENT_TASK_EXIT        ,
+    ZF_TRACE_EVENT_MARKER           ,
+    ZF_TRACE_EVENT_COUNTER          ,
+}zf_trace_event_enum;
+
+typedef enum                                                                    // 枚举 名称类别   此枚举定义不允许用户修改
+{
+    ZF_TRACE_KIND_ISR               ,
+    ZF_TRACE_KIND_TASK              ,
+    ZF_TRACE_KIND_MARKER            ,
+    ZF_TRACE_KIND_COUNTER           ,
+
+    ZF_TRACE_KIND_NUM_MAX           ,
+}zf_trace_kind_enum;
+
+typedef enum                                                                    // 枚举 帧类型   此枚举定义不允许用户修改
+{
+    ZF_TRACE_FRAME_INFO         = 1 ,
+    ZF_TRACE_FRAME_NAME             ,
+    ZF_TRACE_FRAME_EVENTS           ,
+}zf_trace_frame_enum;
+
+typedef struct                                                                  // 单个事件 8 字节
+{
+    uint32                  timestamp                               ;           // DWT 周期计数
+    uint8                   type                                    ;           // zf_trace_event_enum
+    uint8                   id                                      ;           // 中断/任务/标记/计数 编号
+    int16                   value                                   ;           // 计数事件的数值 其余事件为 0
+}zf_trace_record_struct;
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处列举 本文件的所有函数声明 [ 其中包括宏定义函数 ] 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#if ZF_TRACE_ENABLE
+extern volatile uint32 zf_trace_isr_mask;                                      // 记录进入/退出的中断 bit 编号即 zf_profile_index_enum
+
+#define zf_trace_isr_enter(id)          do{ if(zf_trace_isr_mask & (1UL << (id))) zf_trace_record(ZF_TRACE_EVENT_ISR_ENTER, (uint8)(id), 0); }while(0)
+#define zf_trace_isr_exit(id)           do{ if(zf_trace_isr_mask & (1UL << (id))) zf_trace_record(ZF_TRACE_EVENT_ISR_EXIT , (uint8)(id), 0); }while(0)
+#define zf_trace_task_enter(id)         zf_trace_record(ZF_TRACE_EVENT_TASK_ENTER, (uint8)(id), 0)
+#define zf_trace_task_exit(id)          zf_trace_record(ZF_TRACE_EVENT_TASK_EXIT , (uint8)(id), 0)
+#define zf_trace_marker(id)             zf_trace_record(ZF_TRACE_EVENT_MARKER    , (uint8)(id), 0)
+#define zf_trace_counter(id, value)     zf_trace_record(ZF_TRACE_EVENT_COUNTER   , (uint8)(id), (int16)(value))
+#else
+#define zf_trace_isr_enter(id)
+#define zf_trace_isr_exit(id)
+#define zf_trace_task_enter(id)
+#define zf_trace_task_exit(id)
+#define zf_trace_marker(id)
+#define zf_trace_counter(id, value)
+#endif
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     记录一个事件
+// 参数说明     type                事件类型 (详见 zf_common_trace.h 内 zf_trace_event_enum 定义)
+// 参数说明     id                  中断/任务/标记/计数 编号
+// 参数说明     value               计数事件的数值
+// 返回参数     void
+// 使用示例     zf_trace_task_enter(0);
+// 备注信息     可在任意中断中调用 内部短暂关中断 缓冲区满时丢弃新事件并计数
+//              一般通过 zf_trace_isr_enter / zf_trace_task_enter / zf_trace_marker / zf_trace_counter 等宏调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_record (zf_trace_event_enum type, uint8 id, int16 value);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     设置事件编号对应的名称
+// 参数说明     kind                名称类别 (详见 zf_common_trace.h 内 zf_trace_kind_enum 定义)
+// 参数说明     id                  编号 范围 0 - (ZF_TRACE_ID_MAX - 1)
+// 参数说明     *name               名称 只保存指针 需要是常量字符串
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常
+// 使用示例     zf_trace_set_name(ZF_TRACE_KIND_TASK, 0, "speed");
+// 备注信息     中断名称在 zf_trace_init 内按 zf_profile_index_enum 自动设置
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_trace_set_name (zf_trace_kind_enum kind, uint8 id, const char *name);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     设置记录哪些中断的进入/退出
+// 参数说明     mask                bit n 对应 zf_profile_index_enum 编号 n 置位则记录
+// 返回参数     void
+// 使用示例     zf_trace_set_isr_mask(zf_trace_get_isr_mask() | (1UL << PROFILE_ADC_1));
+// 备注信息     zf_trace_init 时恢复为 PROFILE_TRACE_ISR_MASK_DEFAULT
+//              打开 ADC 等高频中断前先估算事件速率 超过串口输出能力时缓冲区很快写满 之后的事件全部丢弃
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_set_isr_mask (uint32 mask);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取当前记录的中断掩码
+// 参数说明     void
+// 返回参数     uint32              bit n 对应 zf_profile_index_enum 编号 n
+// 使用示例     uint32 mask = zf_trace_get_isr_mask();
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_trace_get_isr_mask (void);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     通过 debug 串口输出缓冲区中的事件
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_trace_drain();
+// 备注信息     由最低优先级的周期任务调用 (调度器的 trace 任务) 只允许一个调用方 本函数阻塞发送
+//              每次最多输出 ZF_TRACE_DRAIN_RECORDS_MAX 个事件 其余留到下一次 每隔 ZF_TRACE_META_INTERVAL 次附带信息帧与名称表
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_drain (void);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     事件跟踪初始化
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_trace_init();
+// 备注信息     使能 DWT 周期计数器 清空缓冲区 设置中断名称
+//-------------------------------------------------------------------------------------------------------------------
+void zf_trace_init (void);
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#endif
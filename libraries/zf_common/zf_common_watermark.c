@@ -0,0 +1,313 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_watermark
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+// zf_common 层引用
+#include "zf_common_debug.h"
+#include "zf_common_memory.h"
+#include "zf_common_pool.h"
+
+// zf_driver 层引用
+#include "zf_driver_interrupt.h"
+
+// 自身头文件
+#include "zf_common_watermark.h"
+
+// 此处定义 本文件用使用的变量与对象等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+typedef struct
+{
+    const char             *name;
+    zf_fifo_obj_struct     *fifo;                                               // 与 ring 二选一 另一个为 NULL
+    zf_ring_obj_struct     *ring;
+}zf_watermark_fifo_struct;
+
+static const char *watermark_stack_name_list[WATERMARK_STACK_NUM_MAX] =
+{
+    "MSP(isr)" ,    "PSP(main)",
+};
+
+static zf_watermark_fifo_struct watermark_fifo_list[ZF_WATERMARK_FIFO_MAX];
+static uint32                   watermark_fifo_count    = 0;
+static uint8                    watermark_state         = 0;                    // 1-已填充栈
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件的所有函数具体定义 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取栈的地址范围
+// 参数说明     index               栈编号 (详见 zf_common_watermark.h 内 zf_watermark_stack_enum 定义)
+// 参数说明     *base               栈底 (低地址)
+// 参数说明     *end                栈顶 (高地址 栈从这里向下生长)
+// 返回参数     void
+// 使用示例     zf_watermark_get_stack_range(WATERMARK_STACK_MAIN, &base, &end);
+// 备注信息     内部使用
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_watermark_get_stack_range (zf_watermark_stack_enum index, uint32 *base, uint32 *end)
+{
+    if(WATERMARK_STACK_MAIN == index)
+    {
+        *base   = WATERMARK_MAIN_STACK_BASE;
+        *end    = WATERMARK_MAIN_STACK_END;
+    }
+    else
+    {
+        *base   = WATERMARK_PROCESS_STACK_BASE;
+        *end    = WATERMARK_PROCESS_STACK_END;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     登记缓冲区
+// 参数说明     *name               名称
+// 参数说明     *fifo               FIFO 对象指针 登记环形缓冲区时为 NULL
+// 参数说明     *ring               环形缓冲区对象指针 登记 FIFO 时为 NULL
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 登记数量已满
+// 使用示例     zf_watermark_register_buffer(name, fifo, NULL);
+// 备注信息     内部使用 供 zf_watermark_register_fifo 与 zf_watermark_register_ring 共用
+//-------------------------------------------------------------------------------------------------------------------
+static uint8 zf_watermark_register_buffer (const char *name, zf_fifo_obj_struct *fifo, zf_ring_obj_struct *ring)
+{
+    uint8 return_state = ZF_ERROR;
+
+    do
+    {
+        uint32 index = 0;
+        for(; watermark_fifo_count > index; index ++)
+        {
+            if(fifo == watermark_fifo_list[index].fifo && ring == watermark_fifo_list[index].ring)
+            {
+                break;
+            }
+        }
+        if(ZF_WATERMARK_FIFO_MAX <= index)                                      // 登记数量已满
+        {
+            break;
+        }
+
+        watermark_fifo_list[index].name = name;
+        watermark_fifo_list[index].fifo = fifo;
+        watermark_fifo_list[index].ring = ring;
+        if(watermark_fifo_count == index)
+        {
+            watermark_fifo_count ++;
+        }
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     登记需要统计的 FIFO
+// 参数说明     *name               名称 只保存指针 需要是常量字符串
+// 参数说明     *fifo               FIFO 对象指针
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常或登记数量已满
+// 使用示例     zf_watermark_register_fifo("wireless", &wireless_fifo);
+// 备注信息     重复登记同一个 FIFO 只更新名称 可在 zf_watermark_init 之前调用
+//              最大数据量与溢出次数由 zf_fifo 自身记录 登记只用于统一输出
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_watermark_register_fifo (const char *name, zf_fifo_obj_struct *fifo)
+{
+    if(NULL == name || NULL == fifo)
+    {
+        return ZF_ERROR;
+    }
+    return zf_watermark_register_buffer(name, fifo, NULL);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     登记需要统计的环形缓冲区
+// 参数说明     *name               名称 只保存指针 需要是常量字符串
+// 参数说明     *ring               环形缓冲区对象指针
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常或登记数量已满
+// 使用示例     zf_watermark_register_ring("gnss", &gnss_receiver_ring);
+// 备注信息     与 FIFO 共用登记表 重复登记同一个对象只更新名称 可在 zf_watermark_init 之前调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_watermark_register_ring (const char *name, zf_ring_obj_struct *ring)
+{
+    if(NULL == name || NULL == ring)
+    {
+        return ZF_ERROR;
+    }
+    return zf_watermark_register_buffer(name, NULL, ring);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取栈使用情况
+// 参数说明     index               栈编号 (详见 zf_common_watermark.h 内 zf_watermark_stack_enum 定义)
+// 参数说明     *info               使用情况输出
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常或未初始化
+// 使用示例     zf_watermark_get_stack_info(WATERMARK_STACK_MAIN, &info);
+// 备注信息     从栈底向上逐字查找 栈越大耗时越长 不要在中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_watermark_get_stack_info (zf_watermark_stack_enum index, zf_watermark_stack_info_struct *info)
+{
+    uint8 return_state = ZF_ERROR;
+
+    do
+    {
+        if(WATERMARK_STACK_NUM_MAX <= index || NULL == info || !watermark_state)
+        {
+            break;
+        }
+
+        uint32 base = 0;
+        uint32 end  = 0;
+        zf_watermark_get_stack_range(index, &base, &end);
+
+        // 栈向下生长 栈底一侧仍保持填充值的部分就是从未用到的部分
+        const uint32 *addr = (const uint32 *)base;
+        while((uint32)addr < end && ZF_WATERMARK_STACK_PATTERN == *addr)
+        {
+            addr ++;
+        }
+
+        info->size      = end - base;
+        info->peak_used = end - (uint32)addr;
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     通过 printf 输出全部水位统计
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_watermark_report();
+// 备注信息     输出栈最大深度 内存池当前/最大占用与碎片 固定块内存池各级别占用 以及已登记缓冲区的最大数据量与溢出次数
+//              在主循环中调用 不要在中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_watermark_report (void)
+{
+    zf_watermark_stack_info_struct  stack_info;
+    memory_usage_info_struct        memory_info;
+
+    printf("\r\n[WATERMARK] stack      peak(B)   size(B)  usage(%%)\r\n");
+    for(uint32 i = 0; WATERMARK_STACK_NUM_MAX > i; i ++)
+    {
+        if(ZF_NO_ERROR != zf_watermark_get_stack_info((zf_watermark_stack_enum)i, &stack_info))
+        {
+            printf("[WATERMARK] %-9s not painted, call zf_watermark_init first\r\n", watermark_stack_name_list[i]);
+            continue;
+        }
+        printf("[WATERMARK] %-9s %8lu %9lu %9.1f\r\n",
+               watermark_stack_name_list[i],
+               (unsigned long)stack_info.peak_used,
+               (unsigned long)stack_info.size,
+               (double)stack_info.peak_used * 100.0 / (double)stack_info.size);
+    }
+
+    if(ZF_NO_ERROR == zf_memory_get_info(&memory_info))
+    {
+        uint32 free_size = memory_info.total_size - memory_info.used_size;
+        printf("[WATERMARK] heap used %lu peak %lu of %lu B, blocks %lu, largest free %lu B, fragmented %lu B, malloc fail %lu\r\n",
+               (unsigned long)memory_info.used_size,
+               (unsigned long)memory_info.peak_used_size,
+               (unsigned long)memory_info.total_size,
+               (unsigned long)memory_info.block_count,
+               (unsigned long)memory_info.largest_free,
+               (unsigned long)((free_size > memory_info.largest_free) ? (free_size - memory_info.largest_free) : (0)),
+               (unsigned long)memory_info.fail_count);
+    }
+    else
+    {
+        printf("[WATERMARK] heap busy\r\n");
+    }
+
+    printf("[WATERMARK] pool  block  used  peak  count  fallback  fail\r\n");
+    for(uint32 i = 0; ZF_POOL_CLASS_NUM > i; i ++)
+    {
+        zf_pool_info_struct pool_info;
+        zf_pool_get_info(i, &pool_info);
+        printf("[WATERMARK] pool %6lu %5lu %5lu %6lu %9lu %5lu\r\n",
+               (unsigned long)pool_info.block_size,
+               (unsigned long)pool_info.used_count,
+               (unsigned long)pool_info.peak_used_count,
+               (unsigned long)pool_info.block_count,
+               (unsigned long)pool_info.fallback_count,
+               (unsigned long)pool_info.fail_count);
+    }
+
+    printf("[WATERMARK] buffer     peak    size  usage(%%)  overflow\r\n");
+    for(uint32 i = 0; watermark_fifo_count > i; i ++)
+    {
+        const zf_fifo_obj_struct *fifo = watermark_fifo_list[i].fifo;
+        const zf_ring_obj_struct *ring = watermark_fifo_list[i].ring;
+        uint32 peak     = (NULL != fifo) ? (fifo->peak_used)                  : (ring->peak_used);
+        uint32 size     = (NULL != fifo) ? (fifo->tail_ptr - fifo->base_ptr)  : (ring->mask + 1);
+        uint32 overflow = (NULL != fifo) ? (fifo->overflow_count)             : (ring->overflow_count);
+        printf("[WATERMARK] %-9s %6lu %7lu %9.1f %9lu\r\n",
+               watermark_fifo_list[i].name,
+               (unsigned long)peak,
+               (unsigned long)size,
+               (double)peak * 100.0 / (double)((0 == size) ? (1) : (size)),
+               (unsigned long)overflow);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     内存水位初始化 填充栈
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_watermark_init();
+// 备注信息     上电后尽早调用 只调用一次 填充期间关中断
+//              当前所在栈只填充栈指针以下 ZF_WATERMARK_STACK_GUARD 字节之外的部分
+//-------------------------------------------------------------------------------------------------------------------
+void zf_watermark_init (void)
+{
+    uint32 primask      = zf_interrupt_global_disable();                        // 避免中断在填充过程中压栈
+    uint32 stack_ptr    = 0;
+    uint32 base         = 0;
+    uint32 end          = 0;
+
+    for(uint32 i = 0; WATERMARK_STACK_NUM_MAX > i; i ++)
+    {
+        zf_watermark_get_stack_range((zf_watermark_stack_enum)i, &base, &end);
+        stack_ptr = (WATERMARK_STACK_MAIN == i) ? (__get_MSP()) : (__get_PSP());
+
+        // 栈指针在本栈范围内说明栈顶一侧有正在使用的数据 只填充栈指针以下的部分
+        if(base < stack_ptr && end >= stack_ptr)
+        {
+            end = (stack_ptr - base > ZF_WATERMARK_STACK_GUARD) ? (stack_ptr - ZF_WATERMARK_STACK_GUARD) : (base);
+        }
+        for(uint32 *addr = (uint32 *)base; (uint32)addr < (end & ~0x03U); addr ++)
+        {
+            *addr = ZF_WATERMARK_STACK_PATTERN;
+        }
+    }
+
+    watermark_state = 1;
+    zf_interrupt_global_enable(primask);
+}
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
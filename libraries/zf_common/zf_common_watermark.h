@@ -0,0 +1,151 @@
+/*********************************************************************************************************************
+* Stellar-SR5E1E3 Opensource Library 即（Stellar-SR5E1E3 开源库）是一个基于官方 SDK 接口的第三方开源库
+* Copyright (c) 2022 SEEKFREE 逐飞科技
+*
+* 本文件是 Stellar-SR5E1E3 开源库的一部分
+*
+* Stellar-SR5E1E3 开源库 是免费软件
+* 您可以根据自由软件基金会发布的 GPL（GNU General Public License，即 GNU通用公共许可证）的条款
+* 即 GPL 的第3版（即 GPL3.0）或（您选择的）任何后来的版本，重新发布和/或修改它
+*
+* 本开源库的发布是希望它能发挥作用，但并未对其作任何的保证
+* 甚至没有隐含的适销性或适合特定用途的保证
+* 更多细节请参见 GPL
+*
+* 您应该在收到本开源库的同时收到一份 GPL 的副本
+* 如果没有，请参阅<https://www.gnu.org/licenses/>
+*
+* 额外注明：
+* 本开源库使用 GPL3.0 开源许可证协议 以上许可申明为译文版本
+* 许可申明英文版在 libraries/doc 文件夹下的 GPL3_permission_statement.txt 文件中
+* 许可证副本在 libraries 文件夹下 即该文件夹下的 LICENSE 文件
+* 欢迎各位使用并传播本程序 但修改内容时必须保留逐飞科技的版权声明（即本声明）
+*
+* 文件名称          zf_common_watermark
+* 公司名称          成都逐飞科技有限公司
+* 版本信息          查看 libraries/doc 文件夹内 version 文件 版本说明
+* 开发环境          StellarStudio 7.0.0
+* 适用平台          Stellar-SR5E1E3
+* 店铺链接          https://www.seekfree.cn/
+********************************************************************************************************************/
+
+/*********************************************************************************************************************
+* 内存水位说明：
+*                   栈     zf_watermark_init 时将栈未使用的部分填充为固定数值 之后从栈底向上查找第一个被改写的位置
+*                          得到运行以来的最大栈深 主栈 (MSP) 供中断与异常使用 进程栈 (PSP) 供主循环使用
+*                   堆     zf_memory_malloc 记录历史最大占用与失败次数 zf_memory_get_info 计算最大连续空闲空间
+*                          zf_pool 各级别的当前/最大已分配块数 借用与失败次数由 zf_pool_get_info 获取
+*                   缓冲区 zf_fifo 与 zf_ring 写入时记录历史最大数据量与溢出次数
+*                          需要关注的缓冲区调用 zf_watermark_register_fifo / zf_watermark_register_ring 登记名称
+*                   上述全部由 zf_watermark_report 统一输出 用于根据实测数据调整栈大小 ZF_HEAP_SIZE 与各缓冲区长度
+********************************************************************************************************************/
+
+#ifndef _zf_common_watermark_h_
+#define _zf_common_watermark_h_
+
+// zf_common 层引用
+#include "zf_common_typedef.h"
+#include "zf_common_fifo.h"
+#include "zf_common_ring.h"
+
+// 此处列举 当前支持的函数列表
+// 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// zf_watermark_register_fifo                                                   // 登记需要统计的 FIFO
+// zf_watermark_register_ring                                                   // 登记需要统计的环形缓冲区
+// zf_watermark_get_stack_info                                                  // 获取栈使用情况
+
+// zf_watermark_report                                                          // 通过 printf 输出全部水位统计
+
+// zf_watermark_init                                                            // 内存水位初始化 填充栈
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 本文件需要的枚举与对象结构等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#define ZF_WATERMARK_FIFO_MAX           ( 8 )                                   // 最多可登记的 FIFO 与环形缓冲区总数
+#define ZF_WATERMARK_STACK_PATTERN      ( 0xA5C3A5C3 )                          // 栈填充数值
+#define ZF_WATERMARK_STACK_GUARD        ( 64 )                                  // 填充当前所在栈时 在栈指针以下保留的字节数 不填充
+
+typedef enum                                                                    // 枚举 栈   此枚举定义不允许用户修改
+{
+    WATERMARK_STACK_MAIN        ,                                               // 主栈 MSP 中断与异常使用
+    WATERMARK_STACK_PROCESS     ,                                               // 进程栈 PSP 主循环使用
+
+    WATERMARK_STACK_NUM_MAX     ,
+}zf_watermark_stack_enum;
+
+typedef struct                                                                  // 单个栈的使用情况 单位为字节
+{
+    uint32                  size                                    ;           // 栈总大小
+    uint32                  peak_used                               ;           // 运行以来的最大使用量
+}zf_watermark_stack_info_struct;
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处定义 栈的地址 取自链接脚本 如果移植到新的 MCU 或更换链接脚本需要自行匹配
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+extern  uint32          __main_stack_base__[];
+extern  uint32          __main_stack_end__[];
+extern  uint32          __process_stack_base__[];
+extern  uint32          __process_stack_end__[];
+
+#define WATERMARK_MAIN_STACK_BASE       ( (uint32)__main_stack_base__ )
+#define WATERMARK_MAIN_STACK_END        ( (uint32)__main_stack_end__ )
+#define WATERMARK_PROCESS_STACK_BASE    ( (uint32)__process_stack_base__ )
+#define WATERMARK_PROCESS_STACK_END     ( (uint32)__process_stack_end__ )
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+// 此处列举 本文件的所有函数声明 [ 其中包括宏定义函数 ] 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     登记需要统计的 FIFO
+// 参数说明     *name               名称 只保存指针 需要是常量字符串
+// 参数说明     *fifo               FIFO 对象指针
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常或登记数量已满
+// 使用示例     zf_watermark_register_fifo("wireless", &wireless_fifo);
+// 备注信息     重复登记同一个 FIFO 只更新名称 可在 zf_watermark_init 之前调用
+//              最大数据量与溢出次数由 zf_fifo 自身记录 登记只用于统一输出
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_watermark_register_fifo (const char *name, zf_fifo_obj_struct *fifo);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     登记需要统计的环形缓冲区
+// 参数说明     *name               名称 只保存指针 需要是常量字符串
+// 参数说明     *ring               环形缓冲区对象指针
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常或登记数量已满
+// 使用示例     zf_watermark_register_ring("gnss", &gnss_receiver_ring);
+// 备注信息     与 FIFO 共用登记表 重复登记同一个对象只更新名称 可在 zf_watermark_init 之前调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_watermark_register_ring (const char *name, zf_ring_obj_struct *ring);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取栈使用情况
+// 参数说明     index               栈编号 (详见 zf_common_watermark.h 内 zf_watermark_stack_enum 定义)
+// 参数说明     *info               使用情况输出
+// 返回参数     uint8               ZF_NO_ERROR - 成功 / ZF_ERROR - 参数异常或未初始化
+// 使用示例     zf_watermark_get_stack_info(WATERMARK_STACK_MAIN, &info);
+// 备注信息     从栈底向上逐字查找 栈越大耗时越长 不要在中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_watermark_get_stack_info (zf_watermark_stack_enum index, zf_watermark_stack_info_struct *info);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     通过 printf 输出全部水位统计
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_watermark_report();
+// 备注信息     输出栈最大深度 内存池当前/最大占用与碎片 固定块内存池各级别占用 以及已登记缓冲区的最大数据量与溢出次数
+//              在主循环中调用 不要在中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_watermark_report (void);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     内存水位初始化 填充栈
+// 参数说明     void
+// 返回参数     void
+// 使用示例     zf_watermark_init();
+// 备注信息     上电后尽早调用 只调用一次 填充期间关中断
+//              当前所在栈只填充栈指针以下 ZF_WATERMARK_STACK_GUARD 字节之外的部分
+//-------------------------------------------------------------------------------------------------------------------
+void zf_watermark_init (void);
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#endif
@@ -317,6 +317,7 @@ uint8 display_interface_clear (display_interface_obj_struct *interface)
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -337,6 +338,7 @@ uint8 display_interface_clear (display_interface_obj_struct *interface)
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -372,6 +374,7 @@ uint8 display_interface_full (display_interface_obj_struct *interface, const uin
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -392,6 +395,7 @@ uint8 display_interface_full (display_interface_obj_struct *interface, const uin
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -440,6 +444,7 @@ uint8 display_interface_draw_point (display_interface_obj_struct *interface, uin
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -451,6 +456,7 @@ uint8 display_interface_draw_point (display_interface_obj_struct *interface, uin
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -511,6 +517,7 @@ uint8 display_interface_draw_line (display_interface_obj_struct *interface, uint
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -562,6 +569,7 @@ uint8 display_interface_draw_line (display_interface_obj_struct *interface, uint
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -610,6 +618,7 @@ uint8 display_interface_show_char (display_interface_obj_struct *interface, uint
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -678,6 +687,7 @@ uint8 display_interface_show_char (display_interface_obj_struct *interface, uint
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -726,6 +736,7 @@ uint8 display_interface_show_string (display_interface_obj_struct *interface, ui
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -800,6 +811,7 @@ uint8 display_interface_show_string (display_interface_obj_struct *interface, ui
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -854,6 +866,7 @@ uint8 display_interface_show_int (display_interface_obj_struct *interface, uint1
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -881,6 +894,7 @@ uint8 display_interface_show_int (display_interface_obj_struct *interface, uint1
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -935,6 +949,7 @@ uint8 display_interface_show_uint (display_interface_obj_struct *interface, uint
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -962,6 +977,7 @@ uint8 display_interface_show_uint (display_interface_obj_struct *interface, uint
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -1022,6 +1038,7 @@ uint8 display_interface_show_float (display_interface_obj_struct *interface, uin
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -1047,6 +1064,7 @@ uint8 display_interface_show_float (display_interface_obj_struct *interface, uin
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -1104,6 +1122,7 @@ uint8 display_interface_show_wave (display_interface_obj_struct *interface, uint
 
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
         }
 
@@ -1133,6 +1152,7 @@ uint8 display_interface_show_wave (display_interface_obj_struct *interface, uint
         if(DISPLAY_INTERFACE_TYPE_SPI == interface->interface_type)
         {
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
 
         return_state = DISPLAY_INTERFACE_OPERATION_DONE;
@@ -45,7 +45,8 @@
 
 // 此处定义 GNSS 相关的接口资源 这里不允许用户修改 这里不允许用户修改 这里不允许用户修改
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-#define GNSS_BUFFER_SIZE    ( 128 )
+#define GNSS_BUFFER_SIZE    ( 128 )                                                 // 接收缓冲区长度 必须为 2 的幂
+_Static_assert(0 == (GNSS_BUFFER_SIZE & (GNSS_BUFFER_SIZE - 1)), "GNSS_BUFFER_SIZE must be a power of 2");
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 // 此处定义 本文件用使用的变量与对象等 这里不允许用户修改 这里不允许用户修改 这里不允许用户修改
@@ -55,7 +56,7 @@ AT_ZF_LIB_SECTION uint8                         gnss_flag = 0;
 AT_ZF_LIB_SECTION gnss_info_struct              gnss_info;                              // GNSS 解析之后的数据
 
 AT_ZF_LIB_SECTION static  uint8                 gnss_state = 0;                         // 1-GNSS 初始化完成
-AT_ZF_LIB_SECTION static  zf_fifo_obj_struct    gnss_receiver_fifo;                     // 
+AT_ZF_LIB_SECTION static  zf_ring_obj_struct    gnss_receiver_ring;                     // 串口接收环形缓冲区
 AT_ZF_LIB_SECTION static  uint8                 gnss_receiver_buffer[GNSS_BUFFER_SIZE]; // 数据存放数组
 
 AT_ZF_LIB_SECTION static  gnss_state_enum       gnss_gga_state = GNSS_STATE_RECEIVING;  // gga 语句状态
@@ -65,6 +66,9 @@ AT_ZF_LIB_SECTION static  gnss_state_enum       gnss_ths_state = GNSS_STATE_RECE
 AT_ZF_LIB_SECTION static  uint8                 gnss_gga_buffer[GNSS_BUFFER_SIZE];
 AT_ZF_LIB_SECTION static  uint8                 gnss_rmc_buffer[GNSS_BUFFER_SIZE];
 AT_ZF_LIB_SECTION static  uint8                 gnss_ths_buffer[GNSS_BUFFER_SIZE];
+
+AT_ZF_LIB_SECTION static  void_callback_uint32_ptr  gnss_sentence_callback      = NULL;    // 语句接收完成回调 串口中断内调用
+AT_ZF_LIB_SECTION static  void                     *gnss_sentence_callback_ptr  = NULL;    // 语句接收完成回调参数
 AT_ZF_LIB_SECTION_END
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
@@ -420,22 +424,24 @@ static void gnss_uart_callback (uint32 event, void *ptr)
     (void)ptr;
 
     uint8 temp_gnss[6];
-    uint32 temp_length = 0;
 
     if(gnss_state)
     {
         uint8 dat;
         while(!zf_uart_query_byte(GNSS_UART_INDEX, &dat))
         {
-            temp_length = 1;
-            zf_fifo_write_buffer(&gnss_receiver_fifo, &dat, &temp_length);
+            zf_ring_write_byte(&gnss_receiver_ring, dat);
         }
         
         if('\n' == dat)
         {
+            if(NULL != gnss_sentence_callback)
+            {
+                gnss_sentence_callback(0, gnss_sentence_callback_ptr);
+            }
+
             // 读取前6个数据 用于判断语句类型
-            temp_length = 6;
-            zf_fifo_read_buffer(&gnss_receiver_fifo, temp_gnss, &temp_length, FIFO_READ_WITHOUT_CLEAN);
+            zf_ring_peek(&gnss_receiver_ring, temp_gnss, sizeof(temp_gnss));
             
             // 根据不同类型将数据拷贝到不同的缓冲区
             if(0 == strncmp((char *)&temp_gnss[3], "RMC", 3))
@@ -444,8 +450,7 @@ static void gnss_uart_callback (uint32 event, void *ptr)
                 if(GNSS_STATE_PARSING != gnss_rmc_state)
                 {
                     gnss_rmc_state = GNSS_STATE_RECEIVED;
-                    temp_length = zf_fifo_used(&gnss_receiver_fifo);
-                    zf_fifo_read_buffer(&gnss_receiver_fifo, gnss_rmc_buffer, &temp_length, FIFO_READ_WITH_CLEAN);
+                    zf_ring_read(&gnss_receiver_ring, gnss_rmc_buffer, GNSS_BUFFER_SIZE);
                 }
             }
             else if(0 == strncmp((char *)&temp_gnss[3], "GGA", 3))
@@ -454,8 +459,7 @@ static void gnss_uart_callback (uint32 event, void *ptr)
                 if(GNSS_STATE_PARSING != gnss_gga_state)
                 {
                     gnss_gga_state = GNSS_STATE_RECEIVED;
-                    temp_length = zf_fifo_used(&gnss_receiver_fifo);
-                    zf_fifo_read_buffer(&gnss_receiver_fifo, gnss_gga_buffer, &temp_length, FIFO_READ_WITH_CLEAN);
+                    zf_ring_read(&gnss_receiver_ring, gnss_gga_buffer, GNSS_BUFFER_SIZE);
                 }
             }
             else if(0 == strncmp((char *)&temp_gnss[3], "THS", 3))
@@ -464,13 +468,12 @@ static void gnss_uart_callback (uint32 event, void *ptr)
                 if(GNSS_STATE_PARSING != gnss_ths_state)
                 {
                     gnss_ths_state = GNSS_STATE_RECEIVED;
-                    temp_length = zf_fifo_used(&gnss_receiver_fifo);
-                    zf_fifo_read_buffer(&gnss_receiver_fifo, gnss_ths_buffer, &temp_length, FIFO_READ_WITH_CLEAN);
+                    zf_ring_read(&gnss_receiver_ring, gnss_ths_buffer, GNSS_BUFFER_SIZE);
                 }
             }
             
-            // 统一将FIFO清空
-            zf_fifo_clear(&gnss_receiver_fifo);
+            // 统一将缓冲区清空
+            zf_ring_clear(&gnss_receiver_ring);
 
             gnss_flag = 1;
         }
@@ -621,6 +624,22 @@ uint8 gnss_data_parse (void)
     return return_state;
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     GNSS 设置语句接收完成回调
+// 参数说明     callback        回调函数 为 NULL 则关闭回调
+// 参数说明     *ptr            回调参数
+// 返回参数     void
+// 使用示例     gnss_set_sentence_callback(callback, ptr);
+// 备注信息     每收到一条语句的 '\n' 在串口中断内调用一次 回调内只做时间戳等轻量操作
+//-------------------------------------------------------------------------------------------------------------------
+void gnss_set_sentence_callback (void_callback_uint32_ptr callback, void *ptr)
+{
+    uint32 primask = zf_interrupt_global_disable();
+    gnss_sentence_callback      = callback;
+    gnss_sentence_callback_ptr  = ptr;
+    zf_interrupt_global_enable(primask);
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     GNSS 初始化
 // 参数说明     void
@@ -650,7 +669,11 @@ uint8 gnss_init (gnss_type_enum gnss_type)
     {
         case GNSS_TYPE_TAU1201:
         {
-            zf_fifo_init(&gnss_receiver_fifo, FIFO_DATA_8BIT, gnss_receiver_buffer, GNSS_BUFFER_SIZE);
+            if(zf_ring_init(&gnss_receiver_ring, gnss_receiver_buffer, GNSS_BUFFER_SIZE))
+            {
+                break;                                                          // 接收缓冲区不可用 不打开串口接收 返回异常
+            }
+            zf_watermark_register_ring("gnss", &gnss_receiver_ring);
             gnss_delay_ms(500);                                                 // 等待GNSS启动后开始初始化
             zf_uart_init(GNSS_UART_INDEX, 115200, GNSS_RX_PIN, GNSS_TX_PIN);
 
@@ -690,7 +713,11 @@ uint8 gnss_init (gnss_type_enum gnss_type)
         case GNSS_TYPE_GN43RFA:
         {
             // GN43RFA RTK模块不需要进行参数设置，如果需要修改参数应该使用专用的上位机修改参数
-            zf_fifo_init(&gnss_receiver_fifo, FIFO_DATA_8BIT, gnss_receiver_buffer, GNSS_BUFFER_SIZE);
+            if(zf_ring_init(&gnss_receiver_ring, gnss_receiver_buffer, GNSS_BUFFER_SIZE))
+            {
+                break;                                                          // 接收缓冲区不可用 不打开串口接收 返回异常
+            }
+            zf_watermark_register_ring("gnss", &gnss_receiver_ring);
             zf_uart_init(GNSS_UART_INDEX, 115200, GNSS_RX_PIN, GNSS_TX_PIN);
 
             gnss_state = 1;
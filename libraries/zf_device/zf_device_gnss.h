@@ -57,6 +57,7 @@
 // gnss_get_two_points_azimuth                                                  // GNSS 计算从第一个点到第二个点的方位角
 
 // gnss_data_parse                                                              // GNSS 解析数据
+// gnss_set_sentence_callback                                                   // GNSS 设置语句接收完成回调
 
 // gnss_init                                                                    // GNSS 初始化
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -205,6 +206,16 @@ double gnss_get_two_points_azimuth (double latitude1, double longitude1, double
 //-------------------------------------------------------------------------------------------------------------------
 uint8 gnss_data_parse (void);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     GNSS 设置语句接收完成回调
+// 参数说明     callback        回调函数 为 NULL 则关闭回调
+// 参数说明     *ptr            回调参数
+// 返回参数     void
+// 使用示例     gnss_set_sentence_callback(callback, ptr);
+// 备注信息     每收到一条语句的 '\n' 在串口中断内调用一次 回调内只做时间戳等轻量操作
+//-------------------------------------------------------------------------------------------------------------------
+void gnss_set_sentence_callback (void_callback_uint32_ptr callback, void *ptr);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     GNSS 初始化
 // 参数说明     void
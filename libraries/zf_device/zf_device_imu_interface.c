@@ -124,10 +124,12 @@ uint8 imu_interface_write_8bit_register (imu_interface_obj_struct *interface, ui
         return_state = IMU_INTERFACE_OPERATION_DONE;
         if(IMU_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             zf_spi_transfer_8bit_array(interface->spi_index, &reg , NULL, 1);
             zf_spi_transfer_8bit_array(interface->spi_index, &data, NULL, 1);
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
@@ -175,10 +177,12 @@ uint8 imu_interface_write_8bit_registers (imu_interface_obj_struct *interface, u
         return_state = IMU_INTERFACE_OPERATION_DONE;
         if(IMU_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             zf_spi_transfer_8bit_array(interface->spi_index, &reg , NULL, 1);
             zf_spi_transfer_8bit_array(interface->spi_index, data, NULL, len);
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
@@ -225,10 +229,12 @@ uint8 imu_interface_read_8bit_register (imu_interface_obj_struct *interface, uin
         return_state = IMU_INTERFACE_OPERATION_DONE;
         if(IMU_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             zf_spi_transfer_8bit_array(interface->spi_index, &reg , NULL , 1);
             zf_spi_transfer_8bit_array(interface->spi_index, NULL, data, 1);
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
@@ -276,10 +282,12 @@ uint8 imu_interface_read_8bit_registers (imu_interface_obj_struct *interface, ui
         return_state = IMU_INTERFACE_OPERATION_DONE;
         if(IMU_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             zf_spi_transfer_8bit_array(interface->spi_index, &reg , NULL , 1);
             zf_spi_transfer_8bit_array(interface->spi_index, NULL, data, len);
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
@@ -323,10 +331,12 @@ uint8 imu_interface_transfer_8bit_array (imu_interface_obj_struct *interface, ui
         return_state = IMU_INTERFACE_OPERATION_DONE;
         if(IMU_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             zf_spi_transfer_8bit_array(interface->spi_index, send_data, NULL, send_len);
             zf_spi_transfer_8bit_array(interface->spi_index, NULL, receive_data, receive_len);
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
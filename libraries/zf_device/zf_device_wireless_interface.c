@@ -170,9 +170,11 @@ uint8 wireless_interface_write_8bit_array (wireless_interface_obj_struct *interf
         return_state = WIRELESS_INTERFACE_OPERATION_DONE;
         if(WIRELESS_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             zf_spi_transfer_8bit_array(interface->spi_index, send_data, NULL, send_len);
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
@@ -213,9 +215,11 @@ uint8 wireless_interface_read_8bit_array (wireless_interface_obj_struct *interfa
         return_state = WIRELESS_INTERFACE_OPERATION_DONE;
         if(WIRELESS_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             zf_spi_transfer_8bit_array(interface->spi_index, NULL, receive_data, receive_len);
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
@@ -259,6 +263,7 @@ uint8 wireless_interface_transfer_8bit_array (wireless_interface_obj_struct *int
         return_state = WIRELESS_INTERFACE_OPERATION_DONE;
         if(WIRELESS_INTERFACE_TYPE_SPI == interface->interface_type)
         {
+            zf_spi_bus_claim(interface->spi_index);
             zf_gpio_low(interface->spi_cs_pin);
             if(NULL != send_data && 0 != send_len)
             {
@@ -269,6 +274,7 @@ uint8 wireless_interface_transfer_8bit_array (wireless_interface_obj_struct *int
                 zf_spi_transfer_8bit_array(interface->spi_index, NULL, receive_data, receive_len);
             }
             zf_gpio_high(interface->spi_cs_pin);
+            zf_spi_bus_release(interface->spi_index);
         }
         else
         {
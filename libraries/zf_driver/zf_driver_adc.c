@@ -31,9 +31,11 @@
 
 // zf_common 层引用
 #include "zf_common_debug.h"
+#include "zf_common_profile.h"
 #include "zf_common_memory.h"
 
 // zf_driver 层引用
+#include "zf_driver_interrupt.h"
 #include "zf_driver_system.h"
 #include "zf_driver_rcc.h"
 
@@ -48,6 +50,13 @@ static const zf_rcc_index_enum adc_rcc_index[ADC_NUM_MAX]  =
     RCC_INDEX_ADC12, RCC_INDEX_ADC12, RCC_INDEX_ADC345, RCC_INDEX_ADC345, RCC_INDEX_ADC345
 };
 
+static const zf_interrupt_index_enum adc_irq_index_list[ADC_NUM_MAX] =
+{
+    INTERRUPT_INDEX_ADC1, INTERRUPT_INDEX_ADC2, INTERRUPT_INDEX_ADC3, INTERRUPT_INDEX_ADC4, INTERRUPT_INDEX_ADC5
+};
+
+static void zf_adc_callbakc_defalut (uint32 event, void *ptr);
+
 #define     ADC_CHANNEL_PIN_DEFAULT     \
 {   \
     PIN_NULL,   PIN_NULL,   PIN_NULL,   PIN_NULL,   PIN_NULL,   PIN_NULL,\
@@ -65,9 +74,68 @@ AT_ZF_LIB_SECTION zf_adc_obj_struct adc_obj_list[ADC_NUM_MAX] =
     {.adc_ptr = ADC4, .pin_list = ADC_CHANNEL_PIN_DEFAULT, .config_info = 0},
     {.adc_ptr = ADC5, .pin_list = ADC_CHANNEL_PIN_DEFAULT, .config_info = 0}
 };
+
+// 注入组转换完成中断 回调函数第一个参数为 ADC 索引 第二个参数是用户指针
+AT_ZF_LIB_SECTION zf_interrupt_callback_struct adc_injected_callback[ADC_NUM_MAX] =
+{
+    {zf_adc_callbakc_defalut, NULL},   {zf_adc_callbakc_defalut, NULL},
+    {zf_adc_callbakc_defalut, NULL},   {zf_adc_callbakc_defalut, NULL},
+    {zf_adc_callbakc_defalut, NULL}
+};
+
+// 注入组通道数量 0 表示注入组未初始化
+AT_ZF_LIB_SECTION uint8 adc_injected_count[ADC_NUM_MAX] = {0, 0, 0, 0, 0};
 AT_ZF_LIB_SECTION_END
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
+// 此处定义 本文件的外部重载函数 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 中断默认回调函数
+// 参数说明     event               触发中断的 ADC 索引
+// 参数说明     *ptr                回调参数 用户自拟定的参数指针 不需要的话就传入 NULL
+// 返回参数     void
+// 使用示例     
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_adc_callbakc_defalut (uint32 event, void *ptr)
+{
+    (void)event;
+    (void)ptr;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 注入序列完成中断公共处理
+// 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_adc_injected_irq_handler(ADC_1);
+// 备注信息     JEOS 标志写 1 清零 JEOC 一并清掉 数据保留在 JDRx 中由回调读取
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_adc_injected_irq_handler (zf_adc_index_enum adc_index)
+{
+    uint32 isr_temp = adc_obj_list[adc_index].adc_ptr->ISR;
+    if(isr_temp & (0x00000001 << 6))                                            // JEOS 注入序列转换完成
+    {
+        adc_obj_list[adc_index].adc_ptr->ISR = (0x00000001 << 6) | (0x00000001 << 5);
+        adc_injected_callback[adc_index].callback(adc_index, adc_injected_callback[adc_index].parameter_ptr);
+    }
+    ZF_DSB();
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC1 - ADC5 的中断服务函数
+// 参数说明     void
+// 返回参数     void
+// 使用示例     
+// 备注信息     启动 .s 文件定义 不允许修改函数名称
+//-------------------------------------------------------------------------------------------------------------------
+void IRQ_ADC1_HANDLER (void) { zf_profile_enter(PROFILE_ADC_1); zf_adc_injected_irq_handler(ADC_1); zf_profile_exit(PROFILE_ADC_1); }
+void IRQ_ADC2_HANDLER (void) { zf_profile_enter(PROFILE_ADC_2); zf_adc_injected_irq_handler(ADC_2); zf_profile_exit(PROFILE_ADC_2); }
+void IRQ_ADC3_HANDLER (void) { zf_profile_enter(PROFILE_ADC_3); zf_adc_injected_irq_handler(ADC_3); zf_profile_exit(PROFILE_ADC_3); }
+void IRQ_ADC4_HANDLER (void) { zf_profile_enter(PROFILE_ADC_4); zf_adc_injected_irq_handler(ADC_4); zf_profile_exit(PROFILE_ADC_4); }
+void IRQ_ADC5_HANDLER (void) { zf_profile_enter(PROFILE_ADC_5); zf_adc_injected_irq_handler(ADC_5); zf_profile_exit(PROFILE_ADC_5); }
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
 // 此处定义 本文件的所有函数具体定义 这里不允许用户修改
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 //-------------------------------------------------------------------------------------------------------------------
@@ -220,6 +288,49 @@ uint8 zf_adc_get_convert_average_data (zf_adc_channel_enum channel, const uint8
     return return_state;                                                        // 输出均值数据
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 获取注入组转换数据
+// 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
+// 参数说明     rank                注入组序号 0 - 3 对应 zf_adc_injected_trigger_init 中 channel_list 的顺序
+// 参数说明     *data               ADC 转换存储地址指针 uint16 * 类型
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ADC_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_adc_get_injected_data(adc_index, 0, data);
+// 备注信息     只读取数据寄存器 不会启动转换 一般在注入组转换完成回调中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_adc_get_injected_data (zf_adc_index_enum adc_index, uint8 rank, uint16 *data)
+{
+    zf_adc_operation_state_enum return_state = ADC_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_adc_assert(rank < adc_injected_count[adc_index]))
+        {
+            // 此处如果断言报错 那么证明注入组没有初始化 或者序号超出了注入组通道数量
+            return_state = ADC_ERROR_INJECTED_NOT_INIT;                         // ADC 注入组未初始化 操作无法进行
+            break;
+        }
+        if(zf_adc_assert(NULL != data))
+        {
+            // 此处如果断言报错 那么证明传入数据指针为 NULL 空指针
+            // 不可以对空指针进行操作
+            return_state = ADC_ERROR_DATA_BUFFER_NULL;                          // ADC 数据指针异常 操作无法进行
+            break;
+        }
+
+        switch(rank)
+        {
+            case 0:     *data = (uint16)adc_obj_list[adc_index].adc_ptr->JDR1;  break;
+            case 1:     *data = (uint16)adc_obj_list[adc_index].adc_ptr->JDR2;  break;
+            case 2:     *data = (uint16)adc_obj_list[adc_index].adc_ptr->JDR3;  break;
+            default:    *data = (uint16)adc_obj_list[adc_index].adc_ptr->JDR4;  break;
+        }
+
+        return_state = ADC_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     ADC 通道使能
 // 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
@@ -413,6 +524,124 @@ uint8 zf_adc_module_deinit (zf_adc_index_enum adc_index)
     return return_state;                                                        // 返回状态
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 注入组外部触发注销初始化
+// 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ADC_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_adc_injected_trigger_deinit(adc_index);
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_adc_injected_trigger_deinit (zf_adc_index_enum adc_index)
+{
+    zf_adc_operation_state_enum return_state = ADC_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_adc_assert(adc_injected_count[adc_index]))
+        {
+            // 此处如果断言报错 那么证明注入组没有初始化 没初始化怎么注销
+            return_state = ADC_ERROR_INJECTED_NOT_INIT;                         // ADC 注入组未初始化 操作无法进行
+            break;
+        }
+
+        zf_interrupt_disable(adc_irq_index_list[adc_index]);
+
+        adc_obj_list[adc_index].adc_ptr->CR |= (0x00000001 << 5);               // JADSTP 停止注入组转换
+        while(adc_obj_list[adc_index].adc_ptr->CR & (0x00000001 << 3));         // 等待 JADSTART 清零
+        adc_obj_list[adc_index].adc_ptr->IER &= ~(0x00000001 << 6);             // 关闭 JEOS 中断
+        adc_obj_list[adc_index].adc_ptr->JSQR = 0;
+
+        adc_injected_callback[adc_index].callback       = zf_adc_callbakc_defalut;
+        adc_injected_callback[adc_index].parameter_ptr  = NULL;
+        adc_injected_count[adc_index] = 0;
+
+        return_state = ADC_OPERATION_DONE;
+    }while(0);
+
+    return return_state;                                                        // 返回状态
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 注入组外部触发初始化
+// 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
+// 参数说明     *channel_list       注入组通道列表 按顺序转换 通道必须属于 adc_index 且已调用 zf_adc_channel_init
+// 参数说明     count               通道数量 1 - ADC_INJECTED_NUM_MAX
+// 参数说明     trigger_select      注入组外部触发源编号 (JEXTSEL 值 详见参考手册 ADC 外部触发映射表)
+// 参数说明     edge                触发边沿        (详见 zf_driver_adc.h 中枚举 zf_adc_trigger_edge_enum 定义)
+// 参数说明     callback            注入序列转换完成回调 第一个参数为 ADC 索引
+// 参数说明     *ptr                回调参数 用户自拟定的参数指针 不需要的话就传入 NULL
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ADC_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_adc_injected_trigger_init(ADC_1, list, 1, trigger_select, ADC_TRIGGER_EDGE_RISING, callback, NULL);
+// 备注信息     转换由硬件触发 结果保存在注入组数据寄存器中 CPU 只在整个序列完成后进一次中断
+//              不影响 zf_adc_get_convert_data 的规则组软件转换
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_adc_injected_trigger_init (zf_adc_index_enum adc_index, const zf_adc_channel_enum *channel_list, uint8 count, uint8 trigger_select, zf_adc_trigger_edge_enum edge, void_callback_uint32_ptr callback, void *ptr)
+{
+    zf_adc_operation_state_enum return_state = ADC_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_adc_assert(adc_obj_list[adc_index].init))
+        {
+            // 此处如果断言报错 那么证明本通道没有初始化过 是不允许直接操作的
+            // 未初始化模块很可能没有开启模块时钟或者没有使能模块
+            // 对于部分单片机没有使能模块直接操作会导致总线异常或者硬件错误
+            return_state = ADC_ERROR_MODULE_NOT_INIT;                           // ADC 模块未初始化 操作无法进行
+            break;
+        }
+        if(zf_adc_assert(NULL != channel_list && 0 < count && ADC_INJECTED_NUM_MAX >= count))
+        {
+            // 此处如果断言报错 那么证明注入组通道列表为空 或者数量超出硬件注入组深度
+            return_state = ADC_ERROR_INJECTED_COUNT_ILLEGAL;                    // ADC 注入组通道数量非法 操作无法进行
+            break;
+        }
+        if(zf_adc_assert(NULL != callback))
+        {
+            // 此处如果断言报错 那么证明回调函数为空指针 是不允许的
+            // 中断必须设置有效的回调函数 否则会导致程序异常
+            return_state = ADC_ERROR_INTERRUPT_CALLBACK_ILLEGAL;                // ADC 中断回调非法 操作无法进行
+            break;
+        }
+
+        uint32 jsqr_temp = ((uint32)(count - 1))
+                         | (((uint32)trigger_select & 0x1F) << 2)
+                         | (((uint32)edge & 0x03) << 7);
+        uint8  loop_count = 0;
+        for(loop_count = 0; loop_count < count; loop_count ++)
+        {
+            uint8 channel_index = ((channel_list[loop_count] >> ADC_INDEX_OFFSET) & ADC_INDEX_MASK);
+            uint8 adc_channel   = ((channel_list[loop_count] >> ADC_CHANNEL_OFFSET) & ADC_CHANNEL_MASK);
+            if(zf_adc_assert(channel_index == adc_index
+                && (adc_obj_list[adc_index].config_info & (1U << adc_channel))))
+            {
+                // 此处如果断言报错 那么证明通道不属于本模块 或者通道未初始化
+                break;
+            }
+            jsqr_temp |= ((uint32)adc_channel << (9 + loop_count * 6));         // JSQ1 - JSQ4 每个占 6bit
+        }
+        if(loop_count != count)
+        {
+            return_state = ADC_ERROR_CHANNEL_NOT_INIT;                          // ADC 通道未初始化 操作无法进行
+            break;
+        }
+
+        adc_injected_callback[adc_index].callback       = callback;
+        adc_injected_callback[adc_index].parameter_ptr  = ptr;
+        adc_injected_count[adc_index] = count;
+
+        adc_obj_list[adc_index].adc_ptr->JSQR = jsqr_temp;
+        adc_obj_list[adc_index].adc_ptr->ISR  = (0x00000001 << 6) | (0x00000001 << 5);  // 清除残留 JEOS JEOC
+        adc_obj_list[adc_index].adc_ptr->IER |= (0x00000001 << 6);              // 只开 JEOS 整个序列完成才进中断
+        zf_interrupt_enable(adc_irq_index_list[adc_index]);
+
+        adc_obj_list[adc_index].adc_ptr->CR |= (0x00000001 << 3);               // JADSTART 等待外部触发
+
+        return_state = ADC_OPERATION_DONE;
+    }while(0);
+
+    return return_state;                                                        // 返回状态
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     ADC 通道初始化
 // 参数说明     channel             选择 ADC 通道   (详见 zf_driver_adc.h 中枚举 zf_adc_channel_enum 定义)
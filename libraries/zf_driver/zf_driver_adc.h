@@ -46,6 +46,10 @@
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 // zf_adc_get_convert_data                                                       // ADC 获取对应通道转换数据
 // zf_adc_get_convert_average_data                                               // ADC 获取对应通道转换数据的平均值
+// zf_adc_get_injected_data                                                      // ADC 获取注入组转换数据
+
+// zf_adc_injected_trigger_deinit                                                // ADC 注入组外部触发注销初始化
+// zf_adc_injected_trigger_init                                                  // ADC 注入组外部触发初始化
 
 // zf_adc_enable                                                                 // ADC 通道使能
 // zf_adc_disable                                                                // ADC 通道禁止
@@ -201,8 +205,21 @@ typedef enum
     ADC_ERROR_CHANNEL_NOT_INIT                      ,                           // ADC 通道未初始化 操作无法进行
 
     ADC_ERROR_DATA_BUFFER_NULL                      ,                           // ADC 数据指针异常 操作无法进行
+
+    ADC_ERROR_INJECTED_COUNT_ILLEGAL                ,                           // ADC 注入组通道数量非法 操作无法进行
+    ADC_ERROR_INJECTED_NOT_INIT                     ,                           // ADC 注入组未初始化 操作无法进行
+    ADC_ERROR_INTERRUPT_CALLBACK_ILLEGAL            ,                           // ADC 中断回调非法 操作无法进行
 }zf_adc_operation_state_enum;
 
+#define     ADC_INJECTED_NUM_MAX    (  4     )                                  // 注入组最多 ADC_INJECTED_NUM_MAX 个通道
+
+typedef enum                                                                    // 枚举 ADC 外部触发边沿  此枚举定义不允许用户修改
+{
+    ADC_TRIGGER_EDGE_RISING     = 1 ,                                           // 上升沿触发
+    ADC_TRIGGER_EDGE_FALLING        ,                                           // 下降沿触发
+    ADC_TRIGGER_EDGE_BOTH           ,                                           // 双边沿触发
+}zf_adc_trigger_edge_enum;
+
 typedef struct                                                                  // ADC 管理对象模板 用于存储 ADC 的信息
 {
     // 配置信息包括 通道状态 精度选择 使能 初始化信息等
@@ -269,6 +286,17 @@ uint8 zf_adc_get_convert_data (zf_adc_channel_enum channel, uint16 *data);
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_adc_get_convert_average_data (zf_adc_channel_enum channel, const uint8 count, uint16 *data);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 获取注入组转换数据
+// 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
+// 参数说明     rank                注入组序号 0 - 3 对应 zf_adc_injected_trigger_init 中 channel_list 的顺序
+// 参数说明     *data               ADC 转换存储地址指针 uint16 * 类型
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ADC_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_adc_get_injected_data(adc_index, 0, data);
+// 备注信息     只读取数据寄存器 不会启动转换 一般在注入组转换完成回调中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_adc_get_injected_data (zf_adc_index_enum adc_index, uint8 rank, uint16 *data);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     ADC 通道使能
 // 参数说明     zf_adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
@@ -315,6 +343,31 @@ uint8 zf_adc_channel_deinit (zf_adc_channel_enum channel);
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_adc_module_deinit (zf_adc_index_enum zf_adc_index);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 注入组外部触发注销初始化
+// 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ADC_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_adc_injected_trigger_deinit(adc_index);
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_adc_injected_trigger_deinit (zf_adc_index_enum adc_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ADC 注入组外部触发初始化
+// 参数说明     adc_index           选择 ADC 模块   (详见 zf_driver_adc.h 中枚举 zf_adc_index_enum 定义)
+// 参数说明     *channel_list       注入组通道列表 按顺序转换 通道必须属于 adc_index 且已调用 zf_adc_channel_init
+// 参数说明     count               通道数量 1 - ADC_INJECTED_NUM_MAX
+// 参数说明     trigger_select      注入组外部触发源编号 (JEXTSEL 值 详见参考手册 ADC 外部触发映射表)
+// 参数说明     edge                触发边沿        (详见 zf_driver_adc.h 中枚举 zf_adc_trigger_edge_enum 定义)
+// 参数说明     callback            注入序列转换完成回调 第一个参数为 ADC 索引
+// 参数说明     *ptr                回调参数 用户自拟定的参数指针 不需要的话就传入 NULL
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ADC_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_adc_injected_trigger_init(ADC_1, list, 1, trigger_select, ADC_TRIGGER_EDGE_RISING, callback, NULL);
+// 备注信息     转换由硬件触发 结果保存在注入组数据寄存器中 CPU 只在整个序列完成后进一次中断
+//              不影响 zf_adc_get_convert_data 的规则组软件转换
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_adc_injected_trigger_init (zf_adc_index_enum adc_index, const zf_adc_channel_enum *channel_list, uint8 count, uint8 trigger_select, zf_adc_trigger_edge_enum edge, void_callback_uint32_ptr callback, void *ptr);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     ADC 通道初始化
 // 参数说明     channel             选择 ADC 通道   (详见 zf_driver_adc.h 中枚举 zf_adc_channel_enum 定义)
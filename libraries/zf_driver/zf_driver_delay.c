@@ -29,140 +29,122 @@
 * 店铺链接          https://www.seekfree.cn/
 ********************************************************************************************************************/
 
+// zf_common 层引用
+#include "zf_common_profile.h"
+
 // 自身头文件
 #include "zf_driver_delay.h"
 
+// 此处定义 本文件用使用的变量与对象等 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+static vuint32 delay_timestamp_period_count = 0;                                // TIM_TS 归零次数 每次对应 DELAY_TIMESTAMP_PERIOD_US
+
+static void zf_delay_timestamp_callback (tim_ts_driver_t *tdp);
+static void zf_delay_wait_us (uint64 time_us);
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
 // 此处定义 本文件的所有函数具体定义 这里不允许用户修改
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 //-------------------------------------------------------------------------------------------------------------------
-// 函数简介     DELAY 延时函数 ms 级别
-// 参数说明     time                需要延时的时间 ms 单位
+// 函数简介     TIM_TS 溢出中断回调
+// 参数说明     *tdp                SDK TIM_TS 驱动对象
 // 返回参数     void
-// 使用示例     zf_delay_ms(time);
-// 备注信息     本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
+// 使用示例     
+// 备注信息     由 SDK 的 IRQ_TIM_TS_HANDLER 清除溢出标志后调用 每次累加一次归零次数
 //-------------------------------------------------------------------------------------------------------------------
-ZF_WEAK void zf_delay_ms (uint32 time)
+static void zf_delay_timestamp_callback (tim_ts_driver_t *tdp)
 {
-    vuint32 ms_temp         = 0;
-
-    vuint32 us_temp1        = 0;
-    vuint32 us_temp2        = 0;
+    (void)tdp;
+    zf_profile_enter(PROFILE_TIM_TS);
+    delay_timestamp_period_count ++;
+    zf_profile_exit(PROFILE_TIM_TS);
+}
 
-    vuint32 counter_temp1   = 0;
-    vuint32 counter_temp2   = 0;
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取系统上电后的 64 位微秒时间戳
+// 参数说明     void
+// 返回参数     uint64              zf_delay_init 之后经过的时间 us 单位 单调递增
+// 使用示例     uint64 now_us = zf_time_now_us();
+// 备注信息     由 TIM_TS 计数值与溢出中断累计的归零次数拼接而成 可在任意中断或主循环中调用
+//              不关中断 读两次归零次数确认期间没有发生溢出
+//              溢出已发生但中断尚未响应时 (例如在关中断期间调用) 根据溢出标志补上这次归零
+//              因此只要关中断的时间不超过 DELAY_TIMESTAMP_PERIOD_US / 2 时间戳就不会倒退或丢失
+//-------------------------------------------------------------------------------------------------------------------
+uint64 zf_time_now_us (void)
+{
+    uint32 period_count     = 0;
+    uint32 counter          = 0;
+    uint32 overflow_pending = 0;
 
-    while(time)
+    do
     {
-        ms_temp = (time >= 10) ? (10) : (time);                                 // 延时以 10ms 为切片分段
-        time -= ms_temp;                                                        // 不足 10ms 就一次延时完成了 超过的就切片递减
+        period_count        = delay_timestamp_period_count;                     // 先读归零次数
+        counter             = DRV_TIM_TS.tim_ts->CNT;                           // 再读计数值
+        overflow_pending    = DRV_TIM_TS.tim_ts->SR & TIM_SR_UIF;               // 是否已经归零但中断还没有计入
+    }while(period_count != delay_timestamp_period_count);                       // 期间溢出中断执行过 两次读取不属于同一周期 重读
+
+    // 溢出标志置位而中断还没有执行 (在更高优先级中断或关中断期间调用)
+    // 计数值处于前半周期说明是归零之后读到的 需要补上这次归零
+    // 处于后半周期说明是归零之前读到的 标志是读完计数值之后才置位的
+    if(overflow_pending && DELAY_TIMESTAMP_PERIOD_US / 2 > counter)
+    {
+        period_count ++;
+    }
 
-        do                                                                      // 通过两个 volatile 的变量来确保寄存器数值读取正确
-        {                                                                       // 一般情况下这两句执行时间会非常短 他们的数值应当是一致的
-            counter_temp1 = DRV_TIM_TS.tim_ts->CNT;                             // volatile 变量读取寄存器数值
-            counter_temp2 = DRV_TIM_TS.tim_ts->CNT;                             // volatile 变量读取寄存器数值
-        }while(counter_temp1 != counter_temp2);                                 // 但不排除遇到计数器重置 或者中断打断操作
+    return (uint64)period_count * DELAY_TIMESTAMP_PERIOD_US + counter;
+}
 
-        us_temp1 = counter_temp1 + ms_temp * 1000;                              // 计算延时后的时间戳
-        us_temp2 = us_temp1 % 50000;                                            // 计算延时后计数范围内的时间戳
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     按 TIM_TS 计数值累计经过的时间 直到达到指定时长
+// 参数说明     time_us             需要等待的时间 us 单位
+// 返回参数     void
+// 使用示例     zf_delay_wait_us(1000);
+// 备注信息     内部使用 不依赖溢出中断累计的归零次数
+//              关中断期间或在优先级不低于 TIM_TS 的中断中调用时 溢出中断无法执行 zf_time_now_us 在一个周期后停止前进
+//              这里只比较相邻两次读到的计数值 读数变小即为经过了一次归零 轮询间隔远小于一个周期 任意时长都能正确结束
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_delay_wait_us (uint64 time_us)
+{
+    uint32 last_counter = DRV_TIM_TS.tim_ts->CNT;
+    uint64 elapsed_us   = 0;
 
-        for(;;)
+    while(time_us > elapsed_us)
+    {
+        uint32 counter = DRV_TIM_TS.tim_ts->CNT;
+        if(counter < last_counter)
         {
-            do                                                                  // 通过两个 volatile 的变量来确保寄存器数值读取正确
-            {                                                                   // 一般情况下这两句执行时间会非常短 他们的数值应当是一致的
-                counter_temp1 = DRV_TIM_TS.tim_ts->CNT;                         // volatile 变量读取寄存器数值
-                counter_temp2 = DRV_TIM_TS.tim_ts->CNT;                         // volatile 变量读取寄存器数值
-            }while(counter_temp1 != counter_temp2);                             // 但不排除遇到计数器重置 或者中断打断操作
-
-            if(us_temp1 >= 50000)                                               // 判断是否超出范围
-            {                                                                   // 超出计数值周期 就等下一个周期
-                if(counter_temp1 < 50000 / 2 && counter_temp1 > us_temp2)       // 等到下个周期前半周再判断是否满足延时退出
-                {
-                    break;
-                }
-            }
-            else
-            {
-                if(50000 - us_temp2 <= 100)
-                {
-                    if(counter_temp1 < 50000 / 2)
-                    {
-                        break;
-                    }
-                }
-                else
-                {
-                    if(counter_temp1 > us_temp2)
-                    {
-                        break;
-                    }
-                }
-            }
+            elapsed_us += DELAY_TIMESTAMP_PERIOD_US;                            // 计数归零
         }
+        elapsed_us  += counter;
+        elapsed_us  -= last_counter;
+        last_counter = counter;
     }
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     DELAY 延时函数 ms 级别
+// 参数说明     time                需要延时的时间 ms 单位
+// 返回参数     void
+// 使用示例     zf_delay_ms(time);
+// 备注信息     基于 TIM_TS 计数值实现 关中断期间同样可用
+//              本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
+//-------------------------------------------------------------------------------------------------------------------
+ZF_WEAK void zf_delay_ms (uint32 time)
+{
+    zf_delay_wait_us((uint64)time * 1000);
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     DELAY 延时函数 us 级别
-// 参数说明     time                需要延时的时间 us 单位 范围 1-10000
+// 参数说明     time                需要延时的时间 us 单位
 // 返回参数     void
 // 使用示例     zf_delay_us(time);
-// 备注信息     受限于程序运行跳转 此延时会比输入值高出一些
+// 备注信息     基于 TIM_TS 计数值实现 关中断期间同样可用 受限于程序运行跳转 此延时会比输入值高出一些
 //              本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
 //-------------------------------------------------------------------------------------------------------------------
 ZF_WEAK void zf_delay_us (uint32 time)
 {
-    vuint32 us_temp         = 0;
-
-    vuint32 us_temp1        = 0;
-    vuint32 us_temp2        = 0;
-
-    vuint32 counter_temp1   = 0;
-    vuint32 counter_temp2   = 0;
-
-    us_temp = (10000 <= time) ? (10000) : (time);                               // 限制最长的延时为 10000us 也就是 10ms 超过这个值就该用毫秒延时
-
-    do                                                                          // 通过两个 volatile 的变量来确保寄存器数值读取正确
-    {                                                                           // 一般情况下这两句执行时间会非常短 他们的数值应当是一致的
-        counter_temp1 = DRV_TIM_TS.tim_ts->CNT;                                 // volatile 变量读取寄存器数值
-        counter_temp2 = DRV_TIM_TS.tim_ts->CNT;                                 // volatile 变量读取寄存器数值
-    }while(counter_temp1 != counter_temp2);                                     // 但不排除遇到计数器重置 或者中断打断操作
-
-    us_temp1 = counter_temp1 + us_temp;                                         // 计算延时后的时间戳
-    us_temp2 = us_temp1 % 50000;                                                // 计算延时后计数范围内的时间戳
-
-    for(;;)
-    {
-        do                                                                      // 通过两个 volatile 的变量来确保寄存器数值读取正确
-        {                                                                       // 一般情况下这两句执行时间会非常短 他们的数值应当是一致的
-            counter_temp1 = DRV_TIM_TS.tim_ts->CNT;                             // volatile 变量读取寄存器数值
-            counter_temp2 = DRV_TIM_TS.tim_ts->CNT;                             // volatile 变量读取寄存器数值
-        }while(counter_temp1 != counter_temp2);                                 // 但不排除遇到计数器重置 或者中断打断操作
-
-        if(us_temp1 >= 50000)                                                   // 判断是否超出范围
-        {                                                                       // 超出计数值周期 就等下一个周期
-            if(counter_temp1 < 50000 / 2 && counter_temp1 > us_temp2)           // 等到下个周期前半周再判断是否满足延时退出
-            {
-                break;
-            }
-        }
-        else
-        {
-            if(50000 - us_temp2 <= 100)
-            {
-                if(counter_temp1 < 50000 / 2)
-                {
-                    break;
-                }
-            }
-            else
-            {
-                if(counter_temp1 > us_temp2)
-                {
-                    break;
-                }
-            }
-        }
-    }
+    zf_delay_wait_us(time);
 }
 
 //-------------------------------------------------------------------------------------------------------------------
@@ -171,12 +153,13 @@ ZF_WEAK void zf_delay_us (uint32 time)
 // 返回参数     void
 // 使用示例     zf_delay_init();
 // 备注信息     本函数由 system_clock_init 内部调用 用户不需要关心 也不需要调用
+//              同时开启 TIM_TS 溢出中断 时间戳从 0 开始
 //              本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
 //-------------------------------------------------------------------------------------------------------------------
 ZF_WEAK void zf_delay_init (void)
 {
     uint16 freq_div     = (150 - 1);                                            // 预分频 1MHz 计数
-    uint16 period_temp  = (50000 - 1);                                          // 自动重装载值 50ms
+    uint16 period_temp  = (DELAY_TIMESTAMP_PERIOD_US - 1);                      // 自动重装载值 50ms
 
     tim_ts_init(&DRV_TIM_TS);                                                   // 初始化 TS 实例参数
 
@@ -189,6 +172,15 @@ ZF_WEAK void zf_delay_init (void)
     tim_ts_set_master_mode_selection(&DRV_TIM_TS, TIM_TS_MMS_UPDATE);           // 配置模式
     tim_ts_set_prescaler(&DRV_TIM_TS, freq_div);                                // 设置分频
     tim_ts_set_autoreload(&DRV_TIM_TS, period_temp);                            // 设置周期计数值
-    tim_ts_start(&DRV_TIM_TS);                                                  // 启动模块
+    tim_ts_set_cb(&DRV_TIM_TS, zf_delay_timestamp_callback);                    // 设置溢出回调 SDK 中断服务函数会调用
+    tim_ts_start(&DRV_TIM_TS);                                                  // 启动模块 启动时的更新事件会将计数清零
+
+    // 溢出中断在启动之后再开启
+    // 启动时软件触发的更新事件同样会置位溢出标志 不能把它算作一次归零
+    delay_timestamp_period_count = 0;
+    DRV_TIM_TS.tim_ts->SR  &= ~TIM_SR_UIF;
+    DRV_TIM_TS.tim_ts->DIER |= TIM_DIER_UIE;
+    zf_interrupt_set_priority(INTERRUPT_INDEX_TIM_TS, DELAY_TIMESTAMP_PRIORITY);
+    zf_interrupt_enable(INTERRUPT_INDEX_TIM_TS);
 }
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -39,32 +39,56 @@
 // zf_common 层引用
 #include "zf_common_typedef.h"
 
+// zf_driver 层引用
+#include "zf_driver_interrupt.h"
+
 // 此处列举 当前支持的函数列表
 // 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+// zf_time_now_us                                                               // 获取系统上电后的 64 位微秒时间戳
+
 // zf_delay_ms                                                                  // 系统毫秒级延时
 // zf_delay_us                                                                  // 系统微秒级延时
 
 // zf_delay_init                                                                // 系统延时初始化
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
+// 此处定义 DELAY 相关的结构体数据构成细节 这里不允许用户修改
+// >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+#define DELAY_TIMESTAMP_PERIOD_US       ( 50000 )                               // 时间戳定时器 TIM_TS 1MHz 计数 每 50ms 归零 溢出中断累计归零次数
+#define DELAY_TIMESTAMP_PRIORITY        ( INTERRUPT_PRIORITY_HIGH )             // 溢出中断优先级 必须为最高 SDK 先清标志再回调计数 期间不能被读取时间戳的中断打断
+// <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
 // 此处列举 本文件的所有函数声明 [ 其中包括宏定义函数 ] 这里不允许用户修改
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     获取系统上电后的 64 位微秒时间戳
+// 参数说明     void
+// 返回参数     uint64              zf_delay_init 之后经过的时间 us 单位 单调递增
+// 使用示例     uint64 now_us = zf_time_now_us();
+// 备注信息     由 TIM_TS 计数值与溢出中断累计的归零次数拼接而成 可在任意中断或主循环中调用
+//              不关中断 读两次归零次数确认期间没有发生溢出
+//              溢出已发生但中断尚未响应时 (例如在关中断期间调用) 根据溢出标志补上这次归零
+//              因此只要关中断的时间不超过 DELAY_TIMESTAMP_PERIOD_US / 2 时间戳就不会倒退或丢失
+//-------------------------------------------------------------------------------------------------------------------
+uint64 zf_time_now_us (void);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     DELAY 延时函数 ms 级别
 // 参数说明     time                需要延时的时间 ms 单位
 // 返回参数     void
 // 使用示例     zf_delay_ms(time);
-// 备注信息     本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
+// 备注信息     基于 TIM_TS 计数值实现 不依赖溢出中断 关中断期间同样可用
+//              本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
 //-------------------------------------------------------------------------------------------------------------------
 void zf_delay_ms (uint32 time);
 
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     DELAY 延时函数 us 级别
-// 参数说明     time                需要延时的时间 us 单位 范围 1-10000
+// 参数说明     time                需要延时的时间 us 单位
 // 返回参数     void
 // 使用示例     zf_delay_us(time);
-// 备注信息     受限于程序运行跳转 此延时会比输入值高出一些
+// 备注信息     基于 TIM_TS 计数值实现 不依赖溢出中断 关中断期间同样可用 受限于程序运行跳转 此延时会比输入值高出一些
 //              本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
 //-------------------------------------------------------------------------------------------------------------------
 void zf_delay_us (uint32 time);
@@ -75,6 +99,7 @@ void zf_delay_us (uint32 time);
 // 返回参数     void
 // 使用示例     zf_delay_init();
 // 备注信息     本函数由 system_clock_init 内部调用 用户不需要关心 也不需要调用
+//              同时开启 TIM_TS 溢出中断 时间戳从 0 开始
 //              本函数使用弱定义 这样做的目的是在移植操作系统时可以重载此函数
 //-------------------------------------------------------------------------------------------------------------------
 void zf_delay_init (void);
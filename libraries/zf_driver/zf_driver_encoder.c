@@ -140,6 +140,42 @@ uint8 zf_encoder_clear_count (zf_encoder_index_enum encoder_index)
     return return_state;
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ENCODER 获取硬件计数器原始值
+// 参数说明     encoder_index       ENCODER 模块号  (详见 zf_driver_encoder.h 内 zf_encoder_index_enum 定义)
+// 参数说明     *data               数据读取地址 uint16 * 类型指针
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_encoder_get_raw_count(encoder_index, data);
+// 备注信息     直接返回 CNT 不做 /4 归一化 也不清零 计数器在 0x0000-0xFFFF 之间自由回绕
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_encoder_get_raw_count (zf_encoder_index_enum encoder_index, uint16 *data)
+{
+    zf_encoder_operation_state_enum return_state = ENCODER_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_encoder_assert(encoder_obj_list[encoder_index].mode))             // 检查 模块初始化
+        {
+            // 此处如果断言报错 那么证明本模块没有初始化过 是不允许直接操作的
+            return_state = ENCODER_ERROR_MODULE_NOT_INIT;                       // ENCODER 模块未初始化 操作无法进行
+            break;
+        }
+        if(zf_encoder_assert(NULL != data))                                     // 检查 数据存储地址
+        {
+            // 此处如果断言报错 那么证明传入数据指针为 NULL 空指针
+            return_state = ENCODER_ERROR_DATA_BUFFER_NULL;                      // ENCODER 数据指针异常 操作无法进行
+            break;
+        }
+
+        // ARR 在初始化时固定为 0xFFFF 因此只取低 16 位 回绕由调用者做差处理
+        *data = (uint16)encoder_obj_list[encoder_index].timer_obj->tim_ptr->CNT;
+
+        return_state = ZF_NO_ERROR;
+    }while(0);
+
+    return return_state;
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     ENCODER 接口注销初始化
 // 参数说明     encoder_index       ENCODER 模块号  (详见 zf_driver_encoder.h 内 zf_encoder_index_enum 定义)
@@ -47,6 +47,7 @@
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 // zf_encoder_get_count                                                         // ENCODER 接口获取编码器计数
 // zf_encoder_clear_count                                                       // ENCODER 清空编码器计数
+// zf_encoder_get_raw_count                                                     // ENCODER 获取硬件计数器原始值 不清零 自由运行
 
 // zf_encoder_deinit                                                            // ENCODER 接口注销初始化
 // zf_encoder_init                                                              // ENCODER 接口初始化 带方向编码器使用
@@ -199,6 +200,18 @@ uint8 zf_encoder_get_count (zf_encoder_index_enum encoder_index, int16 *data);
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_encoder_clear_count (zf_encoder_index_enum encoder_index);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     ENCODER 获取硬件计数器原始值
+// 参数说明     encoder_index       ENCODER 模块号  (详见 zf_driver_encoder.h 内 zf_encoder_index_enum 定义)
+// 参数说明     *data               数据读取地址 uint16 * 类型指针
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_encoder_get_raw_count(encoder_index, data);
+// 备注信息     直接返回 CNT 不做 /4 归一化 也不清零 计数器在 0x0000-0xFFFF 之间自由回绕
+//              调用者用两次读数之差 (int16)(now - last) 得到增量 只要两次读取之间不超过 32767 个边沿就不会丢计数
+//              仅正交模式下 CNT 带方向 方向编码器模式下 CNT 只增不减 需要调用者自行结合方向引脚处理
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_encoder_get_raw_count (zf_encoder_index_enum encoder_index, uint16 *data);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     ENCODER 接口注销初始化
 // 参数说明     encoder_index       ENCODER 模块号  (详见 zf_driver_encoder.h 内 zf_encoder_index_enum 定义)
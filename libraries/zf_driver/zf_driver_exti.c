@@ -31,6 +31,7 @@
 
 // zf_common 层引用
 #include "zf_common_debug.h"
+#include "zf_common_profile.h"
 #include "zf_common_memory.h"
 
 // zf_driver 层引用
@@ -119,6 +120,7 @@ static void zf_exti_callbakc_defalut (uint32 event, void *ptr)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_EXTI0_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_EXTI0);
     #define TEMP_EXTI_INDEX     ( EXTI1_CH0_A0 )
     exti_obj_list[EXTI_CALC_INDEX].exti_ptr->C1PR1 |= (0x00000001 << EXTI_CALC_CHANNEL);
     if(PIN_NULL != exti_obj_list[EXTI_CALC_INDEX].pin_list[EXTI_CALC_CHANNEL])
@@ -139,6 +141,7 @@ void IRQ_EXTI0_HANDLER (void)
         IRQ_EPILOGUE();
     }
     #undef  TEMP_EXTI_INDEX
+    zf_profile_exit(PROFILE_EXTI0);
     ZF_DSB();
 }
 
@@ -152,6 +155,7 @@ void IRQ_EXTI0_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_EXTI1_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_EXTI1);
     #define TEMP_EXTI_INDEX     ( EXTI1_CH1_A1 )
     exti_obj_list[EXTI_CALC_INDEX].exti_ptr->C1PR1 |= (0x00000001 << EXTI_CALC_CHANNEL);
     if(PIN_NULL != exti_obj_list[EXTI_CALC_INDEX].pin_list[EXTI_CALC_CHANNEL])
@@ -172,6 +176,7 @@ void IRQ_EXTI1_HANDLER (void)
         IRQ_EPILOGUE();
     }
     #undef  TEMP_EXTI_INDEX
+    zf_profile_exit(PROFILE_EXTI1);
     ZF_DSB();
 }
 
@@ -185,6 +190,7 @@ void IRQ_EXTI1_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_EXTI2_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_EXTI2);
     #define TEMP_EXTI_INDEX     ( EXTI1_CH2_A2 )
     exti_obj_list[EXTI_CALC_INDEX].exti_ptr->C1PR1 |= (0x00000001 << EXTI_CALC_CHANNEL);
     if(PIN_NULL != exti_obj_list[EXTI_CALC_INDEX].pin_list[EXTI_CALC_CHANNEL])
@@ -205,6 +211,7 @@ void IRQ_EXTI2_HANDLER (void)
         IRQ_EPILOGUE();
     }
     #undef  TEMP_EXTI_INDEX
+    zf_profile_exit(PROFILE_EXTI2);
     ZF_DSB();
 }
 
@@ -218,6 +225,7 @@ void IRQ_EXTI2_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_EXTI3_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_EXTI3);
     #define TEMP_EXTI_INDEX     ( EXTI1_CH3_A3 )
     exti_obj_list[EXTI_CALC_INDEX].exti_ptr->C1PR1 |= (0x00000001 << EXTI_CALC_CHANNEL);
     if(PIN_NULL != exti_obj_list[EXTI_CALC_INDEX].pin_list[EXTI_CALC_CHANNEL])
@@ -238,6 +246,7 @@ void IRQ_EXTI3_HANDLER (void)
         IRQ_EPILOGUE();
     }
     #undef  TEMP_EXTI_INDEX
+    zf_profile_exit(PROFILE_EXTI3);
     ZF_DSB();
 }
 
@@ -251,6 +260,7 @@ void IRQ_EXTI3_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_EXTI4_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_EXTI4);
     #define TEMP_EXTI_INDEX     ( EXTI1_CH4_A4 )
     exti_obj_list[EXTI_CALC_INDEX].exti_ptr->C1PR1 |= (0x00000001 << EXTI_CALC_CHANNEL);
     if(PIN_NULL != exti_obj_list[EXTI_CALC_INDEX].pin_list[EXTI_CALC_CHANNEL])
@@ -271,6 +281,7 @@ void IRQ_EXTI4_HANDLER (void)
         IRQ_EPILOGUE();
     }
     #undef  TEMP_EXTI_INDEX
+    zf_profile_exit(PROFILE_EXTI4);
     ZF_DSB();
 }
 
@@ -284,6 +295,7 @@ void IRQ_EXTI4_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_EXTI9_5_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_EXTI9_5);
     if(EXTI->C1PR1 & (0x00000001 << 5))
     {
         #define TEMP_EXTI_INDEX     ( EXTI1_CH5_A5 )
@@ -404,6 +416,7 @@ void IRQ_EXTI9_5_HANDLER (void)
         #undef  TEMP_EXTI_INDEX
         ZF_DSB();
     }
+    zf_profile_exit(PROFILE_EXTI9_5);
     ZF_DSB();
 }
 
@@ -417,6 +430,7 @@ void IRQ_EXTI9_5_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_EXTI15_10_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_EXTI15_10);
     if(EXTI->C1PR1 & (0x00000001 << 10))
     {
         #define TEMP_EXTI_INDEX     ( EXTI1_CH10_A10 )
@@ -561,6 +575,7 @@ void IRQ_EXTI15_10_HANDLER (void)
         #undef  TEMP_EXTI_INDEX
         ZF_DSB();
     }
+    zf_profile_exit(PROFILE_EXTI15_10);
     ZF_DSB();
 }
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
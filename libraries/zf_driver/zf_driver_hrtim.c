@@ -164,6 +164,154 @@ uint8 zf_hrtim_set_duty (zf_hrtim_pwm_positive_channel_enum pin, const uint32 du
     return return_state;
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM 以计数值直接更新比较匹配
+// 参数说明     pin                 选择 HRTIM PWM 引脚 (详见 zf_driver_hrtim.h 内 zf_hrtim_pwm_positive_channel_enum 定义)
+// 参数说明     half_width          中心对齐的半脉宽计数值 范围 0 - period / 2 超出按 period / 2 处理
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_hrtim_set_compare(pin, half_width);
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_hrtim_set_compare (zf_hrtim_pwm_positive_channel_enum pin, uint32 half_width)
+{
+    zf_hrtim_operation_state_enum return_state = HRTIM_ERROR_UNKNOW;
+
+    do
+    {
+        zf_hrtim_index_enum             hrtim_index     = (zf_hrtim_index_enum)((pin >> HRTIM_PWM_INDEX_OFFSET) & HRTIM_PWM_INDEX_MASK);
+        zf_hrtim_pwm_channel_index_enum channel_index   = (zf_hrtim_pwm_channel_index_enum)((pin >> HRTIM_PWM_CHANNEL_OFFSET) & HRTIM_PWM_CHANNEL_MASK);
+
+        if(zf_hrtim_assert(hrtim_obj_list[hrtim_index].freq))
+        {
+            // 此处如果断言报错 那么证明本模块没有初始化过 是不允许直接操作的
+            return_state = HRTIM_ERROR_MODULE_NOT_INIT;
+            break;
+        }
+        if(zf_hrtim_assert(PIN_NULL != hrtim_obj_list[hrtim_index].pin_list[channel_index]))
+        {
+            // 此处如果断言报错 那么证明引脚所在通道没有初始化
+            return_state = HRTIM_ERROR_CHANNEL_NOT_INIT;
+            break;
+        }
+
+        // 与 zf_hrtim_set_duty 相同的中心对齐方式 CMP1 匹配拉高 CMP2 匹配拉低
+        uint16 half_period = hrtim_obj_list[hrtim_index].period / 2;
+        if(half_width >= half_period)
+        {
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[channel_index % 6].CMP1xR = half_period;
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[channel_index % 6].CMP2xR = 0;
+        }
+        else if(0 == half_width)
+        {
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[channel_index % 6].CMP1xR = hrtim_obj_list[hrtim_index].period;
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[channel_index % 6].CMP2xR = half_period;
+        }
+        else
+        {
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[channel_index % 6].CMP1xR = (half_period - half_width);
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[channel_index % 6].CMP2xR = (half_period + half_width);
+        }
+
+        return_state = HRTIM_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM 获取周期计数值
+// 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
+// 返回参数     uint32              周期计数值 模块未初始化时返回 0
+// 使用示例     zf_hrtim_get_period(hrtim_index);
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_hrtim_get_period (zf_hrtim_index_enum hrtim_index)
+{
+    return hrtim_obj_list[hrtim_index].freq ? hrtim_obj_list[hrtim_index].period : 0;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM 锁定/释放预装载更新
+// 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
+// 参数说明     lock                1 - 锁定 期间写入的比较值只进入预装载寄存器  0 - 释放 在各子定时器下一次回零时一起生效
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_hrtim_set_update_lock(HRTIM_1, 1);
+// 备注信息     用于一次更新多个通道 锁定时间不能超过一个 PWM 周期太多 否则输出会停留在旧占空比
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_hrtim_set_update_lock (zf_hrtim_index_enum hrtim_index, uint8 lock)
+{
+    zf_hrtim_operation_state_enum return_state = HRTIM_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_hrtim_assert(hrtim_obj_list[hrtim_index].freq))
+        {
+            // 此处如果断言报错 那么证明本模块没有初始化过 是不允许直接操作的
+            return_state = HRTIM_ERROR_MODULE_NOT_INIT;
+            break;
+        }
+
+        // CR1 bit[6:1] 为子定时器 A - F 的更新禁止位 主定时器不使用预装载 不需要锁定
+        if(lock)
+        {
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sCommonRegs.CR1 |= 0x0000007E;
+        }
+        else
+        {
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sCommonRegs.CR1 &= ~0x0000007E;
+        }
+
+        return_state = HRTIM_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM ADC 触发输出初始化
+// 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
+// 参数说明     trigger             选择 ADC 触发输出   (详见 zf_driver_hrtim.h 内 zf_hrtim_adc_trigger_enum 定义)
+// 参数说明     compare             主定时器比较值 触发点 范围 1 - period - 1
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_hrtim_adc_trigger_init(HRTIM_1, HRTIM_ADC_TRIGGER_1, zf_hrtim_get_period(HRTIM_1) / 2);
+// 备注信息     使用主定时器比较 1 作为触发事件 主定时器与各子定时器同时启动且周期相同
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_hrtim_adc_trigger_init (zf_hrtim_index_enum hrtim_index, zf_hrtim_adc_trigger_enum trigger, uint32 compare)
+{
+    zf_hrtim_operation_state_enum return_state = HRTIM_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_hrtim_assert(hrtim_obj_list[hrtim_index].freq))
+        {
+            // 此处如果断言报错 那么证明本模块没有初始化过 是不允许直接操作的
+            return_state = HRTIM_ERROR_MODULE_NOT_INIT;
+            break;
+        }
+        if(zf_hrtim_assert(0 < compare && hrtim_obj_list[hrtim_index].period > compare))
+        {
+            // 此处如果断言报错 那么证明触发点不在计数周期内 永远不会触发
+            return_state = HRTIM_ERROR_DUTY_ILLEGAL;
+            break;
+        }
+
+        hrtim_obj_list[hrtim_index].hrtimer_obj->sMasterRegs.MCMP1R = compare;
+
+        // ADCxR bit0 为 主定时器比较 1 事件 其余事件源全部屏蔽
+        switch(trigger)
+        {
+            case HRTIM_ADC_TRIGGER_1:   hrtim_obj_list[hrtim_index].hrtimer_obj->sCommonRegs.ADC1R = 0x00000001;   break;
+            case HRTIM_ADC_TRIGGER_2:   hrtim_obj_list[hrtim_index].hrtimer_obj->sCommonRegs.ADC2R = 0x00000001;   break;
+            case HRTIM_ADC_TRIGGER_3:   hrtim_obj_list[hrtim_index].hrtimer_obj->sCommonRegs.ADC3R = 0x00000001;   break;
+            case HRTIM_ADC_TRIGGER_4:   hrtim_obj_list[hrtim_index].hrtimer_obj->sCommonRegs.ADC4R = 0x00000001;   break;
+        }
+
+        return_state = HRTIM_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     HRTIM 模块设置频率
 // 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
@@ -225,7 +373,9 @@ uint8 zf_hrtim_set_freq (zf_hrtim_index_enum hrtim_index, const uint32 freq)
         register_temp = freq_div | 0x00000008;
         for(uint8 i = 0; i < 6; i ++)
         {
-            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[i].TIMxCR = register_temp;
+            // 子定时器开启比较预装载 (PREEN) 并在计数回零时更新 (TxRSTU)
+            // 避免 CMP1/CMP2 在周期中途被分别改写产生毛刺
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[i].TIMxCR = register_temp | HRTIM_TIMER_PRELOAD_CONFIG;
         }
         hrtim_obj_list[hrtim_index].hrtimer_obj->sMasterRegs.MCR = register_temp | 0x007F0000;
 
@@ -653,7 +803,9 @@ uint8 zf_hrtim_module_init (zf_hrtim_index_enum hrtim_index, const uint32 freq)
         register_temp = freq_div | 0x00000008;
         for(uint8 i = 0; i < 6; i ++)
         {
-            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[i].TIMxCR = register_temp;
+            // 子定时器开启比较预装载 (PREEN) 并在计数回零时更新 (TxRSTU)
+            // 避免 CMP1/CMP2 在周期中途被分别改写产生毛刺
+            hrtim_obj_list[hrtim_index].hrtimer_obj->sTimerxRegs[i].TIMxCR = register_temp | HRTIM_TIMER_PRELOAD_CONFIG;
         }
         hrtim_obj_list[hrtim_index].hrtimer_obj->sMasterRegs.MCR = register_temp | 0x007F0000;
 
@@ -45,6 +45,10 @@
 // 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 // zf_hrtim_set_duty                                                            // HRTIM PWM 更新占空比
+// zf_hrtim_set_compare                                                         // HRTIM PWM 以计数值直接更新比较匹配 全分辨率
+// zf_hrtim_get_period                                                          // HRTIM PWM 获取周期计数值
+// zf_hrtim_set_update_lock                                                     // HRTIM PWM 锁定/释放预装载更新 多通道同步生效
+// zf_hrtim_adc_trigger_init                                                    // HRTIM ADC 触发输出初始化 在 PWM 中心触发
 // zf_hrtim_set_freq                                                            // HRTIM PWM 模块设置频率
 
 // zf_hrtim_set_interrupt_callback                                              // HRTIM PIT 中断设置回调函数
@@ -62,6 +66,7 @@
 // 此处定义 PWM 相关的结构体数据构成细节 这里不允许用户修改
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 #define     HRTIM_DUTY_MAX              ( 10000 )                               // 定义 HRTIM 占空比最大值
+#define     HRTIM_TIMER_PRELOAD_CONFIG  ( 0x08040000 )                          // 子定时器 TIMxCR PREEN(bit27) | TxRSTU(bit18)
 
 #define     HRTIM_NUM_MAX               ( 2     )                               // 总共最多 HRTIM_NUM_MAX 个 HRTIM
 
@@ -175,6 +180,11 @@ typedef enum
     HRTIM_ERROR_DEPENDS_TIMER_OCCUPIED                  ,                       // HRTIM 定时器被占用 操作无法进行
 }zf_hrtim_operation_state_enum;
 
+typedef enum                                                                    // 枚举 HRTIM ADC 触发输出  此枚举定义不允许用户修改
+{
+    HRTIM_ADC_TRIGGER_1 ,   HRTIM_ADC_TRIGGER_2 ,   HRTIM_ADC_TRIGGER_3 ,   HRTIM_ADC_TRIGGER_4 ,
+}zf_hrtim_adc_trigger_enum;
+
 typedef struct                                                                  // HRTIM 管理对象模板 用于存储 PWM 的信息
 {
     // 此处的结构固定为 引脚列表在前 配置信息在后
@@ -233,6 +243,48 @@ uint8 zf_hrtim_assert_handler (char *file, int line, char *tips);
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_hrtim_set_duty (zf_hrtim_pwm_positive_channel_enum pin, const uint32 duty);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM 以计数值直接更新比较匹配
+// 参数说明     pin                 选择 HRTIM PWM 引脚 (详见 zf_driver_hrtim.h 内 zf_hrtim_pwm_positive_channel_enum 定义)
+// 参数说明     half_width          中心对齐的半脉宽计数值 范围 0 - period / 2 超出按 period / 2 处理
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_hrtim_set_compare(pin, half_width);
+// 备注信息     不经过 HRTIM_DUTY_MAX 万分比换算 也不做 2% / 98% 截断 分辨率为一个 HRTIM 计数
+//              0 为全关 period / 2 为全开 最小脉宽限制由调用者负责
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_hrtim_set_compare (zf_hrtim_pwm_positive_channel_enum pin, uint32 half_width);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM 获取周期计数值
+// 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
+// 返回参数     uint32              周期计数值 模块未初始化时返回 0
+// 使用示例     zf_hrtim_get_period(hrtim_index);
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_hrtim_get_period (zf_hrtim_index_enum hrtim_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM 锁定/释放预装载更新
+// 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
+// 参数说明     lock                1 - 锁定 期间写入的比较值只进入预装载寄存器  0 - 释放 在各子定时器下一次回零时一起生效
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_hrtim_set_update_lock(HRTIM_1, 1);
+// 备注信息     用于一次更新多个通道 锁定时间不能超过一个 PWM 周期太多 否则输出会停留在旧占空比
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_hrtim_set_update_lock (zf_hrtim_index_enum hrtim_index, uint8 lock);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     HRTIM ADC 触发输出初始化
+// 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
+// 参数说明     trigger             选择 ADC 触发输出   (详见 zf_driver_hrtim.h 内 zf_hrtim_adc_trigger_enum 定义)
+// 参数说明     compare             主定时器比较值 触发点 范围 1 - period - 1
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_hrtim_adc_trigger_init(HRTIM_1, HRTIM_ADC_TRIGGER_1, zf_hrtim_get_period(HRTIM_1) / 2);
+// 备注信息     使用主定时器比较 1 作为触发事件 主定时器与各子定时器同时启动且周期相同
+//              compare 取 period / 2 即为中心对齐 PWM 的脉冲中点 此时采样到的是电流平均值 且远离开关噪声
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_hrtim_adc_trigger_init (zf_hrtim_index_enum hrtim_index, zf_hrtim_adc_trigger_enum trigger, uint32 compare);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     HRTIM 模块设置频率
 // 参数说明     hrtim_index         选择 HRTIM 模块     (详见 zf_driver_hrtim.h 内 zf_hrtim_index_enum 定义)
@@ -159,6 +159,18 @@ void zf_interrupt_set_priority (zf_interrupt_index_enum irqn, zf_interrupt_prior
     NVIC_SetPriority((IRQn_Type)irqn, priority);
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     指定中断软件挂起
+// 参数说明     irqn                指定中断号  (详见 zf_driver_interrupt.h 内 zf_interrupt_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_interrupt_set_pending(irqn);
+// 备注信息     中断已使能时 按其优先级进入对应中断服务函数 可将空闲外设中断当作软件中断使用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_interrupt_set_pending (zf_interrupt_index_enum irqn)
+{
+    NVIC_SetPendingIRQ((IRQn_Type)irqn);
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     中断组初始化
 // 参数说明     void
@@ -52,6 +52,8 @@
 // zf_interrupt_get_priority                                                    // 指定中断获取优先级
 // zf_interrupt_set_priority                                                    // 指定中断设置优先级
 
+// zf_interrupt_set_pending                                                     // 指定中断软件挂起
+
 // zf_interrupt_init                                                            // 中断组初始化
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
@@ -257,6 +259,15 @@ uint32 zf_interrupt_get_priority (zf_interrupt_index_enum irqn);
 //-------------------------------------------------------------------------------------------------------------------
 void zf_interrupt_set_priority (zf_interrupt_index_enum irqn, zf_interrupt_priority_enum priority);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     指定中断软件挂起
+// 参数说明     irqn                指定中断号  (详见 zf_driver_interrupt.h 内 zf_interrupt_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_interrupt_set_pending(irqn);
+// 备注信息     中断已使能时 按其优先级进入对应中断服务函数 可将空闲外设中断当作软件中断使用
+//-------------------------------------------------------------------------------------------------------------------
+void zf_interrupt_set_pending (zf_interrupt_index_enum irqn);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     中断组初始化
 // 参数说明     void
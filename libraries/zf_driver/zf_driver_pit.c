@@ -31,6 +31,7 @@
 
 // zf_common 层引用
 #include "zf_common_debug.h"
+#include "zf_common_profile.h"
 #include "zf_common_memory.h"
 
 // zf_driver 层引用
@@ -94,6 +95,7 @@ AT_ZF_LIB_SECTION_END
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM1_UP_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM1);
     if(pit_obj_list[PIT_TIM1].period_system_cycles)
     {
         TIM1->SR &= ~TIM_SR_UIF;
@@ -105,6 +107,7 @@ void IRQ_TIM1_UP_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM1);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM1);
     ZF_DSB();
 }
 
@@ -118,6 +121,7 @@ void IRQ_TIM1_UP_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM8_UP_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM8);
     if(pit_obj_list[PIT_TIM8].period_system_cycles)
     {
         TIM8->SR &= ~TIM_SR_UIF;
@@ -129,6 +133,7 @@ void IRQ_TIM8_UP_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM8);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM8);
     ZF_DSB();
 }
 
@@ -142,6 +147,7 @@ void IRQ_TIM8_UP_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM2_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM2);
     if(pit_obj_list[PIT_TIM2].period_system_cycles)
     {
         TIM2->SR &= ~TIM_SR_UIF;
@@ -153,6 +159,7 @@ void IRQ_TIM2_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM2);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM2);
     ZF_DSB();
 }
 
@@ -166,6 +173,7 @@ void IRQ_TIM2_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM5_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM5);
     if(pit_obj_list[PIT_TIM5].period_system_cycles)
     {
         TIM5->SR &= ~TIM_SR_UIF;
@@ -177,6 +185,7 @@ void IRQ_TIM5_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM5);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM5);
     ZF_DSB();
 }
 
@@ -190,6 +199,7 @@ void IRQ_TIM5_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM3_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM3);
     if(pit_obj_list[PIT_TIM3].period_system_cycles)
     {
         TIM3->SR &= ~TIM_SR_UIF;
@@ -201,6 +211,7 @@ void IRQ_TIM3_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM3);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM3);
     ZF_DSB();
 }
 
@@ -214,6 +225,7 @@ void IRQ_TIM3_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM4_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM4);
     if(pit_obj_list[PIT_TIM4].period_system_cycles)
     {
         TIM4->SR &= ~TIM_SR_UIF;
@@ -225,6 +237,7 @@ void IRQ_TIM4_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM4);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM4);
     ZF_DSB();
 }
 
@@ -238,6 +251,7 @@ void IRQ_TIM4_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM15_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM15);
     if(pit_obj_list[PIT_TIM15].period_system_cycles)
     {
         TIM15->SR &= ~TIM_SR_UIF;
@@ -249,6 +263,7 @@ void IRQ_TIM15_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM15);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM15);
     ZF_DSB();
 }
 
@@ -262,6 +277,7 @@ void IRQ_TIM15_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM16_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM16);
     if(pit_obj_list[PIT_TIM16].period_system_cycles)
     {
         TIM16->SR &= ~TIM_SR_UIF;
@@ -273,6 +289,7 @@ void IRQ_TIM16_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM16);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM16);
     ZF_DSB();
 }
 
@@ -286,6 +303,7 @@ void IRQ_TIM16_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM6_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM6);
     if(pit_obj_list[PIT_TIM6].period_system_cycles)
     {
         TIM6->SR &= ~TIM_SR_UIF;
@@ -297,6 +315,7 @@ void IRQ_TIM6_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM6);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM6);
     ZF_DSB();
 }
 
@@ -310,6 +329,7 @@ void IRQ_TIM6_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_TIM7_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_PIT_TIM7);
     if(pit_obj_list[PIT_TIM7].period_system_cycles)
     {
         TIM7->SR &= ~TIM_SR_UIF;
@@ -321,6 +341,7 @@ void IRQ_TIM7_HANDLER (void)
         __tim_serve_interrupt(&DRV_TIM7);
         IRQ_EPILOGUE();
     }
+    zf_profile_exit(PROFILE_PIT_TIM7);
     ZF_DSB();
 }
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
@@ -451,6 +472,36 @@ uint8 zf_pit_disable (zf_pit_index_enum pit_index)
     return return_state;
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PIT 中断软件触发
+// 参数说明     pit_index           PIT 外设模块号 (详见 zf_driver_pit.h 内 zf_pit_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / PIT_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_pit_trigger(pit_index);
+// 备注信息     挂起对应定时器中断 立即按该 PIT 的中断优先级执行一次回调 不影响定时器计数
+//              配合 zf_pit_disable 停止计数后 该 PIT 即可作为指定优先级的软件中断使用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pit_trigger (zf_pit_index_enum pit_index)
+{
+    zf_pit_operation_state_enum return_state = PIT_OPERATION_DONE;
+
+    do
+    {
+        if(zf_pit_assert(pit_obj_list[pit_index].period_system_cycles))         // 检查 初始化
+        {
+            // 此处如果断言报错 那么证明本模块没有初始化过 是不允许直接操作的
+            // 未初始化时中断服务函数不会调用回调 挂起中断也没有意义
+            return_state = PIT_ERROR_MODULE_NOT_INIT;
+            break;
+        }
+
+        zf_interrupt_set_pending(pit_irq_index_list[pit_index]);
+
+        return_state = PIT_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     PIT 注销初始化
 // 参数说明     pit_index           PIT 外设模块号 (详见 zf_driver_pit.h 内 zf_pit_index_enum 定义)
@@ -49,6 +49,7 @@
 
 // zf_pit_enable                                                                // PIT 中断使能
 // zf_pit_disable                                                               // PIT 中断禁止
+// zf_pit_trigger                                                               // PIT 中断软件触发
 
 // zf_pit_deinit                                                                // PIT 注销初始化
 // zf_pit_init                                                                  // PIT 初始化 一般调用 pit_ms_init 或 pit_us_init
@@ -147,6 +148,16 @@ uint8 zf_pit_enable (zf_pit_index_enum pit_index);
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_pit_disable (zf_pit_index_enum pit_index);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PIT 中断软件触发
+// 参数说明     pit_index           PIT 外设模块号 (详见 zf_driver_pit.h 内 zf_pit_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / PIT_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_pit_trigger(pit_index);
+// 备注信息     挂起对应定时器中断 立即按该 PIT 的中断优先级执行一次回调 不影响定时器计数
+//              配合 zf_pit_disable 停止计数后 该 PIT 即可作为指定优先级的软件中断使用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pit_trigger (zf_pit_index_enum pit_index);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     PIT 注销初始化
 // 参数说明     pit_index           PIT 外设模块号 (详见 zf_driver_pit.h 内 zf_pit_index_enum 定义)
@@ -119,6 +119,121 @@ uint8 zf_pwm_set_duty (zf_pwm_positive_channel_enum pin, const uint32 duty)
     return return_state;
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 直接设置比较计数值
+// 参数说明     pin                 选择 PWM 引脚   (详见 zf_driver_pwm.h 内 zf_pwm_positive_channel_enum 定义)
+// 参数说明     compare             比较计数值 范围 0 - zf_pwm_get_period(pwm_index) + 1
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_pwm_set_compare(pin, compare);
+// 备注信息     不经过 PWM_DUTY_MAX 量化 分辨率为一个计数周期 (zf_pwm_get_count_freq 的倒数)
+//              边沿对齐时高电平宽度 = compare 个计数
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pwm_set_compare (zf_pwm_positive_channel_enum pin, const uint32 compare)
+{
+    zf_pwm_operation_state_enum return_state = PWM_ERROR_UNKNOW;
+
+    do
+    {
+        zf_pwm_index_enum           pwm_index       = (zf_pwm_index_enum)((pin >> PWM_INDEX_OFFSET) & PWM_INDEX_MASK);
+        zf_pwm_channel_index_enum   channel_index   = (zf_pwm_channel_index_enum)((pin >> PWM_CHANNEL_OFFSET) & PWM_CHANNEL_MASK);
+
+        if(zf_pwm_assert(PIN_NULL != pwm_obj_list[pwm_index].pin_list[channel_index]))
+        {
+            // 此处如果断言报错 那么证明本通道没有初始化过 是不允许直接操作的
+            return_state = PWM_ERROR_CHANNEL_NOT_INIT;                          // PWM 通道未初始化 操作无法进行
+            break;
+        }
+        if(zf_pwm_assert(pwm_obj_list[pwm_index].timer_obj->period + 1 >= compare))
+        {
+            // 此处如果断言报错 那么证明比较值超过了一个周期的计数
+            return_state = PWM_ERROR_DUTY_ILLEGAL;                              // PWM 占空比值异常 操作无法进行
+            break;
+        }
+
+        // 预装载已使能 新比较值在下一个更新事件生效 不会产生半个周期的毛刺
+        switch(channel_index)
+        {
+            case PWM_CH1:
+            case PWM_CH1N:  pwm_obj_list[pwm_index].timer_obj->tim_ptr->CCR1 = compare; break;
+            case PWM_CH2:
+            case PWM_CH2N:  pwm_obj_list[pwm_index].timer_obj->tim_ptr->CCR2 = compare; break;
+            case PWM_CH3:
+            case PWM_CH3N:  pwm_obj_list[pwm_index].timer_obj->tim_ptr->CCR3 = compare; break;
+            case PWM_CH4:
+            case PWM_CH4N:  pwm_obj_list[pwm_index].timer_obj->tim_ptr->CCR4 = compare; break;
+        }
+
+        return_state = PWM_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 获取周期计数值
+// 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
+// 返回参数     uint32              自动重装载值 模块未初始化时返回 0
+// 使用示例     zf_pwm_get_period(pwm_index);
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_pwm_get_period (zf_pwm_index_enum pwm_index)
+{
+    return pwm_obj_list[pwm_index].freq ? pwm_obj_list[pwm_index].timer_obj->period : 0;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 获取计数频率
+// 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
+// 返回参数     uint32              计数频率 Hz (输入时钟 / 预分频) 模块未初始化时返回 0
+// 使用示例     zf_pwm_get_count_freq(pwm_index);
+// 备注信息     用于把微秒等时间量换算为比较计数值
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_pwm_get_count_freq (zf_pwm_index_enum pwm_index)
+{
+    uint32 count_freq = 0;
+    if(pwm_obj_list[pwm_index].freq)
+    {
+        count_freq = pwm_obj_list[pwm_index].timer_obj->clock_input / pwm_obj_list[pwm_index].timer_obj->div;
+    }
+    return count_freq;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 锁定/释放预装载更新
+// 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
+// 参数说明     lock                1 - 锁定 期间写入的比较值只进入预装载寄存器  0 - 释放 在下一次更新事件一起生效
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_pwm_set_update_lock(PWM_TIM8, 1);
+// 备注信息     通过 CR1.UDIS 屏蔽更新事件 计数器照常运行 不影响输出波形
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pwm_set_update_lock (zf_pwm_index_enum pwm_index, uint8 lock)
+{
+    zf_pwm_operation_state_enum return_state = PWM_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_pwm_assert(pwm_obj_list[pwm_index].freq))
+        {
+            // 此处如果断言报错 那么证明本模块没有初始化过 是不允许直接操作的
+            return_state = PWM_ERROR_MODULE_NOT_INIT;                           // PWM 模块未初始化 操作无法进行
+            break;
+        }
+
+        if(lock)
+        {
+            pwm_obj_list[pwm_index].timer_obj->tim_ptr->CR1 |= TIM_CR1_UDIS;
+        }
+        else
+        {
+            pwm_obj_list[pwm_index].timer_obj->tim_ptr->CR1 &= ~TIM_CR1_UDIS;
+        }
+
+        return_state = PWM_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     PWM 模块设置频率
 // 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
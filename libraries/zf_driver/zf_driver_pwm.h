@@ -46,6 +46,10 @@
 // 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
 // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> Part Start >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 // zf_pwm_set_duty                                                              // PWM 更新占空比
+// zf_pwm_set_compare                                                           // PWM 直接设置比较计数值
+// zf_pwm_get_period                                                            // PWM 获取周期计数值
+// zf_pwm_get_count_freq                                                        // PWM 获取计数频率
+// zf_pwm_set_update_lock                                                       // PWM 锁定/释放预装载更新 多通道同步生效
 // zf_pwm_set_freq                                                              // PWM 模块设置频率
 
 // zf_pwm_pin_deinit                                                            // PWM 引脚初始化
@@ -245,6 +249,45 @@ extern zf_pwm_obj_struct pwm_obj_list[PWM_NUM_MAX];
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_pwm_set_duty (zf_pwm_positive_channel_enum pin, const uint32 duty);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 直接设置比较计数值
+// 参数说明     pin                 选择 PWM 引脚   (详见 zf_driver_pwm.h 内 zf_pwm_positive_channel_enum 定义)
+// 参数说明     compare             比较计数值 范围 0 - zf_pwm_get_period(pwm_index) + 1
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_pwm_set_compare(pin, compare);
+// 备注信息     不经过 PWM_DUTY_MAX 量化 分辨率为一个计数周期 (zf_pwm_get_count_freq 的倒数)
+//              边沿对齐时高电平宽度 = compare 个计数
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pwm_set_compare (zf_pwm_positive_channel_enum pin, const uint32 compare);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 获取周期计数值
+// 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
+// 返回参数     uint32              自动重装载值 模块未初始化时返回 0
+// 使用示例     zf_pwm_get_period(pwm_index);
+// 备注信息     
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_pwm_get_period (zf_pwm_index_enum pwm_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 获取计数频率
+// 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
+// 返回参数     uint32              计数频率 Hz (输入时钟 / 预分频) 模块未初始化时返回 0
+// 使用示例     zf_pwm_get_count_freq(pwm_index);
+// 备注信息     用于把微秒等时间量换算为比较计数值
+//-------------------------------------------------------------------------------------------------------------------
+uint32 zf_pwm_get_count_freq (zf_pwm_index_enum pwm_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     PWM 锁定/释放预装载更新
+// 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
+// 参数说明     lock                1 - 锁定 期间写入的比较值只进入预装载寄存器  0 - 释放 在下一次更新事件一起生效
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / ENCODER_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_pwm_set_update_lock(PWM_TIM8, 1);
+// 备注信息     通过 CR1.UDIS 屏蔽更新事件 计数器照常运行 不影响输出波形
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_pwm_set_update_lock (zf_pwm_index_enum pwm_index, uint8 lock);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     PWM 模块设置频率
 // 参数说明     pwm_index           选择 PWM 模块   (详见 zf_driver_pwm.h 内 zf_pwm_index_enum 定义)
@@ -31,6 +31,7 @@
 
 // zf_common 层引用
 #include "zf_common_debug.h"
+#include "zf_common_profile.h"
 #include "zf_common_memory.h"
 
 // zf_driver 层引用
@@ -49,6 +50,28 @@ static const zf_rcc_index_enum spi_rcc_index_list[SPI_NUM_MAX] =
     RCC_INDEX_SPI1, RCC_INDEX_SPI2, RCC_INDEX_SPI3, RCC_INDEX_SPI4
 };
 
+// 每个 SPI 固定占用 DMA1 的两个数据流 接收数据流的完成中断负责推进传输
+static const uint32 spi_dma_rx_stream_list[SPI_NUM_MAX] =
+{
+    DMA1_STREAM0_ID, DMA1_STREAM2_ID, DMA1_STREAM4_ID, DMA1_STREAM6_ID
+};
+static const uint32 spi_dma_tx_stream_list[SPI_NUM_MAX] =
+{
+    DMA1_STREAM1_ID, DMA1_STREAM3_ID, DMA1_STREAM5_ID, DMA1_STREAM7_ID
+};
+static const uint32 spi_dma_rx_trigger_list[SPI_NUM_MAX] =
+{
+    DMAMUX1_SPI1_RX, DMAMUX1_SPI2_RX, DMAMUX1_SPI3_RX, DMAMUX1_SPI4_RX
+};
+static const uint32 spi_dma_tx_trigger_list[SPI_NUM_MAX] =
+{
+    DMAMUX1_SPI1_TX, DMAMUX1_SPI2_TX, DMAMUX1_SPI3_TX, DMAMUX1_SPI4_TX
+};
+static const zf_profile_index_enum spi_dma_profile_list[SPI_NUM_MAX] =
+{
+    PROFILE_SPI1_DMA, PROFILE_SPI2_DMA, PROFILE_SPI3_DMA, PROFILE_SPI4_DMA
+};
+
 // 存储于预开辟的内存池中的管理信息 本部分对于用户来说是不开放的
 AT_ZF_LIB_SECTION_START
 AT_ZF_LIB_SECTION zf_spi_obj_struct spi_obj_list[SPI_NUM_MAX] =
@@ -59,6 +82,22 @@ AT_ZF_LIB_SECTION zf_spi_obj_struct spi_obj_list[SPI_NUM_MAX] =
     {.spi_ptr = SPI4, .clock_input = 150000000, .sck_pin = PIN_NULL, .mosi_pin = PIN_NULL, .miso_pin = PIN_NULL, .cs_pin = PIN_NULL, .baudrate = 0, .config_info = 0}
 };
 AT_ZF_LIB_SECTION_END
+
+typedef struct                                                                  // SPI DMA 总线管理信息 队首即为正在传输的对象
+{
+    const dma_descriptor_t                  *rx_stream      ;
+    const dma_descriptor_t                  *tx_stream      ;
+    zf_spi_dma_transfer_struct              *volatile queue_head    ;
+    zf_spi_dma_transfer_struct              *queue_tail     ;
+    zf_spi_dma_descriptor_struct            *descriptor     ;                   // 正在传输的描述符
+    volatile uint8                          blocking_depth  ;                   // 阻塞传输占用总线的嵌套层数 非零期间提交的 DMA 传输只排队不启动
+    volatile uint8                          dma_exclusive   ;                   // 总线只允许 DMA 访问 阻塞接口断言报错
+    uint32                                  spi_index       ;
+    uint32                                  dummy_tx        ;                   // 无发送缓冲区时的发送数据 0xFF
+    uint32                                  dummy_rx        ;                   // 无接收缓冲区时的接收丢弃位置
+}zf_spi_dma_obj_struct;
+
+static zf_spi_dma_obj_struct spi_dma_obj_list[SPI_NUM_MAX];
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 // 此处定义 本文件的所有函数具体定义 这里不允许用户修改
@@ -77,6 +116,7 @@ AT_ZF_LIB_SECTION_END
 #define SPI_STATE_TX_FIFO_FULL(x)   ((spi_obj_list[x].spi_ptr->SR & SPI_SR_FTLVL) == SPI_SR_FTLVL)  // SPI 发送缓冲器满了
 #define SPI_STATE_RX_AVAILABLE(x)   (spi_obj_list[x].spi_ptr->SR & SPI_SR_RXNE)                     // SPI 接收缓冲器收到有效数据
 #define SPI_STATE_TX_EMPTY(x)       (spi_obj_list[x].spi_ptr->SR & SPI_SR_TXE)                      // SPI 发送缓冲器空了
+#define SPI_STATE_DMA_BUSY(x)       (NULL != spi_dma_obj_list[x].queue_head)                        // SPI DMA 队列中有传输未完成
 
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     SPI 断言处理
@@ -116,6 +156,12 @@ uint8 zf_spi_transfer_8bit_array (zf_spi_index_enum spi_index, const uint8 *writ
             return_state = SPI_ERROR_MODULE_NOT_INIT;                           // SPI 模块未初始化 操作无法进行
             break;
         }
+        if(zf_spi_assert(!spi_dma_obj_list[spi_index].dma_exclusive))
+        {
+            // 此处如果断言报错 那么证明本总线已由 zf_spi_dma_set_exclusive 设置为只允许 DMA 访问
+            return_state = SPI_ERROR_BUS_DMA_EXCLUSIVE;                         // SPI 总线只允许 DMA 访问 操作无法进行
+            break;
+        }
         if(zf_spi_assert((NULL != write_buffer) || (NULL != read_buffer)))
         {
             // 此处如果断言报错 那么证明传入数据指针为 NULL 空指针
@@ -129,6 +175,7 @@ uint8 zf_spi_transfer_8bit_array (zf_spi_index_enum spi_index, const uint8 *writ
             break;
         }
 
+        zf_spi_bus_claim(spi_index);                                            // 等待 DMA 队列传输完毕并占用总线
         SPI_CTRL_RX(spi_index, ZF_ENABLE);
         SPI_CTRL_CS(spi_index, ZF_ENABLE);
 
@@ -149,6 +196,7 @@ uint8 zf_spi_transfer_8bit_array (zf_spi_index_enum spi_index, const uint8 *writ
         while(SPI_STATE_BUY(spi_index));                                        // 等待传输完毕
         SPI_CTRL_CS(spi_index, ZF_DISABLE);
         SPI_CTRL_RX(spi_index, ZF_DISABLE);
+        zf_spi_bus_release(spi_index);                                          // 释放总线 启动期间排队的 DMA 传输
 
         return_state = SPI_OPERATION_DONE;
     }while(0);
@@ -178,6 +226,12 @@ uint8 zf_spi_transfer_16bit_array (zf_spi_index_enum spi_index, const uint16 *wr
             return_state = SPI_ERROR_MODULE_NOT_INIT;                           // SPI 模块未初始化 操作无法进行
             break;
         }
+        if(zf_spi_assert(!spi_dma_obj_list[spi_index].dma_exclusive))
+        {
+            // 此处如果断言报错 那么证明本总线已由 zf_spi_dma_set_exclusive 设置为只允许 DMA 访问
+            return_state = SPI_ERROR_BUS_DMA_EXCLUSIVE;                         // SPI 总线只允许 DMA 访问 操作无法进行
+            break;
+        }
         if(zf_spi_assert((NULL != write_buffer) || (NULL != read_buffer)))
         {
             // 此处如果断言报错 那么证明传入数据指针为 NULL 空指针
@@ -191,6 +245,7 @@ uint8 zf_spi_transfer_16bit_array (zf_spi_index_enum spi_index, const uint16 *wr
             break;
         }
 
+        zf_spi_bus_claim(spi_index);                                            // 等待 DMA 队列传输完毕并占用总线
         SPI_CTRL_RX(spi_index, ZF_ENABLE);
         SPI_CTRL_CS(spi_index, ZF_ENABLE);
 
@@ -244,6 +299,7 @@ uint8 zf_spi_transfer_16bit_array (zf_spi_index_enum spi_index, const uint16 *wr
         while(SPI_STATE_BUY(spi_index));                                        // 等待传输完毕
         SPI_CTRL_CS(spi_index, ZF_DISABLE);
         SPI_CTRL_RX(spi_index, ZF_DISABLE);
+        zf_spi_bus_release(spi_index);                                          // 释放总线 启动期间排队的 DMA 传输
 
         return_state = SPI_OPERATION_DONE;
     }while(0);
@@ -251,6 +307,338 @@ uint8 zf_spi_transfer_16bit_array (zf_spi_index_enum spi_index, const uint16 *wr
     return return_state;
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 开始传输一个描述符
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 参数说明     *descriptor         传输描述符
+// 返回参数     void
+// 使用示例     zf_spi_dma_descriptor_start(spi_index, descriptor);
+// 备注信息     内部调用 收发两个数据流同时传输相同帧数 接收数据流完成即代表本段全部帧已移出
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_spi_dma_descriptor_start (zf_spi_index_enum spi_index, zf_spi_dma_descriptor_struct *descriptor)
+{
+    zf_spi_dma_obj_struct  *dma_obj     = &spi_dma_obj_list[spi_index];
+    uint32                  size_mode   = (spi_obj_list[spi_index].width) ? (DMA_CCR_PSIZE_HWORD | DMA_CCR_MSIZE_HWORD) : (DMA_CCR_PSIZE_BYTE | DMA_CCR_MSIZE_BYTE);
+    uint32                  rx_mode     = DMA_CCR_PL_VALUE(SPI_DMA_BUS_PRIORITY) | DMA_CCR_DIR_P2M | DMA_CCR_TCIE | DMA_CCR_TEIE | size_mode;
+    uint32                  tx_mode     = DMA_CCR_PL_VALUE(SPI_DMA_BUS_PRIORITY) | DMA_CCR_DIR_M2P | DMA_CCR_TEIE | size_mode;
+
+    dma_obj->descriptor = descriptor;
+
+    if(NULL != descriptor->read_buffer)
+    {
+        dma_stream_set_memory(dma_obj->rx_stream, (uint32)descriptor->read_buffer);
+        rx_mode |= DMA_CCR_MINC;
+    }
+    else
+    {
+        dma_stream_set_memory(dma_obj->rx_stream, (uint32)&dma_obj->dummy_rx);
+    }
+    if(NULL != descriptor->write_buffer)
+    {
+        dma_stream_set_memory(dma_obj->tx_stream, (uint32)descriptor->write_buffer);
+        tx_mode |= DMA_CCR_MINC;
+    }
+    else
+    {
+        dma_stream_set_memory(dma_obj->tx_stream, (uint32)&dma_obj->dummy_tx);
+    }
+    dma_stream_set_count(dma_obj->rx_stream, descriptor->length);
+    dma_stream_set_count(dma_obj->tx_stream, descriptor->length);
+    dma_stream_set_transfer_mode(dma_obj->rx_stream, rx_mode);
+    dma_stream_set_transfer_mode(dma_obj->tx_stream, tx_mode);
+
+    // 发送数据流不开完成中断 上一段遗留的完成标志需要在使能前清除
+    dma_stream_clear_interrupts(dma_obj->rx_stream);
+    dma_stream_clear_interrupts(dma_obj->tx_stream);
+
+    // 先开接收请求再开发送请求 保证第一个接收帧不会在接收数据流就绪前到达
+    spi_obj_list[spi_index].spi_ptr->CR2 |= SPI_CR2_RXDMAEN;
+    dma_stream_enable(dma_obj->rx_stream);
+    dma_stream_enable(dma_obj->tx_stream);
+    spi_obj_list[spi_index].spi_ptr->CR2 |= SPI_CR2_TXDMAEN;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 开始传输队首对象
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_spi_dma_transfer_begin(spi_index);
+// 备注信息     内部调用 调用前队首不能为空 在关中断或 DMA 中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_spi_dma_transfer_begin (zf_spi_index_enum spi_index)
+{
+    zf_spi_dma_transfer_struct *transfer = spi_dma_obj_list[spi_index].queue_head;
+
+    transfer->state = SPI_DMA_STATE_BUSY;
+    if(PIN_NULL != transfer->cs_pin)
+    {
+        zf_gpio_low(transfer->cs_pin);
+    }
+    zf_spi_dma_descriptor_start(spi_index, transfer->descriptor);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 结束队首对象 并开始下一个
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 参数说明     state               结束状态        (详见 zf_driver_spi.h 内 zf_spi_dma_state_enum 定义)
+// 返回参数     void
+// 使用示例     zf_spi_dma_transfer_finish(spi_index, SPI_DMA_STATE_DONE);
+// 备注信息     内部调用 先出队并启动下一个再回调 回调中提交的新传输会正确排队
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_spi_dma_transfer_finish (zf_spi_index_enum spi_index, zf_spi_dma_state_enum state)
+{
+    zf_spi_dma_obj_struct       *dma_obj    = &spi_dma_obj_list[spi_index];
+    zf_spi_dma_transfer_struct  *transfer   = dma_obj->queue_head;
+
+    if(PIN_NULL != transfer->cs_pin)
+    {
+        zf_gpio_high(transfer->cs_pin);
+    }
+
+    dma_obj->descriptor = NULL;
+    dma_obj->queue_head = transfer->queue_next;
+    if(NULL == dma_obj->queue_head)
+    {
+        dma_obj->queue_tail = NULL;
+    }
+    else if(SPI_DMA_STATE_ABORT != state)
+    {
+        zf_spi_dma_transfer_begin(spi_index);
+    }
+
+    transfer->queue_next    = NULL;
+    transfer->state         = state;
+    if(NULL != transfer->callback)
+    {
+        transfer->callback(state, transfer->callback_ptr);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 数据流中断回调
+// 参数说明     *ptr                SPI DMA 总线管理信息
+// 参数说明     sts                 数据流中断标志
+// 返回参数     void
+// 使用示例     dma_stream_take(id, priority, zf_spi_dma_stream_callback, ptr);
+// 备注信息     由 SDK 的 DMA 中断服务函数清除标志后调用 接收数据流完成时推进描述符链 任一数据流出错时中止当前对象
+//-------------------------------------------------------------------------------------------------------------------
+static void zf_spi_dma_stream_callback (void *ptr, uint32_t sts)
+{
+    zf_spi_dma_obj_struct  *dma_obj     = (zf_spi_dma_obj_struct *)ptr;
+    zf_spi_index_enum       spi_index   = (zf_spi_index_enum)dma_obj->spi_index;
+
+    zf_profile_enter(spi_dma_profile_list[spi_index]);
+    do
+    {
+        if(NULL == dma_obj->descriptor)
+        {
+            break;
+        }
+        if(sts & DMA_STS_TEIF)
+        {
+            dma_stream_disable(dma_obj->rx_stream);
+            dma_stream_disable(dma_obj->tx_stream);
+            spi_obj_list[spi_index].spi_ptr->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+            zf_spi_dma_transfer_finish(spi_index, SPI_DMA_STATE_ERROR);
+            break;
+        }
+        if(!(sts & DMA_STS_TCIF))
+        {
+            break;
+        }
+
+        spi_obj_list[spi_index].spi_ptr->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+        if(NULL != dma_obj->descriptor->next)
+        {
+            zf_spi_dma_descriptor_start(spi_index, dma_obj->descriptor->next);  // 片选保持 继续下一段
+        }
+        else
+        {
+            zf_spi_dma_transfer_finish(spi_index, SPI_DMA_STATE_DONE);
+        }
+    }while(0);
+    zf_profile_exit(spi_dma_profile_list[spi_index]);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 异步传输 提交到总线队列
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 参数说明     *transfer           传输对象 描述符链与缓冲区在传输完成前必须保持有效
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / SPI_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_spi_dma_transfer(spi_index, &transfer);
+// 备注信息     立即返回 总线空闲时直接开始 否则排到队尾 按提交顺序依次传输
+//              阻塞接口正在占用总线时只排队 由 zf_spi_bus_release 释放总线时启动
+//              每个传输对象拉低一次片选 依次传输描述符链中的每一段 全部完成后拉高片选并调用回调
+//              回调在 DMA 中断中执行 可以在回调中提交新的传输 缓冲区不要放在 DTCM 中
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_transfer (zf_spi_index_enum spi_index, zf_spi_dma_transfer_struct *transfer)
+{
+    zf_spi_operation_state_enum    return_state    =   SPI_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_spi_assert(NULL != spi_dma_obj_list[spi_index].rx_stream))
+        {
+            // 此处如果断言报错 那么证明本模块的 DMA 没有初始化过 是不允许直接操作的
+            return_state = SPI_ERROR_DMA_NOT_INIT;                              // SPI DMA 未初始化 操作无法进行
+            break;
+        }
+        if(zf_spi_assert((NULL != transfer) && (NULL != transfer->descriptor)))
+        {
+            // 此处如果断言报错 那么证明传入的传输对象或描述符为 NULL 空指针
+            return_state = SPI_ERROR_DATA_BUFFER_NULL;                          // SPI 数据指针异常 操作无法进行
+            break;
+        }
+        if(zf_spi_assert((SPI_DMA_STATE_QUEUED != transfer->state) && (SPI_DMA_STATE_BUSY != transfer->state)))
+        {
+            // 此处如果断言报错 那么证明该传输对象上一次提交还没有完成 不能重复提交
+            return_state = SPI_ERROR_DMA_TRANSFER_BUSY;                         // SPI DMA 传输对象仍在队列中 操作无法进行
+            break;
+        }
+        {
+            zf_spi_dma_descriptor_struct *descriptor = transfer->descriptor;
+            for( ; NULL != descriptor; descriptor = descriptor->next)
+            {
+                if(0 == descriptor->length || SPI_DMA_LENGTH_MAX < descriptor->length)
+                {
+                    break;
+                }
+            }
+            if(zf_spi_assert(NULL == descriptor))
+            {
+                // 此处如果断言报错 那么证明描述符链中有长度为 0 或超过 SPI_DMA_LENGTH_MAX 的段
+                return_state = SPI_ERROR_DMA_LENGTH_ILLEGAL;                    // SPI DMA 描述符长度错误 操作无法进行
+                break;
+            }
+        }
+        if(!spi_obj_list[spi_index].enable)
+        {
+            return_state = SPI_WARNING_MODULE_DISABLE;                          // SPI 模块失能禁用 操作中断退出
+            break;
+        }
+
+        transfer->queue_next    = NULL;
+        transfer->state         = SPI_DMA_STATE_QUEUED;
+
+        uint32 primask = zf_interrupt_global_disable();
+        if(NULL == spi_dma_obj_list[spi_index].queue_head)
+        {
+            spi_dma_obj_list[spi_index].queue_head = transfer;
+            spi_dma_obj_list[spi_index].queue_tail = transfer;
+            if(0 == spi_dma_obj_list[spi_index].blocking_depth)                 // 阻塞传输占用总线时由其释放总线时启动
+            {
+                zf_spi_dma_transfer_begin(spi_index);
+            }
+        }
+        else
+        {
+            spi_dma_obj_list[spi_index].queue_tail->queue_next = transfer;
+            spi_dma_obj_list[spi_index].queue_tail = transfer;
+        }
+        zf_interrupt_global_enable(primask);
+
+        return_state = SPI_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI 阻塞访问 占用总线
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_spi_bus_claim(spi_index);
+// 备注信息     等待 DMA 队列传输完毕后在关中断区内占用总线 可以嵌套 与 zf_spi_bus_release 成对调用
+//              总线设置为只允许 DMA 访问时断言报错 不占用总线
+//              占用期间中断中提交的 DMA 传输只排队 不会拉低片选或写 DR
+//              阻塞传输接口内部会自动占用 外部片选跨多次阻塞传输时需要在片选拉低前占用 拉高后释放
+//              不要在中断中调用 中断中访问总线请使用 zf_spi_dma_transfer
+//-------------------------------------------------------------------------------------------------------------------
+void zf_spi_bus_claim (zf_spi_index_enum spi_index)
+{
+    zf_spi_dma_obj_struct  *dma_obj     = &spi_dma_obj_list[spi_index];
+    uint32                  primask     = 0;
+
+    if(zf_spi_assert(!dma_obj->dma_exclusive))
+    {
+        // 此处如果断言报错 那么证明本总线已由 zf_spi_dma_set_exclusive 设置为只允许 DMA 访问
+        return;
+    }
+    while(1)
+    {
+        primask = zf_interrupt_global_disable();
+        if((0 != dma_obj->blocking_depth) || !SPI_STATE_DMA_BUSY(spi_index))
+        {
+            dma_obj->blocking_depth ++;
+            zf_interrupt_global_enable(primask);
+            break;
+        }
+        zf_interrupt_global_enable(primask);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI 阻塞访问 释放总线
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_spi_bus_release(spi_index);
+// 备注信息     最外层释放时 如果占用期间有 DMA 传输排队则在此启动队首
+//-------------------------------------------------------------------------------------------------------------------
+void zf_spi_bus_release (zf_spi_index_enum spi_index)
+{
+    zf_spi_dma_obj_struct  *dma_obj     = &spi_dma_obj_list[spi_index];
+    uint32                  primask     = zf_interrupt_global_disable();
+
+    if(0 != dma_obj->blocking_depth)
+    {
+        dma_obj->blocking_depth --;
+        if((0 == dma_obj->blocking_depth) && SPI_STATE_DMA_BUSY(spi_index))
+        {
+            zf_spi_dma_transfer_begin(spi_index);
+        }
+    }
+    zf_interrupt_global_enable(primask);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 设置总线只允许 DMA 访问
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 参数说明     enable              ZF_TRUE - 只允许 DMA 访问 / ZF_FALSE - 恢复阻塞接口
+// 返回参数     void
+// 使用示例     zf_spi_dma_set_exclusive(spi_index, ZF_TRUE);
+// 备注信息     由独占总线的服务 (如 imu_sampler) 在完成阻塞方式的初始化后调用
+//              设置后阻塞传输 zf_spi_bus_claim zf_spi_set_config zf_spi_set_speed 均断言报错
+//-------------------------------------------------------------------------------------------------------------------
+void zf_spi_dma_set_exclusive (zf_spi_index_enum spi_index, uint8 enable)
+{
+    spi_dma_obj_list[spi_index].dma_exclusive = (enable) ? (ZF_TRUE) : (ZF_FALSE);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 查询总线队列是否有传输未完成
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     uint8               ZF_TRUE - 有传输未完成 / ZF_FALSE - 总线空闲
+// 使用示例     zf_spi_dma_check_busy(spi_index);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_check_busy (zf_spi_index_enum spi_index)
+{
+    return (SPI_STATE_DMA_BUSY(spi_index)) ? (ZF_TRUE) : (ZF_FALSE);
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 等待指定传输完成
+// 参数说明     *transfer           传输对象
+// 返回参数     uint8               操作状态 ZF_NO_ERROR - 传输完成 / ZF_ERROR - 传输错误或被中止
+// 使用示例     zf_spi_dma_wait(&transfer);
+// 备注信息     阻塞等待 不要在优先级不低于 SPI_DMA_IRQ_PRIORITY 的中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_wait (zf_spi_dma_transfer_struct *transfer)
+{
+    while((SPI_DMA_STATE_QUEUED == transfer->state) || (SPI_DMA_STATE_BUSY == transfer->state));
+    return (SPI_DMA_STATE_DONE == transfer->state) ? (ZF_NO_ERROR) : (ZF_ERROR);
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     SPI 接口 配置设置
 // 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
@@ -271,7 +659,14 @@ uint8 zf_spi_set_config (zf_spi_index_enum spi_index, zf_spi_config_item_enum it
             return_state = SPI_ERROR_MODULE_NOT_INIT;                           // SPI 模块未初始化 操作无法进行
             break;
         }
+        if(zf_spi_assert(!spi_dma_obj_list[spi_index].dma_exclusive))
+        {
+            // 此处如果断言报错 那么证明本总线已由 zf_spi_dma_set_exclusive 设置为只允许 DMA 访问
+            return_state = SPI_ERROR_BUS_DMA_EXCLUSIVE;                         // SPI 总线只允许 DMA 访问 操作无法进行
+            break;
+        }
 
+        zf_spi_bus_claim(spi_index);                                            // 等待 DMA 队列传输完毕并占用总线
         while(SPI_STATE_BUY(spi_index));                                        // 等待传输完毕
 
         uint32 register_temp = 0;
@@ -302,6 +697,7 @@ uint8 zf_spi_set_config (zf_spi_index_enum spi_index, zf_spi_config_item_enum it
                 spi_obj_list[spi_index].spi_ptr->CR1 = register_temp;
             }break;
         }
+        zf_spi_bus_release(spi_index);
 
         return_state = SPI_OPERATION_DONE;
     }while(0);
@@ -329,6 +725,12 @@ uint8 zf_spi_set_speed (zf_spi_index_enum spi_index, uint32 baudrate)
             return_state = SPI_ERROR_MODULE_NOT_INIT;                           // SPI 模块未初始化 操作无法进行
             break;
         }
+        if(zf_spi_assert(!spi_dma_obj_list[spi_index].dma_exclusive))
+        {
+            // 此处如果断言报错 那么证明本总线已由 zf_spi_dma_set_exclusive 设置为只允许 DMA 访问
+            return_state = SPI_ERROR_BUS_DMA_EXCLUSIVE;                         // SPI 总线只允许 DMA 访问 操作无法进行
+            break;
+        }
         if(zf_spi_assert(1000000 <= baudrate && spi_obj_list[spi_index].clock_input / 2 >= baudrate))
         {
             // 此处如果断言报错 那么证明输入的 SPI 的波特率不正确
@@ -336,6 +738,7 @@ uint8 zf_spi_set_speed (zf_spi_index_enum spi_index, uint32 baudrate)
             break;
         }
 
+        zf_spi_bus_claim(spi_index);                                            // 等待 DMA 队列传输完毕并占用总线
         while(SPI_STATE_BUY(spi_index));                                        // 等待传输完毕
         spi_obj_list[spi_index].spi_ptr->CR1 &= ~SPI_CR1_SPE;
 
@@ -365,6 +768,7 @@ uint8 zf_spi_set_speed (zf_spi_index_enum spi_index, uint32 baudrate)
             register_temp |= (i << 3);
             spi_obj_list[spi_index].spi_ptr->CR1 = register_temp;
         }
+        zf_spi_bus_release(spi_index);
 
         return_state = SPI_OPERATION_DONE;
     }while(0);
@@ -448,6 +852,11 @@ uint8 zf_spi_deinit (zf_spi_index_enum spi_index)
             break;
         }
 
+        if(NULL != spi_dma_obj_list[spi_index].rx_stream)
+        {
+            zf_spi_dma_deinit(spi_index);
+        }
+
         zf_gpio_deinit((zf_gpio_pin_enum)spi_obj_list[spi_index].sck_pin);
         zf_gpio_deinit((zf_gpio_pin_enum)spi_obj_list[spi_index].mosi_pin);
         if(spi_obj_list[spi_index].use_miso)
@@ -626,3 +1035,124 @@ uint8 zf_spi_init (zf_spi_index_enum spi_index, zf_spi_mode_enum mode, uint32 ba
 
     return return_state;
 }
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 注销初始化
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / SPI_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_spi_dma_deinit(spi_index);
+// 备注信息     中止正在进行的传输 队列中所有传输对象以 SPI_DMA_STATE_ABORT 状态回调 然后释放 DMA 数据流
+//              回调收到 SPI_DMA_STATE_ABORT 时不要再重新提交 否则会一直被中止
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_deinit (zf_spi_index_enum spi_index)
+{
+    zf_spi_operation_state_enum    return_state    =   SPI_ERROR_UNKNOW;
+
+    do
+    {
+        if(zf_spi_assert(NULL != spi_dma_obj_list[spi_index].rx_stream))
+        {
+            // 此处如果断言报错 那么证明本模块的 DMA 没有初始化过 是不允许直接操作的
+            return_state = SPI_ERROR_DMA_NOT_INIT;                              // SPI DMA 未初始化 操作无法进行
+            break;
+        }
+
+        // 回调中可能提交新的传输并重新启动数据流 因此每次中止前都重新停止
+        uint32 primask = zf_interrupt_global_disable();
+        while(1)
+        {
+            dma_stream_disable(spi_dma_obj_list[spi_index].rx_stream);
+            dma_stream_disable(spi_dma_obj_list[spi_index].tx_stream);
+            spi_obj_list[spi_index].spi_ptr->CR2 &= ~(SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
+            if(NULL == spi_dma_obj_list[spi_index].queue_head)
+            {
+                break;
+            }
+            zf_spi_dma_transfer_finish(spi_index, SPI_DMA_STATE_ABORT);
+        }
+        zf_interrupt_global_enable(primask);
+
+        // 中止时移位寄存器中可能残留半帧 等待移出后清空接收缓冲
+        while(SPI_STATE_BUY(spi_index));
+        while(SPI_STATE_RX_AVAILABLE(spi_index))
+        {
+            (void)SPI_DATA_8BIT_RX(spi_index);
+        }
+
+        dma_stream_free(spi_dma_obj_list[spi_index].rx_stream);
+        dma_stream_free(spi_dma_obj_list[spi_index].tx_stream);
+        spi_dma_obj_list[spi_index].rx_stream = NULL;
+        spi_dma_obj_list[spi_index].tx_stream = NULL;
+        spi_dma_obj_list[spi_index].dma_exclusive = ZF_FALSE;
+
+        return_state = SPI_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 初始化
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / SPI_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_spi_dma_init(spi_index);
+// 备注信息     需要先调用 zf_spi_init 固定占用 DMA1 的两个数据流
+//              SPI_1 - 数据流 0/1  SPI_2 - 数据流 2/3  SPI_3 - 数据流 4/5  SPI_4 - 数据流 6/7
+//              初始化后阻塞接口与 DMA 接口可以混用 阻塞接口会先等待 DMA 队列传输完毕
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_init (zf_spi_index_enum spi_index)
+{
+    zf_spi_operation_state_enum    return_state    =   SPI_ERROR_UNKNOW;
+    zf_spi_dma_obj_struct          *dma_obj        =   &spi_dma_obj_list[spi_index];
+
+    do
+    {
+        if(zf_spi_assert(spi_obj_list[spi_index].baudrate))
+        {
+            // 此处如果断言报错 那么证明本模块没有初始化过 是不允许直接操作的
+            return_state = SPI_ERROR_MODULE_NOT_INIT;                           // SPI 模块未初始化 操作无法进行
+            break;
+        }
+        if(zf_spi_assert(NULL == dma_obj->rx_stream))
+        {
+            // 此处如果断言报错 那么证明本模块的 DMA 已经被初始化过一次 重复初始化是不允许的
+            return_state = SPI_ERROR_MODULE_OCCUPIED;                           // SPI 模块已被占用 操作无法进行
+            break;
+        }
+
+        dma_obj->spi_index  = spi_index;
+        dma_obj->queue_head = NULL;
+        dma_obj->queue_tail = NULL;
+        dma_obj->descriptor = NULL;
+        dma_obj->dummy_tx   = 0xFFFFFFFF;
+        dma_obj->dummy_rx   = 0;
+
+        dma_obj->rx_stream = dma_stream_take(spi_dma_rx_stream_list[spi_index], SPI_DMA_IRQ_PRIORITY, zf_spi_dma_stream_callback, (void *)dma_obj);
+        dma_obj->tx_stream = dma_stream_take(spi_dma_tx_stream_list[spi_index], SPI_DMA_IRQ_PRIORITY, zf_spi_dma_stream_callback, (void *)dma_obj);
+        if(zf_spi_assert((NULL != dma_obj->rx_stream) && (NULL != dma_obj->tx_stream)))
+        {
+            // 此处如果断言报错 那么证明对应的 DMA 数据流已经被其他模块占用
+            if(NULL != dma_obj->rx_stream)
+            {
+                dma_stream_free(dma_obj->rx_stream);
+            }
+            if(NULL != dma_obj->tx_stream)
+            {
+                dma_stream_free(dma_obj->tx_stream);
+            }
+            dma_obj->rx_stream = NULL;
+            dma_obj->tx_stream = NULL;
+            return_state = SPI_ERROR_DMA_STREAM_OCCUPIED;                       // SPI DMA 数据流已被占用 操作无法进行
+            break;
+        }
+
+        dma_stream_set_peripheral(dma_obj->rx_stream, (uint32)&spi_obj_list[spi_index].spi_ptr->DR);
+        dma_stream_set_peripheral(dma_obj->tx_stream, (uint32)&spi_obj_list[spi_index].spi_ptr->DR);
+        dma_stream_set_trigger(dma_obj->rx_stream, spi_dma_rx_trigger_list[spi_index]);
+        dma_stream_set_trigger(dma_obj->tx_stream, spi_dma_tx_trigger_list[spi_index]);
+
+        return_state = SPI_OPERATION_DONE;
+    }while(0);
+
+    return return_state;
+}
@@ -33,6 +33,7 @@
 #define _zf_driver_spi_h_
 
 // SDK 底层驱动
+#include <dma.h>
 #include <spi.h>
 
 // zf_common 层引用
@@ -40,6 +41,7 @@
 
 // zf_driver 层 类型定义 引用
 #include "zf_driver_gpio.h"
+#include "zf_driver_interrupt.h"
 
 // 此处列举 当前支持的函数列表
 // 具体声明在本函数中查看对应注释 具体定义跳转到对应函数定义查看
@@ -47,6 +49,13 @@
 // zf_spi_transfer_8bit_array                                                   // SPI 接口传输 8bit 数组 先写后读取
 // zf_spi_transfer_16bit_array                                                  // SPI 接口传输 16bit 数组 先写后读取
 
+// zf_spi_dma_transfer                                                          // SPI DMA 异步传输 提交到总线队列
+// zf_spi_dma_check_busy                                                        // SPI DMA 查询总线队列是否有传输未完成
+// zf_spi_dma_wait                                                              // SPI DMA 等待指定传输完成
+// zf_spi_bus_claim                                                             // SPI 阻塞访问 占用总线
+// zf_spi_bus_release                                                           // SPI 阻塞访问 释放总线
+// zf_spi_dma_set_exclusive                                                     // SPI DMA 设置总线只允许 DMA 访问
+
 // zf_spi_set_config                                                            // SPI 接口配置设置
 // zf_spi_set_speed                                                             // SPI 接口配置速度
 
@@ -55,6 +64,9 @@
 
 // zf_spi_deinit                                                                // SPI 接口注销初始化
 // zf_spi_init                                                                  // SPI 接口初始化 默认 MASTER 模式 不提供 SLAVE 模式
+
+// zf_spi_dma_deinit                                                            // SPI DMA 注销初始化
+// zf_spi_dma_init                                                              // SPI DMA 初始化
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 // 此处定义 UART 相关的结构体数据构成细节 这里不允许用户修改
@@ -188,6 +200,12 @@ typedef enum
     SPI_ERROR_CS_PIN_ILLEGAL                            ,                       // SPI 引脚参数错误 操作无法进行
 
     SPI_ERROR_DATA_BUFFER_NULL                          ,                       // SPI 数据指针异常 操作无法进行
+
+    SPI_ERROR_DMA_NOT_INIT                              ,                       // SPI DMA 未初始化 操作无法进行
+    SPI_ERROR_DMA_STREAM_OCCUPIED                       ,                       // SPI DMA 数据流已被占用 操作无法进行
+    SPI_ERROR_DMA_LENGTH_ILLEGAL                        ,                       // SPI DMA 描述符长度错误 操作无法进行
+    SPI_ERROR_DMA_TRANSFER_BUSY                         ,                       // SPI DMA 传输对象仍在队列中 操作无法进行
+    SPI_ERROR_BUS_DMA_EXCLUSIVE                         ,                       // SPI 总线只允许 DMA 访问 操作无法进行
 }zf_spi_operation_state_enum;
 
 typedef struct                                                                  // SPI 管理对象模板 用于存储 SPI 的信息
@@ -222,6 +240,38 @@ typedef struct
 }zf_spi_obj_struct;
 
 extern zf_spi_obj_struct zf_spi_obj_list[SPI_NUM_MAX];
+
+#define     SPI_DMA_BUS_PRIORITY    ( DMA_PRIORITY_HIGH     )                   // DMA 总线仲裁优先级
+#define     SPI_DMA_IRQ_PRIORITY    ( INTERRUPT_PRIORITY_4  )                   // DMA 完成中断优先级 完成回调在此优先级下执行
+#define     SPI_DMA_LENGTH_MAX      ( 65535 )                                   // 单个描述符最多传输的帧数 受 DMA 计数寄存器限制
+
+typedef enum                                                                    // 枚举 SPI DMA 传输对象状态 此枚举定义不允许用户修改
+{
+    SPI_DMA_STATE_IDLE              ,                                           // 未提交过
+    SPI_DMA_STATE_QUEUED            ,                                           // 已在总线队列中等待
+    SPI_DMA_STATE_BUSY              ,                                           // 正在传输
+    SPI_DMA_STATE_DONE              ,                                           // 传输完成
+    SPI_DMA_STATE_ERROR             ,                                           // DMA 传输错误 已中止
+    SPI_DMA_STATE_ABORT             ,                                           // 被 zf_spi_dma_deinit 中止
+}zf_spi_dma_state_enum;
+
+typedef struct zf_spi_dma_descriptor_struct                                     // SPI DMA 传输描述符 一段连续的收发缓冲区
+{
+    const void                              *write_buffer   ;                   // 发送缓冲区 NULL 时发送 0xFF
+    void                                    *read_buffer    ;                   // 接收缓冲区 NULL 时丢弃接收数据
+    uint32                                  length          ;                   // 帧数 8bit 位宽为字节数 16bit 位宽为半字数
+    struct zf_spi_dma_descriptor_struct     *next           ;                   // 同一次片选内的下一段 NULL 表示结束
+}zf_spi_dma_descriptor_struct;
+
+typedef struct zf_spi_dma_transfer_struct                                       // SPI DMA 传输对象 一次片选周期 由调用者持有
+{
+    zf_spi_dma_descriptor_struct            *descriptor     ;                   // 描述符链表头
+    zf_gpio_pin_enum                        cs_pin          ;                   // 软件片选引脚 传输期间拉低 PIN_NULL 则不操作
+    void_callback_uint32_ptr                callback        ;                   // 完成回调 参数为 zf_spi_dma_state_enum 与 callback_ptr 可为 NULL
+    void                                    *callback_ptr   ;                   // 完成回调参数
+    volatile uint32                         state           ;                   // 当前状态 zf_spi_dma_state_enum
+    struct zf_spi_dma_transfer_struct       *queue_next     ;                   // 总线队列链接 内部使用
+}zf_spi_dma_transfer_struct;
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 // 此处列举 本文件的所有函数声明 [ 其中包括宏定义函数 ] 这里不允许用户修改
@@ -263,6 +313,69 @@ uint8 zf_spi_transfer_8bit_array (zf_spi_index_enum spi_index, const uint8 *writ
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_spi_transfer_16bit_array (zf_spi_index_enum spi_index, const uint16 *write_buffer, uint16 *read_buffer, uint32 len);
 
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 异步传输 提交到总线队列
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 参数说明     *transfer           传输对象 描述符链与缓冲区在传输完成前必须保持有效
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / SPI_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_spi_dma_transfer(spi_index, &transfer);
+// 备注信息     立即返回 总线空闲时直接开始 否则排到队尾 按提交顺序依次传输
+//              每个传输对象拉低一次片选 依次传输描述符链中的每一段 全部完成后拉高片选并调用回调
+//              回调在 DMA 中断中执行 可以在回调中提交新的传输 缓冲区不要放在 DTCM 中
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_transfer (zf_spi_index_enum spi_index, zf_spi_dma_transfer_struct *transfer);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 查询总线队列是否有传输未完成
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     uint8               ZF_TRUE - 有传输未完成 / ZF_FALSE - 总线空闲
+// 使用示例     zf_spi_dma_check_busy(spi_index);
+// 备注信息
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_check_busy (zf_spi_index_enum spi_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 等待指定传输完成
+// 参数说明     *transfer           传输对象
+// 返回参数     uint8               操作状态 ZF_NO_ERROR - 传输完成 / ZF_ERROR - 传输错误或被中止
+// 使用示例     zf_spi_dma_wait(&transfer);
+// 备注信息     阻塞等待 不要在优先级不低于 SPI_DMA_IRQ_PRIORITY 的中断中调用
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_wait (zf_spi_dma_transfer_struct *transfer);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI 阻塞访问 占用总线
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_spi_bus_claim(spi_index);
+// 备注信息     等待 DMA 队列传输完毕后在关中断区内占用总线 可以嵌套 与 zf_spi_bus_release 成对调用
+//              总线设置为只允许 DMA 访问时断言报错 不占用总线
+//              占用期间中断中提交的 DMA 传输只排队 不会拉低片选或写 DR
+//              阻塞传输接口内部会自动占用 外部片选跨多次阻塞传输时需要在片选拉低前占用 拉高后释放
+//              不要在中断中调用 中断中访问总线请使用 zf_spi_dma_transfer
+//-------------------------------------------------------------------------------------------------------------------
+void  zf_spi_bus_claim (zf_spi_index_enum spi_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI 阻塞访问 释放总线
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     void
+// 使用示例     zf_spi_bus_release(spi_index);
+// 备注信息     最外层释放时 如果占用期间有 DMA 传输排队则在此启动队首
+//-------------------------------------------------------------------------------------------------------------------
+void  zf_spi_bus_release (zf_spi_index_enum spi_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 设置总线只允许 DMA 访问
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 参数说明     enable              ZF_TRUE - 只允许 DMA 访问 / ZF_FALSE - 恢复阻塞接口
+// 返回参数     void
+// 使用示例     zf_spi_dma_set_exclusive(spi_index, ZF_TRUE);
+// 备注信息     由独占总线的服务 (如 imu_sampler) 在完成阻塞方式的初始化后调用
+//              设置后阻塞传输 zf_spi_bus_claim zf_spi_set_config zf_spi_set_speed 均断言报错
+//-------------------------------------------------------------------------------------------------------------------
+void  zf_spi_dma_set_exclusive (zf_spi_index_enum spi_index, uint8 enable);
+
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     SPI 接口 配置设置
 // 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
@@ -324,6 +437,28 @@ uint8 zf_spi_deinit (zf_spi_index_enum spi_index);
 // 备注信息     
 //-------------------------------------------------------------------------------------------------------------------
 uint8 zf_spi_init (zf_spi_index_enum spi_index, zf_spi_mode_enum mode, uint32 baudrate, zf_spi_sck_pin_enum sck_pin, zf_spi_mosi_pin_enum mosi_pin, zf_spi_miso_pin_enum miso_pin, zf_spi_cs_pin_enum cs_pin);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 注销初始化
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / SPI_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_spi_dma_deinit(spi_index);
+// 备注信息     中止正在进行的传输 队列中所有传输对象以 SPI_DMA_STATE_ABORT 状态回调 然后释放 DMA 数据流
+//              回调收到 SPI_DMA_STATE_ABORT 时不要再重新提交 否则会一直被中止
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_deinit (zf_spi_index_enum spi_index);
+
+//-------------------------------------------------------------------------------------------------------------------
+// 函数简介     SPI DMA 初始化
+// 参数说明     spi_index           SPI 索引        (详见 zf_driver_spi.h 内 zf_spi_index_enum 定义)
+// 返回参数     uint8               操作状态 ZF_NO_ERROR / SPI_OPERATION_DONE - 完成 其余值为异常
+// 使用示例     zf_spi_dma_init(spi_index);
+// 备注信息     需要先调用 zf_spi_init 固定占用 DMA1 的两个数据流
+//              SPI_1 - 数据流 0/1  SPI_2 - 数据流 2/3  SPI_3 - 数据流 4/5  SPI_4 - 数据流 6/7
+//              初始化后阻塞接口与 DMA 接口可以混用 阻塞访问期间 (zf_spi_bus_claim 到 zf_spi_bus_release)
+//              提交的 DMA 传输只排队 释放总线后再开始 不会与阻塞传输同时拉低两个片选
+//-------------------------------------------------------------------------------------------------------------------
+uint8 zf_spi_dma_init (zf_spi_index_enum spi_index);
 // <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Part   End <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 #endif
@@ -34,6 +34,7 @@
 
 // zf_common 层引用
 #include "zf_common_memory.h"
+#include "zf_common_pool.h"
 #include "zf_common_function.h"
 
 // 自身头文件
@@ -108,6 +109,7 @@ ZF_WEAK void zf_system_clock_init (uint32 clock)
     system_clock_set_freq(clock);
 
     zf_memory_init();                                                           // 内存管理初始化
+    zf_pool_init();                                                             // 固定块内存池初始化
 
     extern void zf_interrupt_init (void);                                       // 外部调用中断系统初始化
     zf_interrupt_init();
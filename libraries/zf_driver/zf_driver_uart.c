@@ -31,7 +31,8 @@
 
 // zf_common 层引用
 #include "zf_common_debug.h"
-#include "zf_common_fifo.h"
+#include "zf_common_profile.h"
+#include "zf_common_ring.h"
 #include "zf_common_memory.h"
 
 // zf_driver 层引用
@@ -117,6 +118,7 @@ static void zf_uart_callbakc_defalut (uint32 event, void *ptr)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_UART1_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_UART_1);
     #define TEMP_UART_INDEX         UART1
     #define TEMP_UART_CALLBACK      uart_callback[UART_1]
 
@@ -148,6 +150,7 @@ void IRQ_UART1_HANDLER (void)
     #undef  TEMP_UART_INDEX 
     #undef  TEMP_UART_CALLBACK 
 
+    zf_profile_exit(PROFILE_UART_1);
     ZF_DSB();
 }
 
@@ -161,6 +164,7 @@ void IRQ_UART1_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_UART2_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_UART_2);
     #define TEMP_UART_INDEX         UART2
     #define TEMP_UART_CALLBACK      uart_callback[UART_2]
 
@@ -192,6 +196,7 @@ void IRQ_UART2_HANDLER (void)
     #undef  TEMP_UART_INDEX 
     #undef  TEMP_UART_CALLBACK 
 
+    zf_profile_exit(PROFILE_UART_2);
     ZF_DSB();
 }
 
@@ -205,6 +210,7 @@ void IRQ_UART2_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 void IRQ_UART3_HANDLER (void)
 {
+    zf_profile_enter(PROFILE_UART_3);
     #define TEMP_UART_INDEX         UART3
     #define TEMP_UART_CALLBACK      uart_callback[UART_3]
 
@@ -236,6 +242,7 @@ void IRQ_UART3_HANDLER (void)
     #undef  TEMP_UART_INDEX 
     #undef  TEMP_UART_CALLBACK 
 
+    zf_profile_exit(PROFILE_UART_3);
     ZF_DSB();
 }
 
@@ -243,7 +250,7 @@ void IRQ_UART3_HANDLER (void)
 //-------------------------------------------------------------------------------------------------------------------
 // 函数简介     debug 串口中断处理函数 isr.c 中对应串口中断服务函数调用
 // 参数说明     event               中断事件
-// 参数说明     *ptr                默认传入是一个 fifo 对象
+// 参数说明     *ptr                默认传入是一个 zf_ring 对象
 // 返回参数     void
 // 使用示例     debug_interrupr_handler();
 // 备注信息     本函数需要开启 DEBUG_UART_USE_INTERRUPT 宏定义才可使用
@@ -253,7 +260,7 @@ void debug_uart_interrupr_handler (uint32 event, void *ptr)
 	(void)event;
     uint8 debug_uart_data;
     zf_uart_query_byte(DEBUG_UART_INDEX, &debug_uart_data);                     // 读取串口数据
-    zf_fifo_write_element((zf_fifo_obj_struct *)ptr, debug_uart_data);          // 存入 FIFO
+    zf_ring_write_byte((zf_ring_obj_struct *)ptr, debug_uart_data);             // 存入环形缓冲区
 }
 
 //-------------------------------------------------------------------------------------------------------------------
@@ -12,40 +12,89 @@
 #include "bsp_uart.h"
 #include "bsp_rtk.h"
 #include "speed_control.h"
+#include "servo_calib.h"
+#include "steering_estimator.h"
 #include "path_manager.h"   // path_manager.h 已经被包含了，很好
+#include "scheduler.h"
+#include "topic.h"
+#include "latency_trace.h"
+#include "ring_benchmark.h"
+#include "pid_benchmark.h"
+#include "imu_sampler.h"
 
 // [AI-MOD] 添加此行以解决 "implicit declaration" 警告
 // 因为本文件调用了 navigation_init() 和 navigation_run_once()，
 // 所以必须包含它们的声明文件 navigation.h
 #include "navigation.h"
+#include <stdlib.h>
+#include <string.h>
 
-// ================== 全局变量 ==================
+// ================== 调试串口命令 ==================
 
-volatile uint32_t g_navigation_tick_count = 0;
+#define DEBUG_COMMAND_LINE_MAX  (32)    // 单行命令最大长度 (含结束符)，超长的行整行丢弃
 
-// ================== 中断服务程序 ==================
+/**
+ * @brief  解析调试串口收到的一行命令
+ * @note   目前只有舵机标定命令: "cal <实测转角>"，例如 "cal -12.5" 记录当前标定点并转到下一点。
+ *         标定由 KEY_3 短按开始 / 放弃，每到一个标定点用量角器测量前轮转角后发送本命令。
+ */
+static void debug_command_execute(const char *line)
+{
+    if (0 == strncmp(line, "cal ", 4))
+    {
+        char *end = NULL;
+        const float measured_angle_deg = strtof(line + 4, &end);
+        if (end == line + 4)
+        {
+            printf("Servo calibration: bad angle \"%s\"\n", line + 4);
+        }
+        else if (!servo_calib_record(measured_angle_deg))
+        {
+            printf("Servo calibration: not running, press KEY_3 to start\n");
+        }
+        else if (SERVO_CALIB_RUNNING == servo_calib_get_state())
+        {
+            printf("Servo calibration: point %u, send \"cal <deg>\"\n", servo_calib_get_point_index());
+        }
+        else
+        {
+            printf("Servo calibration: %s\n", (SERVO_CALIB_DONE == servo_calib_get_state()) ? "done" : "failed");
+        }
+    }
+}
 
 /**
- * @brief  导航控制循环的中断服务程序 (ISR - Interrupt Service Routine)
+ * @brief  读取调试串口接收缓冲区，按行 ('\r' 或 '\n' 结尾) 交给 debug_command_execute
+ * @note   在主循环中调用，每次取完缓冲区中已有的字节，不等待。
  */
-void navigation_isr_callback(uint32_t event, void *ptr)
+static void debug_command_poll(void)
 {
-    (void)event;
-    (void)ptr;
+    static char     line[DEBUG_COMMAND_LINE_MAX];
+    static uint8_t  length = 0;
+    static bool     overflow = false;
+    uint8_t data;
 
-    // 1. 调用RTK数据任务函数，检查并解析新数据
-    if (bsp_rtk_data_task())
+    while (bsp_uart_read_byte(BSP_UART_DEBUG, &data))
     {
-        // 2. 只有在确认有新的、有效的数据时，才执行导航计算
-        gnss_info_struct rtk_info = bsp_rtk_get_info();
-
-        // 将这份新鲜的数据传递给导航计算函数
-        navigation_run_once(&rtk_info);
+        if ('\r' == data || '\n' == data)
+        {
+            if (length > 0 && !overflow)
+            {
+                line[length] = '\0';
+                debug_command_execute(line);
+            }
+            length = 0;
+            overflow = false;
+        }
+        else if (length < DEBUG_COMMAND_LINE_MAX - 1)
+        {
+            line[length++] = (char)data;
+        }
+        else
+        {
+            overflow = true;
+        }
     }
-    // 如果 bsp_rtk_data_task() 返回false，本周期内不做任何导航计算
-
-    // 3. 中断计数器自增
-    g_navigation_tick_count++;
 }
 
 // ================== 主函数 ==================
@@ -54,28 +103,95 @@ int main(void)
 {
     // 1. 系统级初始化
     zf_system_clock_init(SYSTEM_CLOCK_300M);
+    zf_watermark_init(); // 填充栈用于统计最大栈深，需在其他初始化之前调用
+    zf_profile_init();  // 中断耗时统计 (ZF_PROFILE_ENABLE 为 0 时仅使能 DWT 计数器)
+    zf_trace_init();    // 事件跟踪 (ZF_TRACE_ENABLE 为 0 时不记录任何事件)，由调度器的 trace 任务输出，用 tools/trace2chrome 转换后在 Perfetto 中查看
     // [AI-COMMENT] 你的 bsp_uart_init 函数需要一个参数，假设是 BSP_UART_DEBUG
     bsp_uart_init(BSP_UART_DEBUG, 460800);
+    topic_init();
 
     // 2. 运动与导航系统初始化
     bsp_rtk_init();
     speed_control_init();
     navigation_init(); // 调用 navigation_init
+    latency_trace_init(); // 定位到舵机输出的延迟跟踪 (LATENCY_TRACE_ENABLE 为 0 时为空操作)
+    imu_sampler_init();   // IMU FIFO 中断 + SPI DMA 采集 (IMU_SAMPLER_ENABLE 为 0 时为空操作)
 
-    // 3. 初始化并启动导航定时器中断 (10Hz)
-    zf_pit_ms_init(PIT_TIM5, 100, navigation_isr_callback, NULL);
+    // 3. 启动任务调度器 (速度环 100Hz / 导航 10Hz，见 scheduler.h 任务表)
+    scheduler_init();
 
     // 4. 打印启动信息
     printf("\r\n============================================\r\n");
     printf("=       RTK Autonomous Navigation Test       =\r\n");
     printf("============================================\r\n");
-    printf("System Initialized. Navigation ISR is running at 10Hz.\r\n");
+    printf("System Initialized. Navigation task is running at 10Hz.\r\n");
     printf("Please ensure the vehicle is in a safe, open area.\r\n\r\n");
+    ring_benchmark_run(); // zf_ring 与 zf_fifo 读写耗时对比 (RING_BENCHMARK_ENABLE 为 0 时为空操作)
+    pid_benchmark_run();  // pid_ctrl_update 单次调用周期数 (PID_BENCHMARK_ENABLE 为 0 时为空操作)
 
     // 5. 主循环
     for (;;)
     {
         // 可以在这里添加一些低优先级的任务，比如状态显示
+        speed_control_background_task();
+        servo_calib_background_task();
+        steering_estimator_background_task();
+        scheduler_background_task();
+        latency_trace_background_task();
+        imu_sampler_background_task();
+        debug_command_poll();
+#if ZF_PROFILE_ENABLE && SCHED_KEY_TASK_ENABLE
+        // KEY_1 短按输出中断耗时统计并开始新的统计窗口
+        if (KEY_SHORT_PRESS == key_get_state(KEY_1))
+        {
+            key_clear_state(KEY_1);
+            zf_profile_dump();
+            zf_profile_reset();
+        }
+#endif
+#if SCHED_KEY_TASK_ENABLE
+        // KEY_1 长按以当前规划速度为工作点启动速度环自整定，车需先以该速度稳定行驶 (车轮悬空或场地安全)
+        // 完成后新增益立即生效，并由 speed_control_background_task 写入 FLASH
+        if (KEY_LONG_PRESS == key_get_state(KEY_1))
+        {
+            key_clear_state(KEY_1);
+            const float setpoint_cmps = speed_control_get_planned_speed();
+            if (setpoint_cmps >= MOTOR_AUTOTUNE_MIN_SPEED_CMPS)
+            {
+                printf("Autotune: start at %.1f cm/s\n", setpoint_cmps);
+                speed_control_autotune_start(setpoint_cmps);
+            }
+            else
+            {
+                printf("Autotune: ignored, planned speed %.1f cm/s below %.1f cm/s\n",
+                       setpoint_cmps, MOTOR_AUTOTUNE_MIN_SPEED_CMPS);
+            }
+        }
+
+        // KEY_2 短按输出栈 / 内存池 / FIFO 的历史最大占用
+        if (KEY_SHORT_PRESS == key_get_state(KEY_2))
+        {
+            key_clear_state(KEY_2);
+            zf_watermark_report();
+        }
+
+        // KEY_3 短按开始舵机标定，标定中再按一次放弃 (沿用原表，舵机回中)
+        // 标定期间导航不输出舵机指令，每个标定点的实测转角通过调试串口 "cal <deg>" 命令记录
+        if (KEY_SHORT_PRESS == key_get_state(KEY_3))
+        {
+            key_clear_state(KEY_3);
+            if (SERVO_CALIB_RUNNING == servo_calib_get_state())
+            {
+                servo_calib_cancel();
+                printf("Servo calibration: cancelled\n");
+            }
+            else
+            {
+                servo_calib_start();
+                printf("Servo calibration: point 0, send \"cal <deg>\"\n");
+            }
+        }
+#endif
         zf_delay_ms(200);
     }
 }
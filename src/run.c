@@ -19,6 +19,8 @@ int main(void)
     // 预期现象：舵机在正中间，车轮静止
     zf_delay_ms(3000);
 
+    // 本测试不运行调度器，每个动作后手动提交 PWM (motion_set_xxx 只暂存)
+
     // ==========================================================
     // =================== 开始自动化测试序列 ===================
     // ==========================================================
@@ -26,49 +28,61 @@ int main(void)
     // --- 测试 1: 直行前进 ---
     // 功能验证: motion_set_motor_speed() 是否能驱动电机以指定速度前进
     motion_set_motor_speed(TEST_MOTOR_SPEED);
+    motion_control_commit();
     zf_delay_ms(TEST_DELAY_MS);
 
     // --- 测试 2: 直行后退 ---
     // 功能验证: motion_set_motor_speed() 是否能驱动电机以指定速度后退
     motion_set_motor_speed(-TEST_MOTOR_SPEED);
+    motion_control_commit();
     zf_delay_ms(TEST_DELAY_MS);
 
     // 动作间暂停，方便观察
     motion_set_motor_speed(0);
+    motion_control_commit();
     zf_delay_ms(1000);
 
     // --- 测试 3: 舵机左转 (原地) ---
     // 功能验证: motion_set_servo_angle() 是否能精确控制舵机向左转
     motion_set_servo_angle(TEST_SERVO_ANGLE);
+    motion_control_commit();
     zf_delay_ms(TEST_DELAY_MS);
 
     // --- 测试 4: 舵机右转 (原地) ---
     // 功能验证: motion_set_servo_angle() 是否能精确控制舵机向右转
     motion_set_servo_angle(-TEST_SERVO_ANGLE);
+    motion_control_commit();
     zf_delay_ms(TEST_DELAY_MS);
 
     // 动作间暂停，舵机回中
     motion_set_servo_angle(0.0f);
+    motion_control_commit();
     zf_delay_ms(1000);
 
     // --- 测试 5: 左转弯前进 (组合动作) ---
     // 功能验证: 电机和舵机是否能同时协调工作
     motion_set_servo_angle(TEST_SERVO_ANGLE); // 先打方向
+    motion_control_commit();
     zf_delay_ms(500);                         // 稍作停顿，确保舵机到位
     motion_set_motor_speed(TEST_MOTOR_SPEED); // 再给油门
+    motion_control_commit();
     zf_delay_ms(TEST_DELAY_MS);
 
     // --- 测试 6: 右转弯后退 (组合动作) ---
     // 功能验证: 反向的组合动作
     motion_set_servo_angle(-TEST_SERVO_ANGLE); // 先打方向
+    motion_control_commit();
     zf_delay_ms(500);                          // 稍作停顿
     motion_set_motor_speed(-TEST_MOTOR_SPEED); // 再给倒车油门
+    motion_control_commit();
     zf_delay_ms(TEST_DELAY_MS);
 
 
     // --- 测试结束，恢复安全状态 ---
     motion_set_motor_speed(0);
+    motion_control_commit();
     motion_set_servo_angle(0.0f);
+    motion_control_commit();
 
     for (;;)
     {
@@ -4,7 +4,9 @@
  *************************************************************************************************/
 #include "zf_libraries_headfile.h"
 #include "systick.h"        // [重要] 确保包含ST官方的systick头文件
+#include "bsp_uart.h"
 #include "speed_control.h"
+#include "scheduler.h"      // 速度环由调度器的 CONTROL 级任务周期调用
 #include <stdio.h>
 
 int main(void)
@@ -18,6 +20,10 @@ int main(void)
     // --- 2. 速度控制模块初始化 ---
     speed_control_init();
 
+    // 启动任务调度器，speed_control_task 开始按 CONTROL_PERIOD_MS 运行
+    // 未初始化 RTK，导航任务收不到定位数据，不会改写目标速度
+    scheduler_init();
+
     // --- 3. 开始测试 ---
     systick_delay_millisec(&DRV_SYSTICK, 1000);
     printf("\n\n--- PID Direct Analysis Test ---\n");
@@ -29,9 +35,10 @@ int main(void)
     printf("--- Test Started. Target = 50.0 cm/s ---\n");
 
     // --- 4. 等待 ---
-    // 所有工作都在中断中完成，主循环空闲。
+    // 控制计算都在调度器的中断中完成，主循环只处理后台任务。
     for (;;)
     {
-        // 可以执行一些低优先级任务，或者保持空闲
+        speed_control_background_task();
+        scheduler_background_task();
     }
 }
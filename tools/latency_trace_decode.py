@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+latency_trace_decode.py
+
+解析调试串口日志中 latency_trace 输出的 "$LT,<编号>,<阶段>,<时间戳us>" 行，
+按跟踪编号拼接成 RX_EOL -> PARSED -> PUBLISHED -> NAV_DONE -> PWM_COMMIT 链，
+统计相邻阶段之间以及端到端的延迟分布。
+
+用法:
+    python3 tools/latency_trace_decode.py serial.log
+    cat serial.log | python3 tools/latency_trace_decode.py --hist
+    python3 tools/latency_trace_decode.py serial.log --csv chains.csv
+
+日志中的其他打印会被忽略，被其他打印截断的行按无效行计数。
+"""
+
+import argparse
+import re
+import sys
+
+# 与 user_code/latency_trace.h 中 latency_trace_stage_e 保持一致
+STAGES = ["RX_EOL", "PARSED", "PUBLISHED", "NAV_DONE", "PWM_COMMIT"]
+
+RECORD_RE = re.compile(r"\$LT,(\d+),(\d+),(\d+)\s*$")
+DROP_RE = re.compile(r"\$LT,DROP,(\d+)\s*$")
+
+
+def elapsed_us(start, end):
+    """时间戳为 32 位无符号微秒计数，按回绕处理"""
+    return (end - start) & 0xFFFFFFFF
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return 0
+    index = min(len(sorted_values) - 1, int(round(fraction * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def read_chains(lines):
+    """返回 (完整或部分的链列表, 统计信息)。每条链为 {阶段编号: 时间戳}"""
+    chains = []
+    open_chains = {}
+    stats = {"records": 0, "dropped": 0, "malformed": 0}
+
+    for line in lines:
+        if "$LT," not in line:
+            continue
+        drop = DROP_RE.search(line)
+        if drop:
+            stats["dropped"] += int(drop.group(1))
+            continue
+        match = RECORD_RE.search(line)
+        if not match:
+            stats["malformed"] += 1
+            continue
+
+        trace_id, stage, timestamp = (int(v) for v in match.groups())
+        if stage >= len(STAGES):
+            stats["malformed"] += 1
+            continue
+        stats["records"] += 1
+
+        # 编号为 16 位，回绕后同一编号会再次出现，以 RX_EOL 作为新链的开始
+        if stage == 0 or trace_id not in open_chains:
+            chain = {"id": trace_id, "points": {}}
+            open_chains[trace_id] = chain
+            chains.append(chain)
+        open_chains[trace_id]["points"][stage] = timestamp
+
+    return chains, stats
+
+
+def summarize(name, values, show_hist):
+    values = sorted(values)
+    if not values:
+        print("  %-26s      n=0" % name)
+        return
+    mean = sum(values) / len(values)
+    print("  %-26s n=%6d  min=%8d  mean=%10.1f  p50=%8d  p90=%8d  p99=%8d  max=%8d"
+          % (name, len(values), values[0], mean,
+             percentile(values, 0.50), percentile(values, 0.90), percentile(values, 0.99), values[-1]))
+    if show_hist:
+        # 以 2 为底的对数分桶，与固件中断耗时直方图一致
+        bins = {}
+        for v in values:
+            bins[v.bit_length()] = bins.get(v.bit_length(), 0) + 1
+        peak = max(bins.values())
+        for bit in range(min(bins), max(bins) + 1):
+            count = bins.get(bit, 0)
+            low = 0 if bit == 0 else 1 << (bit - 1)
+            print("      [%8d, %8d) %6d %s" % (low, 1 << bit, count, "#" * (count * 50 // peak)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="GNSS 到舵机输出的端到端延迟统计")
+    parser.add_argument("logs", nargs="*", help="串口日志文件，缺省从标准输入读取")
+    parser.add_argument("--hist", action="store_true", help="输出每个区间的对数直方图")
+    parser.add_argument("--csv", help="把每条链各阶段的时间戳写入 CSV 文件")
+    args = parser.parse_args()
+
+    lines = []
+    if args.logs:
+        for path in args.logs:
+            with open(path, "r", encoding="utf-8", errors="replace") as f:
+                lines.extend(f)
+    else:
+        lines = sys.stdin.readlines()
+
+    chains, stats = read_chains(lines)
+
+    intervals = [(i, i + 1) for i in range(len(STAGES) - 1)] + [(0, len(STAGES) - 1)]
+    samples = {interval: [] for interval in intervals}
+    complete = 0
+    for chain in chains:
+        points = chain["points"]
+        if len(points) == len(STAGES):
+            complete += 1
+        for start, end in intervals:
+            if start in points and end in points:
+                samples[(start, end)].append(elapsed_us(points[start], points[end]))
+
+    print("records=%d chains=%d complete=%d incomplete=%d dropped_on_target=%d malformed_lines=%d"
+          % (stats["records"], len(chains), complete, len(chains) - complete, stats["dropped"], stats["malformed"]))
+    print("latency (us):")
+    for start, end in intervals:
+        summarize("%s -> %s" % (STAGES[start], STAGES[end]), samples[(start, end)], args.hist)
+
+    if args.csv:
+        with open(args.csv, "w", encoding="utf-8") as f:
+            f.write("trace_id," + ",".join(STAGES) + "\n")
+            for chain in chains:
+                f.write("%d,%s\n" % (chain["id"], ",".join(str(chain["points"].get(i, "")) for i in range(len(STAGES)))))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
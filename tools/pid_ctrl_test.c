@@ -0,0 +1,273 @@
+/*
+ * pid_ctrl_test.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] pid_ctrl 的上位机单元测试，只依赖 user_code/pid.c，不需要 SDK。
+ *            覆盖: 输出限幅与变化率限制、反算/条件积分抗饱和、微分先行 (gamma = 0) 与微分低通。
+ *            浮点与 Q16.16 定点两种数值类型都要通过:
+ *              gcc -std=c99 -Wall -Iuser_code tools/pid_ctrl_test.c user_code/pid.c -lm -o pid_ctrl_test && ./pid_ctrl_test
+ *              gcc -std=c99 -Wall -Iuser_code -DPID_CTRL_FIXED_POINT=1 tools/pid_ctrl_test.c user_code/pid.c -lm -o pid_ctrl_test_q16 && ./pid_ctrl_test_q16
+ *            全部通过时返回 0，否则打印失败项并返回 1。
+ *            目标板上的单次调用周期数由 user_code/pid_benchmark.c 用 DWT 计数器测量。
+ */
+
+#include "pid.h"
+#include <stdio.h>
+#include <math.h>
+
+// 定点量化误差 1/65536，多次累加后放宽到 1e-3
+#if PID_CTRL_FIXED_POINT
+#define TEST_TOLERANCE      (1e-3f)
+#else
+#define TEST_TOLERANCE      (1e-5f)
+#endif
+
+static int g_fail_count = 0;
+static int g_check_count = 0;
+
+#define CHECK(cond, ...)                                                    \
+    do {                                                                    \
+        g_check_count++;                                                    \
+        if (!(cond)) {                                                      \
+            g_fail_count++;                                                 \
+            printf("FAIL %s:%d: ", __func__, __LINE__);                     \
+            printf(__VA_ARGS__);                                            \
+            printf("\n");                                                   \
+        }                                                                   \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, ...)                                   \
+    CHECK(fabsf((actual) - (expected)) <= TEST_TOLERANCE, __VA_ARGS__)
+
+// ================== 辅助函数 ==================
+
+/**
+ * @brief 纯 P/I/D 的基础配置，各测试在此基础上修改
+ */
+static pid_ctrl_config_t test_base_config(pid_mode_e mode)
+{
+    const pid_ctrl_config_t cfg = {
+        .mode           = mode,
+        .kp             = PID_REAL(0.0f),
+        .ki             = PID_REAL(0.0f),
+        .kd             = PID_REAL(0.0f),
+        .kb             = PID_REAL(0.0f),
+        .beta           = PID_REAL(1.0f),
+        .gamma          = PID_REAL(0.0f),
+        .d_filter_alpha = PID_REAL(1.0f),
+        .kff_static     = PID_REAL(0.0f),
+        .kff_velocity   = PID_REAL(0.0f),
+        .out_min        = PID_REAL(-100.0f),
+        .out_max        = PID_REAL(100.0f),
+        .rate_limit     = PID_REAL(0.0f),
+    };
+    return cfg;
+}
+
+static float test_update(pid_ctrl_t *pid, float setpoint, float measurement)
+{
+    return PID_TO_FLOAT(pid_ctrl_update(pid, PID_REAL(setpoint), PID_REAL(measurement), PID_REAL(0.0f)));
+}
+
+// ================== 输出限幅 ==================
+
+static void test_output_limits(pid_mode_e mode)
+{
+    pid_ctrl_config_t cfg = test_base_config(mode);
+    cfg.kp = PID_REAL(2.0f);
+    cfg.ki = PID_REAL(0.5f);
+    cfg.kb = PID_REAL(0.25f);
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    // 误差远大于限幅，输出停在上下限，不越界
+    for (int k = 0; k < 50; k++)
+    {
+        float u = test_update(&pid, 1000.0f, 0.0f);
+        CHECK(u <= 100.0f, "mode %d step %d: u = %f above out_max", mode, k, u);
+    }
+    CHECK_NEAR(test_update(&pid, 1000.0f, 0.0f), 100.0f, "mode %d: not at out_max", mode);
+
+    for (int k = 0; k < 50; k++)
+    {
+        float u = test_update(&pid, -1000.0f, 0.0f);
+        CHECK(u >= -100.0f, "mode %d step %d: u = %f below out_min", mode, k, u);
+    }
+    CHECK_NEAR(test_update(&pid, -1000.0f, 0.0f), -100.0f, "mode %d: not at out_min", mode);
+
+    // 运行时收紧限幅立即生效
+    pid_ctrl_set_output_limits(&pid, PID_REAL(-30.0f), PID_REAL(30.0f));
+    CHECK_NEAR(test_update(&pid, -1000.0f, 0.0f), -30.0f, "mode %d: tightened limit ignored", mode);
+}
+
+static void test_rate_limit(void)
+{
+    pid_ctrl_config_t cfg = test_base_config(PID_MODE_POSITIONAL);
+    cfg.kp = PID_REAL(1.0f);
+    cfg.rate_limit = PID_REAL(5.0f);
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    // 设定值阶跃到 40，输出每周期最多变化 5，8 个周期后到达
+    float last = 0.0f;
+    for (int k = 0; k < 8; k++)
+    {
+        float u = test_update(&pid, 40.0f, 0.0f);
+        CHECK_NEAR(u - last, 5.0f, "step %d: slew %f != 5", k, u - last);
+        last = u;
+    }
+    CHECK_NEAR(test_update(&pid, 40.0f, 0.0f), 40.0f, "did not settle at kp * e");
+}
+
+/**
+ * @brief 增量式被限速截掉的增量不会补回，只检查每周期变化量不超限，由积分项最终收敛
+ */
+static void test_rate_limit_incremental(void)
+{
+    pid_ctrl_config_t cfg = test_base_config(PID_MODE_INCREMENTAL);
+    cfg.kp = PID_REAL(1.0f);
+    cfg.ki = PID_REAL(0.5f);
+    cfg.rate_limit = PID_REAL(5.0f);
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    float last = test_update(&pid, 0.0f, 0.0f);
+    float u = last;
+    for (int k = 0; k < 50; k++)
+    {
+        u = test_update(&pid, 40.0f, 0.0f);
+        CHECK(fabsf(u - last) <= 5.0f + TEST_TOLERANCE, "step %d: slew %f above 5", k, u - last);
+        last = u;
+    }
+    CHECK_NEAR(u, 100.0f, "integral did not drive output to out_max");
+}
+
+// ================== 抗积分饱和 ==================
+
+/**
+ * @brief 长时间饱和后反向，输出应在几个周期内离开饱和，而不是等积分慢慢退回来
+ */
+static void test_anti_windup(pid_mode_e mode, float kb)
+{
+    pid_ctrl_config_t cfg = test_base_config(mode);
+    cfg.kp = PID_REAL(1.0f);
+    cfg.ki = PID_REAL(0.5f);
+    cfg.kb = PID_REAL(kb);
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    // 误差 200 持续 500 个周期: 不抗饱和时积分会涨到 5e4
+    for (int k = 0; k < 500; k++)
+    {
+        test_update(&pid, 200.0f, 0.0f);
+    }
+    if (PID_MODE_POSITIONAL == mode)
+    {
+        float integral = PID_TO_FLOAT(pid.integral);
+        CHECK(integral <= 100.0f + 100.0f, "kb %.2f: integral wound up to %f", kb, integral);
+    }
+
+    // 设定值反向: 误差 -10，理想情况下 u = kp*e + I 立刻掉出上限
+    int steps_to_leave = -1;
+    for (int k = 0; k < 50; k++)
+    {
+        float u = test_update(&pid, -10.0f, 0.0f);
+        if (u < 100.0f - TEST_TOLERANCE)
+        {
+            steps_to_leave = k;
+            break;
+        }
+    }
+    CHECK(steps_to_leave >= 0 && steps_to_leave <= 3,
+          "mode %d kb %.2f: left saturation after %d steps", mode, kb, steps_to_leave);
+}
+
+// ================== 微分先行 ==================
+
+static void test_derivative_on_measurement(pid_mode_e mode)
+{
+    pid_ctrl_config_t cfg = test_base_config(mode);
+    cfg.kd = PID_REAL(2.0f);
+    cfg.gamma = PID_REAL(0.0f);
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    // 首次调用不计算微分
+    CHECK_NEAR(test_update(&pid, 0.0f, 0.0f), 0.0f, "mode %d: first call not zero", mode);
+
+    // 设定值阶跃，测量不变: gamma = 0 时 D 项只看测量值，没有冲击
+    float u = test_update(&pid, 50.0f, 0.0f);
+    CHECK_NEAR(u, 0.0f, "mode %d: derivative kick %f on setpoint step", mode, u);
+    CHECK_NEAR(PID_TO_FLOAT(pid.d_term), 0.0f, "mode %d: d_term moved on setpoint step", mode);
+
+    // 测量值上升 3: D = -kd * dy = -6
+    test_update(&pid, 50.0f, 3.0f);
+    CHECK_NEAR(PID_TO_FLOAT(pid.d_term), -6.0f, "mode %d: d_term %f != -6", mode, PID_TO_FLOAT(pid.d_term));
+
+    // 对照: gamma = 1 时同样的设定值阶跃会产生 kd * dr 的冲击
+    cfg.gamma = PID_REAL(1.0f);
+    pid_ctrl_init(&pid, &cfg);
+    test_update(&pid, 0.0f, 0.0f);
+    test_update(&pid, 50.0f, 0.0f);
+    CHECK_NEAR(PID_TO_FLOAT(pid.d_term), 100.0f, "mode %d: gamma = 1 kick %f != 100", mode, PID_TO_FLOAT(pid.d_term));
+}
+
+static void test_derivative_filter(void)
+{
+    pid_ctrl_config_t cfg = test_base_config(PID_MODE_POSITIONAL);
+    cfg.kd = PID_REAL(1.0f);
+    cfg.d_filter_alpha = PID_REAL(0.25f);
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    // 测量值单次跳变 -8: 原始 D = 8，一阶低通后依次为 2, 1.5, 1.125
+    test_update(&pid, 0.0f, 0.0f);
+    test_update(&pid, 0.0f, -8.0f);
+    CHECK_NEAR(PID_TO_FLOAT(pid.d_term), 2.0f, "filtered d_term %f != 2", PID_TO_FLOAT(pid.d_term));
+    test_update(&pid, 0.0f, -8.0f);
+    CHECK_NEAR(PID_TO_FLOAT(pid.d_term), 1.5f, "filtered d_term %f != 1.5", PID_TO_FLOAT(pid.d_term));
+    test_update(&pid, 0.0f, -8.0f);
+    CHECK_NEAR(PID_TO_FLOAT(pid.d_term), 1.125f, "filtered d_term %f != 1.125", PID_TO_FLOAT(pid.d_term));
+}
+
+// ================== 无扰切换 ==================
+
+static void test_bumpless_reset(void)
+{
+    pid_ctrl_config_t cfg = test_base_config(PID_MODE_POSITIONAL);
+    cfg.kp = PID_REAL(1.0f);
+    cfg.ki = PID_REAL(0.1f);
+    cfg.kd = PID_REAL(1.0f);
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    // 预置输出 42，误差为 0 时下一周期输出保持 42
+    pid_ctrl_reset(&pid, PID_REAL(42.0f));
+    CHECK_NEAR(test_update(&pid, 10.0f, 10.0f), 42.0f, "reset output not held");
+
+    // 预置值超出限幅时被截断
+    pid_ctrl_reset(&pid, PID_REAL(500.0f));
+    CHECK_NEAR(PID_TO_FLOAT(pid.output), 100.0f, "reset output not clamped");
+}
+
+int main(void)
+{
+    printf("pid_ctrl test (%s)\n", PID_CTRL_FIXED_POINT ? "Q16.16" : "float");
+
+    test_output_limits(PID_MODE_POSITIONAL);
+    test_output_limits(PID_MODE_INCREMENTAL);
+    test_rate_limit();
+    test_rate_limit_incremental();
+    test_anti_windup(PID_MODE_POSITIONAL, 0.5f);    // 反算
+    test_anti_windup(PID_MODE_POSITIONAL, 0.0f);    // 条件积分
+    test_anti_windup(PID_MODE_INCREMENTAL, 0.0f);   // 增量式对饱和后的输出累加
+    test_derivative_on_measurement(PID_MODE_POSITIONAL);
+    test_derivative_on_measurement(PID_MODE_INCREMENTAL);
+    test_derivative_filter();
+    test_bumpless_reset();
+
+    printf("%d checks, %d failed\n", g_check_count, g_fail_count);
+    return (0 == g_fail_count) ? 0 : 1;
+}
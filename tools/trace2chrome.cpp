@@ -0,0 +1,402 @@
+// trace2chrome.cpp
+//
+// 把 zf_common_trace 从 debug 串口输出的二进制事件帧转换为 Chrome trace JSON，
+// 可直接拖入 https://ui.perfetto.dev 或 chrome://tracing 查看中断/任务的嵌套与交错。
+//
+// 编译:  g++ -std=c++17 -O2 -o trace2chrome tools/trace2chrome.cpp
+// 用法:  trace2chrome capture.bin [-o trace.json] [--clock 300000000]
+//
+// capture.bin 为串口原始数据 (任意串口工具以二进制方式保存)，其中夹杂的 printf 文本会被跳过。
+// 帧格式见 libraries/zf_common/zf_common_trace.h 文件头说明。
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// 与 zf_common_trace.h 保持一致
+constexpr uint8_t kFrameHead0 = 0xA5;
+constexpr uint8_t kFrameHead1 = 0x5A;
+constexpr size_t kFrameHeadSize = 5;
+constexpr size_t kFramePayloadMax = 4096;
+constexpr size_t kRecordSize = 8;
+
+enum FrameType : uint8_t
+{
+    kFrameInfo = 1,
+    kFrameName = 2,
+    kFrameEvents = 3,
+};
+
+enum EventType : uint8_t
+{
+    kIsrEnter = 1,
+    kIsrExit,
+    kTaskEnter,
+    kTaskExit,
+    kMarker,
+    kCounter,
+};
+
+enum Kind : uint8_t
+{
+    kKindIsr = 0,
+    kKindTask,
+    kKindMarker,
+    kKindCounter,
+    kKindNum,
+};
+
+const char *const kKindLabel[kKindNum] = {"isr", "task", "marker", "counter"};
+
+struct Event
+{
+    uint64_t cycles;    // 展开后的 64 位周期计数
+    uint8_t type;
+    uint8_t id;
+    int16_t value;
+};
+
+// 输出到 JSON 之前的事件，名称在全部帧读完后再解析 (名称帧可能晚于事件到达)
+struct OutputEvent
+{
+    char phase;         // B / E / i / C
+    Kind kind;
+    uint8_t id;
+    uint64_t cycles;
+    int32_t value;
+    std::string label;  // 非空时直接作为名称 (丢弃提示等)
+};
+
+uint32_t ReadU32(const uint8_t *p)
+{
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+std::string JsonEscape(const std::string &text)
+{
+    std::string out;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            out += buffer;
+        }
+        else
+        {
+            out += c;
+        }
+    }
+    return out;
+}
+
+class Converter
+{
+public:
+    Converter(double clock_hz, bool clock_fixed) : clock_hz_(clock_hz), clock_fixed_(clock_fixed) {}
+
+    void Feed(const std::vector<uint8_t> &data)
+    {
+        size_t pos = 0;
+        while (pos + kFrameHeadSize + 1 <= data.size())
+        {
+            if (data[pos] != kFrameHead0 || data[pos + 1] != kFrameHead1)
+            {
+                pos++;
+                continue;
+            }
+            const uint8_t type = data[pos + 2];
+            const size_t length = static_cast<size_t>(data[pos + 3]) | (static_cast<size_t>(data[pos + 4]) << 8);
+            if (length > kFramePayloadMax || pos + kFrameHeadSize + length + 1 > data.size())
+            {
+                pos++;
+                continue;
+            }
+            uint8_t checksum = 0;
+            for (size_t i = pos + 2; i < pos + kFrameHeadSize + length; i++)
+            {
+                checksum = static_cast<uint8_t>(checksum + data[i]);
+            }
+            if (checksum != data[pos + kFrameHeadSize + length])
+            {
+                bad_frames_++;
+                pos++;
+                continue;
+            }
+
+            HandleFrame(type, &data[pos + kFrameHeadSize], length);
+            good_frames_++;
+            pos += kFrameHeadSize + length + 1;
+        }
+    }
+
+    void Write(std::ostream &out)
+    {
+        CloseOpenSlices();
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        out << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":1,\"args\":{\"name\":\"SR5E1\"}},\n";
+        out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}}";
+
+        const double cycles_per_us = clock_hz_ / 1e6;
+        for (const OutputEvent &event : events_)
+        {
+            const double ts = static_cast<double>(event.cycles - first_cycles_) / cycles_per_us;
+            const std::string name = JsonEscape(event.label.empty() ? Name(event.kind, event.id) : event.label);
+            char ts_text[32];
+            std::snprintf(ts_text, sizeof(ts_text), "%.3f", ts);
+
+            out << ",\n{\"name\":\"" << name << "\",\"cat\":\"" << kKindLabel[event.kind]
+                << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << ts_text << ",\"pid\":1";
+            if (event.phase == 'C')
+            {
+                out << ",\"args\":{\"value\":" << event.value << "}}";
+            }
+            else if (event.phase == 'i')
+            {
+                out << ",\"tid\":1,\"s\":\"" << (event.label.empty() ? "t" : "g") << "\"}";
+            }
+            else
+            {
+                out << ",\"tid\":1}";
+            }
+        }
+        out << "\n]}\n";
+    }
+
+    void PrintSummary(std::ostream &out) const
+    {
+        out << "frames=" << good_frames_ << " bad_frames=" << bad_frames_ << " events=" << event_count_
+            << " dropped_on_target=" << dropped_total_ << " unmatched_exits=" << unmatched_exits_
+            << " clock_hz=" << static_cast<uint64_t>(clock_hz_) << "\n";
+    }
+
+private:
+    void HandleFrame(uint8_t type, const uint8_t *payload, size_t length)
+    {
+        switch (type)
+        {
+            case kFrameInfo:
+                if (length >= 12)
+                {
+                    const uint32_t clock = ReadU32(payload);
+                    const uint32_t dropped = ReadU32(payload + 4);
+                    if (clock != 0 && !clock_fixed_) clock_hz_ = clock;
+                    if (dropped > dropped_total_)
+                    {
+                        // 丢弃发生在已缓存事件之后，标记在最近一个事件的位置，后续嵌套由配对检查修正
+                        OutputEvent gap{'i', kKindMarker, 0, last_cycles_, 0, ""};
+                        gap.label = "trace overflow: " + std::to_string(dropped - dropped_total_) + " events dropped";
+                        if (have_time_) events_.push_back(gap);
+                        dropped_total_ = dropped;
+                    }
+                }
+                break;
+
+            case kFrameName:
+                if (length >= 2 && payload[0] < kKindNum)
+                {
+                    names_[{payload[0], payload[1]}] = std::string(reinterpret_cast<const char *>(payload + 2), length - 2);
+                }
+                break;
+
+            case kFrameEvents:
+                for (size_t offset = 0; offset + kRecordSize <= length; offset += kRecordSize)
+                {
+                    const uint8_t *p = payload + offset;
+                    const int16_t value = static_cast<int16_t>(static_cast<uint16_t>(p[6]) | (static_cast<uint16_t>(p[7]) << 8));
+                    HandleEvent(Event{Unwrap(ReadU32(p)), p[4], p[5], value});
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    // 32 位周期计数展开为 64 位，要求相邻事件间隔小于一个回绕周期 (300MHz 时约 14 秒)
+    uint64_t Unwrap(uint32_t timestamp)
+    {
+        if (!have_time_)
+        {
+            have_time_ = true;
+            first_cycles_ = timestamp;
+            last_cycles_ = timestamp;
+        }
+        else
+        {
+            last_cycles_ += static_cast<uint32_t>(timestamp - last_raw_);
+        }
+        last_raw_ = timestamp;
+        return last_cycles_;
+    }
+
+    void HandleEvent(const Event &event)
+    {
+        event_count_++;
+        switch (event.type)
+        {
+            case kIsrEnter:
+            case kTaskEnter:
+            {
+                const Kind kind = (event.type == kIsrEnter) ? kKindIsr : kKindTask;
+                stack_.push_back({kind, event.id});
+                events_.push_back({'B', kind, event.id, event.cycles, 0, ""});
+                break;
+            }
+            case kIsrExit:
+            case kTaskExit:
+            {
+                const Kind kind = (event.type == kIsrExit) ? kKindIsr : kKindTask;
+                // 单核上的中断/任务严格后进先出；因丢弃而不配对时先结束栈顶多出的区间，找不到则忽略
+                size_t depth = stack_.size();
+                while (depth > 0 && stack_[depth - 1] != std::make_pair(kind, event.id)) depth--;
+                if (depth == 0)
+                {
+                    unmatched_exits_++;
+                    break;
+                }
+                while (stack_.size() >= depth)
+                {
+                    events_.push_back({'E', stack_.back().first, stack_.back().second, event.cycles, 0, ""});
+                    stack_.pop_back();
+                }
+                break;
+            }
+            case kMarker:
+                events_.push_back({'i', kKindMarker, event.id, event.cycles, 0, ""});
+                break;
+            case kCounter:
+                events_.push_back({'C', kKindCounter, event.id, event.cycles, event.value, ""});
+                break;
+            default:
+                break;
+        }
+    }
+
+    void CloseOpenSlices()
+    {
+        while (!stack_.empty())
+        {
+            events_.push_back({'E', stack_.back().first, stack_.back().second, last_cycles_, 0, ""});
+            stack_.pop_back();
+        }
+    }
+
+    std::string Name(Kind kind, uint8_t id) const
+    {
+        const auto it = names_.find({kind, id});
+        if (it != names_.end() && !it->second.empty()) return it->second;
+        return std::string(kKindLabel[kind]) + "#" + std::to_string(id);
+    }
+
+    double clock_hz_;
+    bool clock_fixed_;
+    std::map<std::pair<uint8_t, uint8_t>, std::string> names_;
+    std::vector<std::pair<Kind, uint8_t>> stack_;
+    std::vector<OutputEvent> events_;
+
+    bool have_time_ = false;
+    uint32_t last_raw_ = 0;
+    uint64_t first_cycles_ = 0;
+    uint64_t last_cycles_ = 0;
+
+    uint64_t good_frames_ = 0;
+    uint64_t bad_frames_ = 0;
+    uint64_t event_count_ = 0;
+    uint64_t unmatched_exits_ = 0;
+    uint32_t dropped_total_ = 0;
+};
+
+void PrintUsage(const char *program)
+{
+    std::cerr << "usage: " << program << " capture.bin [-o trace.json] [--clock HZ]\n"
+              << "  --clock HZ  内核频率，缺省使用信息帧中的值 (尚未收到时按 300MHz)\n";
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    std::string input_path;
+    std::string output_path;
+    double clock_hz = 300e6;
+    bool clock_fixed = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc)
+        {
+            output_path = argv[++i];
+        }
+        else if (arg == "--clock" && i + 1 < argc)
+        {
+            clock_hz = std::stod(argv[++i]);
+            clock_fixed = true;
+        }
+        else if (arg == "-h" || arg == "--help")
+        {
+            PrintUsage(argv[0]);
+            return 0;
+        }
+        else if (input_path.empty())
+        {
+            input_path = arg;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+    }
+    if (input_path.empty() || clock_hz <= 0)
+    {
+        PrintUsage(argv[0]);
+        return 2;
+    }
+
+    std::ifstream input(input_path, std::ios::binary);
+    if (!input)
+    {
+        std::cerr << "cannot open " << input_path << "\n";
+        return 1;
+    }
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    Converter converter(clock_hz, clock_fixed);
+    converter.Feed(data);
+
+    if (output_path.empty())
+    {
+        converter.Write(std::cout);
+    }
+    else
+    {
+        std::ofstream output(output_path);
+        if (!output)
+        {
+            std::cerr << "cannot write " << output_path << "\n";
+            return 1;
+        }
+        converter.Write(output);
+    }
+    converter.PrintSummary(std::cerr);
+    return 0;
+}
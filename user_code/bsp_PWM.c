@@ -1,5 +1,10 @@
 #include "bsp_PWM.h"
 
+// 批量同步更新: 电机通道暂存 Q15 占空比，其余通道暂存比较计数
+static uint32_t g_pwm_staged[BSP_PWM_CHANNEL_MAX];
+static uint32_t g_pwm_committed[BSP_PWM_CHANNEL_MAX];
+static uint16_t g_pwm_dirty_mask = 0;
+
 /**
  * @brief  初始化智能车所有用到的PWM模块
  * @param  motor_freq_hz: 电机PWM的频率 (例如 17000 Hz)
@@ -29,6 +34,13 @@ void bsp_pwm_init(uint32_t motor_freq_hz, uint32_t servo_freq_hz)
     zf_pwm_channel_init(PWM_TIM8_CH3_I4, 0); // 对应 BSP_PWM_SERVO_3
     zf_pwm_channel_init(PWM_TIM16_CH1_I5, 0);// 对应 BSP_PWM_SERVO_4
 
+    // ---- 批量更新的生效值未知，第一次提交时全部写入 ----
+    for (uint8_t i = 0; i < BSP_PWM_CHANNEL_MAX; i++)
+    {
+        g_pwm_committed[i] = UINT32_MAX;
+    }
+    g_pwm_dirty_mask = 0;
+
     // ---- [可选] 初始化LED的PWM ----
     // 你可以根据需要决定是否初始化LED
     // zf_pwm_module_init(PWM_TIM3, PWM_ALIGNMENT_EDGE, 13000);
@@ -37,6 +49,67 @@ void bsp_pwm_init(uint32_t motor_freq_hz, uint32_t servo_freq_hz)
     // zf_pwm_channel_init(PWM_TIM3_CH3_H0, PWM_DUTY_MAX);
 }
 
+/**
+ * @brief  将普通 TIM 逻辑通道映射到逐飞库引脚
+ * @retval bool: 电机 (HRTIM) 通道或无效通道返回 false
+ */
+static bool bsp_pwm_get_tim_pin(bsp_pwm_channel_e channel, zf_pwm_positive_channel_enum *pin)
+{
+    switch (channel)
+    {
+        case BSP_PWM_SERVO_1: *pin = PWM_TIM8_CH1_I0;  return true;
+        case BSP_PWM_SERVO_2: *pin = PWM_TIM8_CH2_I2;  return true;
+        case BSP_PWM_SERVO_3: *pin = PWM_TIM8_CH3_I4;  return true;
+        case BSP_PWM_SERVO_4: *pin = PWM_TIM16_CH1_I5; return true;
+        case BSP_PWM_LED_R:   *pin = PWM_TIM3_CH1_G14; return true;
+        case BSP_PWM_LED_G:   *pin = PWM_TIM3_CH2_G15; return true;
+        case BSP_PWM_LED_B:   *pin = PWM_TIM3_CH3_H0;  return true;
+        default:              return false;
+    }
+}
+
+#define BSP_PWM_PIN_TO_INDEX(pin)   ((zf_pwm_index_enum)(((pin) >> PWM_INDEX_OFFSET) & PWM_INDEX_MASK))
+
+/**
+ * @brief  写电机 (HRTIM) 通道的比较寄存器，仅由 bsp_pwm_commit_mask 调用
+ */
+static void bsp_pwm_write_motor(bsp_pwm_channel_e channel, uint16_t duty_q15)
+{
+    zf_hrtim_pwm_positive_channel_enum hrtim_pin;
+    switch (channel)
+    {
+        case BSP_PWM_MOTOR_L1: hrtim_pin = HRTIM1_CHA1_E4;  break;
+        case BSP_PWM_MOTOR_L2: hrtim_pin = HRTIM1_CHB1_E2;  break;
+        case BSP_PWM_MOTOR_R1: hrtim_pin = HRTIM1_CHD1_D13; break;
+        case BSP_PWM_MOTOR_R2: hrtim_pin = HRTIM1_CHF1_D8;  break;
+        default:               return;
+    }
+
+    // 中心对齐 PWM，半脉宽 = 占空比 * 周期 / 2，四舍五入到一个计数
+    uint32_t half_period = zf_hrtim_get_period(HRTIM_1) / 2;
+    uint32_t half_width = ((uint32_t)duty_q15 * half_period + BSP_PWM_DUTY_Q15_ONE / 2) >> 15;
+    zf_hrtim_set_compare(hrtim_pin, half_width);
+}
+
+/**
+ * @brief  写舵机/LED 通道 (普通 TIM) 的比较寄存器，仅由 bsp_pwm_commit_mask 调用
+ */
+static void bsp_pwm_write_compare(bsp_pwm_channel_e channel, uint32_t compare)
+{
+    zf_pwm_positive_channel_enum pin;
+    if (!bsp_pwm_get_tim_pin(channel, &pin))
+    {
+        return;
+    }
+
+    uint32_t full = zf_pwm_get_period(BSP_PWM_PIN_TO_INDEX(pin)) + 1;
+    if (compare > full)
+    {
+        compare = full;
+    }
+    zf_pwm_set_compare(pin, compare);
+}
+
 /**
  * @brief  设置指定逻辑通道的PWM占空比
  * @param  channel: 要操作的逻辑通道，来自 bsp_pwm_channel_e 枚举
@@ -45,67 +118,207 @@ void bsp_pwm_init(uint32_t motor_freq_hz, uint32_t servo_freq_hz)
  */
 void bsp_pwm_set_duty(bsp_pwm_channel_e channel, uint16_t duty_permillage)
 {
+    if (channel >= BSP_PWM_CHANNEL_MAX)
+    {
+        // 无效通道，不做任何事
+        return;
+    }
+
     // 输入检查，防止超出范围
     if (duty_permillage > 10000)
     {
         duty_permillage = 10000;
     }
 
-    // 将万分比的占空比 (0-10000) 映射到逐飞库使用的占空比值
-    // 逐飞库的 PWM_DUTY_MAX 宏定义了最大占空比值，我们直接用它来计算
-    uint16_t zf_duty = (uint32_t)duty_permillage * PWM_DUTY_MAX / 10000;
+    // LED是共阳接法，高占空比反而暗
+    if (BSP_PWM_MASK(channel) & BSP_PWM_MASK_TIM3)
+    {
+        duty_permillage = 10000 - duty_permillage;
+    }
 
-    // 使用 switch 语句将逻辑通道映射到具体的逐飞库函数调用
-    switch (channel)
+    // 万分比换算为 Q15 后走暂存接口，只提交本通道，生效值与批量更新的记录保持一致
+    bsp_pwm_stage_duty_q15(channel, (uint16_t)(((uint32_t)duty_permillage * BSP_PWM_DUTY_Q15_ONE + 5000) / 10000));
+    bsp_pwm_commit_mask(BSP_PWM_MASK(channel));
+}
+
+/**
+ * @brief  以 Q15 归一化占空比设置指定逻辑通道
+ * @param  channel: 要操作的逻辑通道，来自 bsp_pwm_channel_e 枚举
+ * @param  duty_q15: 占空比，0 - 32768 (BSP_PWM_DUTY_Q15_ONE 代表 100%)
+ * @retval None
+ */
+void bsp_pwm_set_duty_q15(bsp_pwm_channel_e channel, uint16_t duty_q15)
+{
+    bsp_pwm_stage_duty_q15(channel, duty_q15);
+    bsp_pwm_commit_mask(BSP_PWM_MASK(channel));
+}
+
+/**
+ * @brief  直接设置舵机/LED 通道 (普通 TIM) 的比较计数值
+ * @param  channel: 要操作的逻辑通道，仅舵机与 LED 通道有效
+ * @param  compare: 高电平宽度，单位为一个计数
+ * @retval None
+ */
+void bsp_pwm_set_compare(bsp_pwm_channel_e channel, uint32_t compare)
+{
+    bsp_pwm_stage_compare(channel, compare);
+    bsp_pwm_commit_mask(BSP_PWM_MASK(channel));
+}
+
+/**
+ * @brief  获取舵机/LED 通道 (普通 TIM) 的计数频率
+ * @param  channel: 要查询的逻辑通道
+ * @retval uint32_t: 计数频率 Hz
+ */
+uint32_t bsp_pwm_get_count_freq(bsp_pwm_channel_e channel)
+{
+    zf_pwm_positive_channel_enum pin;
+    if (!bsp_pwm_get_tim_pin(channel, &pin))
+    {
+        return 0;
+    }
+    return zf_pwm_get_count_freq(BSP_PWM_PIN_TO_INDEX(pin));
+}
+
+/**
+ * @brief  获取舵机/LED 通道 (普通 TIM) 一个周期的计数值
+ * @param  channel: 要查询的逻辑通道
+ * @retval uint32_t: 满占空比对应的比较计数值
+ */
+uint32_t bsp_pwm_get_period_counts(bsp_pwm_channel_e channel)
+{
+    zf_pwm_positive_channel_enum pin;
+    if (!bsp_pwm_get_tim_pin(channel, &pin))
+    {
+        return 0;
+    }
+    uint32_t period = zf_pwm_get_period(BSP_PWM_PIN_TO_INDEX(pin));
+    return period ? (period + 1) : 0;
+}
+
+// ---- 批量同步更新 ----
+
+/**
+ * @brief  记录暂存值，与上次生效值相同时清除标记
+ */
+static void bsp_pwm_stage(bsp_pwm_channel_e channel, uint32_t value)
+{
+    uint32 primask = zf_interrupt_global_disable();
+    g_pwm_staged[channel] = value;
+    if (value != g_pwm_committed[channel])
+    {
+        g_pwm_dirty_mask |= BSP_PWM_MASK(channel);
+    }
+    else
     {
-        // -- 舵机通道 --
-        case BSP_PWM_SERVO_1:
-            zf_pwm_set_duty(PWM_TIM8_CH1_I0, zf_duty);
-            break;
-        case BSP_PWM_SERVO_2:
-            zf_pwm_set_duty(PWM_TIM8_CH2_I2, zf_duty);
-            break;
-        case BSP_PWM_SERVO_3:
-            zf_pwm_set_duty(PWM_TIM8_CH3_I4, zf_duty);
-            break;
-        case BSP_PWM_SERVO_4:
-            zf_pwm_set_duty(PWM_TIM16_CH1_I5, zf_duty);
-            break;
-
-        // -- 电机通道 --
-        case BSP_PWM_MOTOR_L1:
-            zf_hrtim_set_duty(HRTIM1_CHA1_E4, zf_duty);
-            break;
-        case BSP_PWM_MOTOR_L2:
-            zf_hrtim_set_duty(HRTIM1_CHB1_E2, zf_duty);
-            break;
-        case BSP_PWM_MOTOR_R1:
-            zf_hrtim_set_duty(HRTIM1_CHD1_D13, zf_duty);
-            break;
-        case BSP_PWM_MOTOR_R2:
-            zf_hrtim_set_duty(HRTIM1_CHF1_D8, zf_duty);
-            break;
-
-        // -- LED 通道 --
-        case BSP_PWM_LED_R:
-            zf_pwm_set_duty(PWM_TIM3_CH1_G14, PWM_DUTY_MAX - zf_duty); // LED是共阳接法，高占空比反而暗
-            break;
-        case BSP_PWM_LED_G:
-            zf_pwm_set_duty(PWM_TIM3_CH2_G15, PWM_DUTY_MAX - zf_duty);
-            break;
-        case BSP_PWM_LED_B:
-            zf_pwm_set_duty(PWM_TIM3_CH3_H0, PWM_DUTY_MAX - zf_duty);
-            break;
-
-        default:
-            // 无效通道，不做任何事
-            break;
+        g_pwm_dirty_mask &= (uint16_t)~BSP_PWM_MASK(channel);
     }
+    zf_interrupt_global_enable(primask);
+}
+
+/**
+ * @brief  锁定/释放本次提交涉及的定时器
+ */
+static void bsp_pwm_lock_modules(uint16_t dirty, uint8 lock)
+{
+    if (dirty & BSP_PWM_MASK_MOTOR) zf_hrtim_set_update_lock(HRTIM_1, lock);
+    if (dirty & BSP_PWM_MASK_TIM8)  zf_pwm_set_update_lock(PWM_TIM8, lock);
+    if (dirty & BSP_PWM_MASK_TIM16) zf_pwm_set_update_lock(PWM_TIM16, lock);
+    if (dirty & BSP_PWM_MASK_TIM3)  zf_pwm_set_update_lock(PWM_TIM3, lock);
+}
+
+/**
+ * @brief  暂存一个通道的 Q15 占空比，等待 bsp_pwm_commit 统一生效
+ * @param  channel: 要操作的逻辑通道
+ * @param  duty_q15: 占空比，0 - BSP_PWM_DUTY_Q15_ONE
+ * @retval None
+ */
+void bsp_pwm_stage_duty_q15(bsp_pwm_channel_e channel, uint16_t duty_q15)
+{
+    if (channel >= BSP_PWM_CHANNEL_MAX)
+    {
+        return;
+    }
+    if (duty_q15 > BSP_PWM_DUTY_Q15_ONE)
+    {
+        duty_q15 = BSP_PWM_DUTY_Q15_ONE;
+    }
+
+    if (BSP_PWM_MASK(channel) & BSP_PWM_MASK_MOTOR)
+    {
+        bsp_pwm_stage(channel, duty_q15);
+    }
+    else
+    {
+        uint32_t full = bsp_pwm_get_period_counts(channel);
+        bsp_pwm_stage(channel, ((uint32_t)duty_q15 * full + BSP_PWM_DUTY_Q15_ONE / 2) >> 15);
+    }
+}
+
+/**
+ * @brief  暂存舵机/LED 通道 (普通 TIM) 的比较计数值，等待 bsp_pwm_commit 统一生效
+ * @param  channel: 要操作的逻辑通道，电机通道无效
+ * @param  compare: 高电平宽度，单位为一个计数
+ * @retval None
+ */
+void bsp_pwm_stage_compare(bsp_pwm_channel_e channel, uint32_t compare)
+{
+    if (channel >= BSP_PWM_CHANNEL_MAX || (BSP_PWM_MASK(channel) & BSP_PWM_MASK_MOTOR))
+    {
+        return;
+    }
+    bsp_pwm_stage(channel, compare);
+}
+
+/**
+ * @brief  把 mask 选中的、已暂存且有变化的通道一次性写入
+ * @param  mask: 通道掩码，由 BSP_PWM_MASK(channel) 或 BSP_PWM_MASK_xxx 组合
+ * @retval None
+ */
+void bsp_pwm_commit_mask(uint16_t mask)
+{
+    uint32 primask = zf_interrupt_global_disable();
+
+    uint16_t dirty = g_pwm_dirty_mask & mask;
+    if (0 == dirty)
+    {
+        zf_interrupt_global_enable(primask);
+        return;
+    }
+
+    bsp_pwm_lock_modules(dirty, 1);
+    for (uint8_t channel = 0; channel < BSP_PWM_CHANNEL_MAX; channel++)
+    {
+        if (!(dirty & BSP_PWM_MASK(channel)))
+        {
+            continue;
+        }
+        if (BSP_PWM_MASK(channel) & BSP_PWM_MASK_MOTOR)
+        {
+            bsp_pwm_write_motor((bsp_pwm_channel_e)channel, (uint16_t)g_pwm_staged[channel]);
+        }
+        else
+        {
+            bsp_pwm_write_compare((bsp_pwm_channel_e)channel, g_pwm_staged[channel]);
+        }
+        g_pwm_committed[channel] = g_pwm_staged[channel];
+    }
+    g_pwm_dirty_mask &= (uint16_t)~dirty;
+    bsp_pwm_lock_modules(dirty, 0);
+
+    zf_interrupt_global_enable(primask);
+}
+
+/**
+ * @brief  把所有已暂存且有变化的通道一次性写入
+ * @retval None
+ */
+void bsp_pwm_commit(void)
+{
+    bsp_pwm_commit_mask(BSP_PWM_MASK_ALL);
 }/*
  * PWM.c
  *
  *  Created on: 2025年7月7日
  *      Author: 20766
  */
-
-
@@ -38,6 +38,15 @@ typedef enum
     BSP_PWM_CHANNEL_MAX     // 通道总数，用于校验
 } bsp_pwm_channel_e;
 
+// 批量同步更新使用的通道掩码，按所在定时器分组
+#define BSP_PWM_MASK(channel)   ((uint16_t)(1u << (channel)))
+#define BSP_PWM_MASK_MOTOR      (BSP_PWM_MASK(BSP_PWM_MOTOR_L1) | BSP_PWM_MASK(BSP_PWM_MOTOR_L2) | \
+                                 BSP_PWM_MASK(BSP_PWM_MOTOR_R1) | BSP_PWM_MASK(BSP_PWM_MOTOR_R2))
+#define BSP_PWM_MASK_TIM8       (BSP_PWM_MASK(BSP_PWM_SERVO_1) | BSP_PWM_MASK(BSP_PWM_SERVO_2) | BSP_PWM_MASK(BSP_PWM_SERVO_3))
+#define BSP_PWM_MASK_TIM16      (BSP_PWM_MASK(BSP_PWM_SERVO_4))
+#define BSP_PWM_MASK_TIM3       (BSP_PWM_MASK(BSP_PWM_LED_R) | BSP_PWM_MASK(BSP_PWM_LED_G) | BSP_PWM_MASK(BSP_PWM_LED_B))
+#define BSP_PWM_MASK_ALL        ((uint16_t)((1u << BSP_PWM_CHANNEL_MAX) - 1))
+
 
 /**
  * @brief  初始化智能车所有用到的PWM模块
@@ -52,8 +61,85 @@ void bsp_pwm_init(uint32_t motor_freq_hz, uint32_t servo_freq_hz);
  * @param  channel: 要操作的逻辑通道，来自 bsp_pwm_channel_e 枚举
  * @param  duty_permillage: 占空比，万分比 (0 - 10000)，例如 5000 代表 50%
  * @retval None
+ * @note   立即生效: 内部暂存后只提交本通道，不会把其它通道尚未提交的暂存值一并写出。
  */
 void bsp_pwm_set_duty(bsp_pwm_channel_e channel, uint16_t duty_permillage);
 
+// Q15 格式的满占空比，bsp_pwm_set_duty_q15 的输入范围为 0 - BSP_PWM_DUTY_Q15_ONE
+#define BSP_PWM_DUTY_Q15_ONE    (32768)
+
+/**
+ * @brief  以 Q15 归一化占空比设置指定逻辑通道
+ * @param  channel: 要操作的逻辑通道，来自 bsp_pwm_channel_e 枚举
+ * @param  duty_q15: 占空比，0 - 32768 (BSP_PWM_DUTY_Q15_ONE 代表 100%)
+ * @retval None
+ * @note   电机 (HRTIM) 通道直接换算成比较计数，分辨率为一个 HRTIM 计数，不经过万分比量化，
+ *         也不做 2%/98% 截断，最小脉宽/死区由上层负责；其余通道换算为比较计数。
+ *         与 bsp_pwm_set_duty 相同，立即提交本通道。
+ */
+void bsp_pwm_set_duty_q15(bsp_pwm_channel_e channel, uint16_t duty_q15);
+
+/**
+ * @brief  直接设置舵机/LED 通道 (普通 TIM) 的比较计数值
+ * @param  channel: 要操作的逻辑通道，仅舵机与 LED 通道有效，电机通道请使用 bsp_pwm_set_duty_q15
+ * @param  compare: 高电平宽度，单位为一个计数 (1 / bsp_pwm_get_count_freq 秒)，超出周期时按满占空比处理
+ * @retval None
+ * @note   不经过万分比量化，50Hz 时万分比一档为 2us，而一个计数通常小于 1us。
+ *         LED 通道同样按高电平计数处理，不做共阳反相。与 bsp_pwm_set_duty 相同，立即提交本通道。
+ */
+void bsp_pwm_set_compare(bsp_pwm_channel_e channel, uint32_t compare);
+
+/**
+ * @brief  获取舵机/LED 通道 (普通 TIM) 的计数频率
+ * @param  channel: 要查询的逻辑通道
+ * @retval uint32_t: 计数频率 Hz，电机通道或模块未初始化时返回 0
+ */
+uint32_t bsp_pwm_get_count_freq(bsp_pwm_channel_e channel);
+
+/**
+ * @brief  获取舵机/LED 通道 (普通 TIM) 一个周期的计数值
+ * @param  channel: 要查询的逻辑通道
+ * @retval uint32_t: 满占空比对应的比较计数值，电机通道或模块未初始化时返回 0
+ */
+uint32_t bsp_pwm_get_period_counts(bsp_pwm_channel_e channel);
+
+
+/**
+ * @brief  暂存一个通道的 Q15 占空比，等待 bsp_pwm_commit 统一生效
+ * @param  channel: 要操作的逻辑通道
+ * @param  duty_q15: 占空比，0 - BSP_PWM_DUTY_Q15_ONE
+ * @retval None
+ * @note   与上次生效值相同时不标记，commit 时不产生寄存器写入。
+ *         普通 TIM 通道在暂存时即换算为比较计数。
+ */
+void bsp_pwm_stage_duty_q15(bsp_pwm_channel_e channel, uint16_t duty_q15);
+
+/**
+ * @brief  暂存舵机/LED 通道 (普通 TIM) 的比较计数值，等待 bsp_pwm_commit 统一生效
+ * @param  channel: 要操作的逻辑通道，电机通道无效
+ * @param  compare: 高电平宽度，单位为一个计数
+ * @retval None
+ */
+void bsp_pwm_stage_compare(bsp_pwm_channel_e channel, uint32_t compare);
+
+/**
+ * @brief  把所有已暂存且有变化的通道一次性写入
+ * @retval None
+ * @note   写入期间锁定涉及的定时器 (TIM 的 UDIS / HRTIM 的 TxUDIS)，新值只进预装载寄存器，
+ *         解锁后在各定时器的下一个更新事件一起生效: 同一定时器上的所有通道 (以及 HRTIM 每个通道的
+ *         CMP1/CMP2 两个边沿) 保证落在同一个 PWM 周期。舵机 TIM 与电机 HRTIM 频率不同，
+ *         各自在自己的下一个周期边界生效，不会在周期中途改变。
+ *         可在中断中调用，内部短暂关中断。
+ */
+void bsp_pwm_commit(void);
+
+/**
+ * @brief  只提交 mask 选中的通道，其余通道的暂存值保留到下一次提交
+ * @param  mask: 通道掩码，由 BSP_PWM_MASK(channel) 或 BSP_PWM_MASK_xxx 组合
+ * @retval None
+ * @note   用于比控制周期更快的内环 (例如电流环只提交 BSP_PWM_MASK_MOTOR)，避免把上层暂存的舵机值提前写出。
+ */
+void bsp_pwm_commit_mask(uint16_t mask);
+
 
 #endif /* USER_CODE_BSP_PWM_H_ */
@@ -0,0 +1,159 @@
+/*
+ * bsp_battery.c
+ *
+ *  Created on: 2025年7月25日
+ *      Author: 20766
+ */
+#include "bsp_battery.h"
+
+#define BATTERY_EVENT_HOLD_SAMPLES  ((uint16_t)(BATTERY_EVENT_HOLD_MS * BATTERY_UPDATE_HZ / 1000))
+
+// ================== 内部变量 ==================
+static volatile float               g_battery_voltage = BATTERY_VOLTAGE_NOMINAL;
+static volatile float               g_battery_comp_gain = 1.0f;
+static volatile bsp_battery_level_e g_battery_level = BATTERY_LEVEL_NORMAL;
+static bsp_battery_event_callback_t g_battery_callback = NULL;
+static volatile bool                g_battery_valid = false;    // 最近一次均值在合理范围内
+
+#if BATTERY_MONITOR_ENABLE
+
+static float    g_volts_per_lsb = 0.0f;
+static uint32_t g_raw_sum = 0;
+static uint16_t g_raw_count = 0;
+static bool     g_filter_valid = false;
+static uint16_t g_level_hold = 0;       // 候选等级已持续的均值样本数
+
+// ================== 内部辅助函数 ==================
+
+/**
+ * @brief  根据当前等级与滞环计算电压对应的等级
+ */
+static bsp_battery_level_e bsp_battery_classify(float voltage, bsp_battery_level_e current)
+{
+    float low_threshold = BATTERY_VOLTAGE_LOW;
+    float critical_threshold = BATTERY_VOLTAGE_CRITICAL;
+
+    // 已处于低电压等级时，需要高出滞环才能恢复
+    if (current >= BATTERY_LEVEL_LOW)      low_threshold += BATTERY_VOLTAGE_HYSTERESIS;
+    if (current >= BATTERY_LEVEL_CRITICAL) critical_threshold += BATTERY_VOLTAGE_HYSTERESIS;
+
+    if (voltage < critical_threshold) return BATTERY_LEVEL_CRITICAL;
+    if (voltage < low_threshold)      return BATTERY_LEVEL_LOW;
+    return BATTERY_LEVEL_NORMAL;
+}
+
+/**
+ * @brief  100Hz 均值样本处理: 低通、补偿系数、等级判定
+ */
+static void bsp_battery_process(float voltage)
+{
+    // 采样异常时不补偿、不判定等级，避免引脚未接时读到 0V 误报严重低电压
+    if (voltage < BATTERY_VOLTAGE_VALID_MIN || voltage > BATTERY_VOLTAGE_VALID_MAX)
+    {
+        g_battery_valid = false;
+        g_filter_valid = false;
+        g_battery_comp_gain = 1.0f;
+        g_level_hold = 0;
+        return;
+    }
+    g_battery_valid = true;
+
+    if (!g_filter_valid)
+    {
+        g_battery_voltage = voltage;
+        g_filter_valid = true;
+    }
+    else
+    {
+        g_battery_voltage += BATTERY_FILTER_ALPHA * (voltage - g_battery_voltage);
+    }
+
+    float gain = BATTERY_VOLTAGE_NOMINAL / ((g_battery_voltage > 1.0f) ? g_battery_voltage : 1.0f);
+    if (gain < BATTERY_COMP_GAIN_MIN) gain = BATTERY_COMP_GAIN_MIN;
+    if (gain > BATTERY_COMP_GAIN_MAX) gain = BATTERY_COMP_GAIN_MAX;
+    g_battery_comp_gain = gain;
+
+    bsp_battery_level_e level = bsp_battery_classify(g_battery_voltage, g_battery_level);
+    if (level == g_battery_level)
+    {
+        g_level_hold = 0;
+        return;
+    }
+    if (++g_level_hold < BATTERY_EVENT_HOLD_SAMPLES) return;
+
+    g_level_hold = 0;
+    g_battery_level = level;
+    if (NULL != g_battery_callback)
+    {
+        g_battery_callback(level, g_battery_voltage);
+    }
+}
+
+/**
+ * @brief  ADC 注入序列完成回调，每个 PWM 周期执行一次，只做累加
+ */
+static void bsp_battery_adc_handler(uint32_t event, void *ptr)
+{
+    (void)event; (void)ptr;
+
+    uint16 raw = 0;
+    zf_adc_get_injected_data(BATTERY_ADC_INDEX, 0, &raw);
+    g_raw_sum += raw;
+    if (++g_raw_count < BATTERY_SAMPLE_DECIMATION) return;
+
+    float voltage = (float)g_raw_sum / (float)g_raw_count * g_volts_per_lsb;
+    g_raw_sum = 0;
+    g_raw_count = 0;
+    bsp_battery_process(voltage);
+}
+
+#endif
+
+// ================== API函数实现 ==================
+
+void bsp_battery_init(void)
+{
+#if BATTERY_MONITOR_ENABLE
+    g_volts_per_lsb = BATTERY_ADC_VREF * BATTERY_DIVIDER_RATIO / BATTERY_ADC_MAX;
+    g_raw_sum = 0;
+    g_raw_count = 0;
+    g_filter_valid = false;
+    g_battery_valid = false;
+    g_battery_voltage = BATTERY_VOLTAGE_NOMINAL;
+    g_battery_comp_gain = 1.0f;
+    g_battery_level = BATTERY_LEVEL_NORMAL;
+
+    const zf_adc_channel_enum channel_list[1] = {BATTERY_ADC_CHANNEL};
+    zf_adc_module_init(BATTERY_ADC_INDEX, ADC_RES12BIT);
+    zf_adc_channel_init(BATTERY_ADC_CHANNEL);
+    zf_adc_injected_trigger_init(BATTERY_ADC_INDEX, channel_list, 1,
+                                 BATTERY_ADC_JEXTSEL, ADC_TRIGGER_EDGE_RISING,
+                                 bsp_battery_adc_handler, NULL);
+    zf_hrtim_adc_trigger_init(HRTIM_1, BATTERY_HRTIM_TRIGGER, zf_hrtim_get_period(HRTIM_1) / 2);
+#endif
+}
+
+void bsp_battery_set_event_callback(bsp_battery_event_callback_t callback)
+{
+    g_battery_callback = callback;
+}
+
+float bsp_battery_get_voltage(void)
+{
+    return g_battery_voltage;
+}
+
+bool bsp_battery_is_valid(void)
+{
+    return g_battery_valid;
+}
+
+bsp_battery_level_e bsp_battery_get_level(void)
+{
+    return g_battery_level;
+}
+
+float bsp_battery_get_compensation(void)
+{
+    return g_battery_comp_gain;
+}
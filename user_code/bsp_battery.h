@@ -0,0 +1,98 @@
+/*
+ * bsp_battery.h
+ *
+ *  Created on: 2025年7月25日
+ *      Author: 20766
+ *
+ *  [文件说明] 电池电压后台采样、滤波与低电压事件。
+ *            与电流采样相同，由 HRTIM 在 PWM 中点触发 ADC 注入组转换，中断里只做累加，
+ *            每 BATTERY_SAMPLE_DECIMATION 个 PWM 周期求一次均值再做一阶低通，主循环不参与。
+ *            电机输出按 V_nominal / V_measured 补偿，使同一占空比在电池放电过程中产生相同的等效电压。
+ *            电压持续低于阈值 BATTERY_EVENT_HOLD_MS 后通过回调发布事件，回调运行在 ADC 中断上下文。
+ *            均值超出 [BATTERY_VOLTAGE_VALID_MIN, BATTERY_VOLTAGE_VALID_MAX] 时视为采样异常，补偿系数回到 1，等级保持不变。
+ */
+
+#ifndef USER_CODE_BSP_BATTERY_H_
+#define USER_CODE_BSP_BATTERY_H_
+
+#include "zf_libraries_headfile.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+#define BATTERY_MONITOR_ENABLE      (0)       // [请确认硬件] 核对下面的引脚与 JEXTSEL 后再置 1，关闭时电压恒为额定值，补偿系数为 1，不发布事件
+
+// ---- 采样硬件 (这是最需要你确认和修改的地方！) ----
+#define BATTERY_ADC_INDEX           (ADC_2)
+#define BATTERY_ADC_CHANNEL         (ADC2_CH6_D6)          // [请修改] 电池分压点所接的 ADC 引脚
+#define BATTERY_HRTIM_TRIGGER       (HRTIM_ADC_TRIGGER_4)  // HRTIM ADC 触发输出 4 接 ADC1/2 注入组
+#define BATTERY_ADC_JEXTSEL         (28)                   // [请核对] 参考手册中 ADC2 注入组 hrtim_adc_trg4 的 JEXTSEL 编号
+#define BATTERY_ADC_VREF            (3.3f)
+#define BATTERY_ADC_MAX             (4095.0f)
+#define BATTERY_DIVIDER_RATIO       (6.0f)                 // [请修改] 分压比 (R_top + R_bottom) / R_bottom
+
+// ---- 滤波 ----
+#define BATTERY_SAMPLE_DECIMATION   (170)     // 每 N 个 PWM 周期输出一个均值 (17kHz / 170 = 100Hz)
+#define BATTERY_UPDATE_HZ           (100)
+#define BATTERY_FILTER_ALPHA        (0.1f)    // 100Hz 下一阶低通，时间常数约 0.1 秒
+
+// ---- 补偿 ----
+#define BATTERY_VOLTAGE_NOMINAL     (11.1f)   // [请修改] 额定电压，PID 与电机模型均以此电压为基准
+#define BATTERY_COMP_GAIN_MIN       (0.7f)    // 补偿系数限幅，防止采样异常时输出失控
+#define BATTERY_COMP_GAIN_MAX       (1.4f)
+#define BATTERY_VOLTAGE_VALID_MIN   (6.0f)    // 均值超出 [MIN, MAX] 视为采样异常 (引脚未接、分压比错误)，不补偿也不判定等级
+#define BATTERY_VOLTAGE_VALID_MAX   (14.0f)
+
+// ---- 低电压事件 (3S 锂电) ----
+#define BATTERY_VOLTAGE_LOW         (10.5f)   // 低电压: 建议降速
+#define BATTERY_VOLTAGE_CRITICAL    (9.9f)    // 严重低电压: 必须停车
+#define BATTERY_VOLTAGE_HYSTERESIS  (0.3f)    // 恢复时需要高出阈值的电压
+#define BATTERY_EVENT_HOLD_MS       (2000)    // 持续这么久才发布事件，避免加速压降误报
+
+typedef enum
+{
+    BATTERY_LEVEL_NORMAL,
+    BATTERY_LEVEL_LOW,
+    BATTERY_LEVEL_CRITICAL,
+} bsp_battery_level_e;
+
+// 电压等级变化时调用，运行在 ADC 中断上下文，只应设置标志，不可做耗时操作
+typedef void (*bsp_battery_event_callback_t)(bsp_battery_level_e level, float voltage);
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化电池电压采样
+ * @note   依赖 HRTIM 已初始化 (bsp_pwm_init 之后调用)。
+ */
+void bsp_battery_init(void);
+
+/**
+ * @brief  注册电压等级变化回调，传 NULL 取消
+ */
+void bsp_battery_set_event_callback(bsp_battery_event_callback_t callback);
+
+/**
+ * @brief  获取滤波后的电池电压 (V)，尚无有效数据时返回额定电压
+ */
+float bsp_battery_get_voltage(void);
+
+/**
+ * @brief  最近一次均值是否在合理范围内
+ * @return bool: 未使能、尚无数据或采样异常时为 false
+ */
+bool bsp_battery_is_valid(void);
+
+/**
+ * @brief  获取当前电压等级
+ */
+bsp_battery_level_e bsp_battery_get_level(void);
+
+/**
+ * @brief  获取电机输出补偿系数 V_nominal / V_measured (已限幅)
+ * @return float: 尚无有效数据时为 1.0
+ */
+float bsp_battery_get_compensation(void);
+
+#endif /* USER_CODE_BSP_BATTERY_H_ */
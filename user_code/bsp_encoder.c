@@ -4,29 +4,65 @@
 #include "bsp_encoder.h"
 #include "zf_libraries_headfile.h"
 
+// ================== 内部宏定义 ==================
+#define ENCODER_INDEX           (ENCODER_TIM2)
+#define ENCODER_EDGE_SHIFT      (2)        // 正交模式下硬件对 A/B 两相的上下沿都计数，1 计数 = 4 边沿
+
+// ================== 内部变量 ==================
+static uint16_t g_last_raw_count = 0;      // 上一次读到的硬件 CNT
+static int64_t  g_total_edges = 0;         // 累计边沿数 (内部以边沿为单位保存，避免 /4 截断误差)
+static int64_t  g_last_total_counts = 0;   // 上一次换算出的累计计数
+static volatile int32_t g_period_delta = 0;
+
 /**
  * @brief  编码器模块初始化
  * @note   初始化硬件编码器接口
  */
 void encoder_init(void) {
     // 初始化编码器接口，假设电机1使用TIM2
-    zf_encoder_init(ENCODER_TIM2, ENCODER_MODE_QUADRATURE, ENCODER_TIM2_A_PLUS_D14, ENCODER_TIM2_B_DIR_D15);
+    zf_encoder_init(ENCODER_INDEX, ENCODER_MODE_QUADRATURE, ENCODER_TIM2_A_PLUS_D14, ENCODER_TIM2_B_DIR_D15);
+
+    // 计数器从此刻开始自由运行，以当前值作为基准
+    zf_encoder_get_raw_count(ENCODER_INDEX, &g_last_raw_count);
+    g_total_edges = 0;
+    g_last_total_counts = 0;
+    g_period_delta = 0;
 }
 
 /**
- * @brief  获取并清零电机1的编码器增量计数
- * @note   这是一个原子操作，用于在控制中断中一次性完成读取和复位。
- * @return int16_t: 自上次调用以来的编码器脉冲增量
+ * @brief  采样一次编码器，更新里程累加器
+ * @note   只读不清零，读与写之间不存在丢脉冲的窗口。
+ * @return int32_t: 本周期的编码器计数增量
  */
-int16_t encoder_get_and_clear_counts(void) {
-    int16_t current_counts;
+int32_t encoder_update(void) {
+    uint16_t raw_count;
+
+    // 1. 读取自由运行的硬件计数值
+    zf_encoder_get_raw_count(ENCODER_INDEX, &raw_count);
+
+    // 2. 无符号相减再转有符号，自动处理 0xFFFF <-> 0x0000 的回绕
+    int16_t delta_edges = (int16_t)(uint16_t)(raw_count - g_last_raw_count);
+    g_last_raw_count = raw_count;
+    g_total_edges += delta_edges;
 
-    // 1. 读取当前的计数值
-    zf_encoder_get_count(ENCODER_TIM2, &current_counts);
+    // 3. 换算成计数单位。对累计值取整再做差，余下不足 4 个的边沿留到下个周期，不会丢失
+    //    (右移对负数是向下取整，正反转时行为一致)
+    int64_t total_counts = g_total_edges >> ENCODER_EDGE_SHIFT;
+    g_period_delta = (int32_t)(total_counts - g_last_total_counts);
+    g_last_total_counts = total_counts;
+
+    return g_period_delta;
+}
+
+int32_t encoder_get_period_delta(void) {
+    return g_period_delta;
+}
 
-    // 2. 清零硬件计数器，为下一次计数做准备
-    zf_encoder_clear_count(ENCODER_TIM2);
+int64_t encoder_get_total_counts(void) {
+    // 64 位变量在 32 位内核上无法单指令读出，关中断保证读到的是同一次更新的结果
+    uint32 primask = zf_interrupt_global_disable();
+    int64_t total_counts = g_last_total_counts;
+    zf_interrupt_global_enable(primask);
 
-    // 3. 返回本次读取到的计数值
-    return current_counts;
+    return total_counts;
 }
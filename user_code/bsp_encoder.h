@@ -6,6 +6,8 @@
  *
  *  [版本说明] 此版本已根据系统架构优化进行了接口调整。
  *            中断处理和速度获取逻辑已移至 speed_control 模块。
+ *            硬件计数器改为自由运行，不再读后清零，增量由相邻两次读数做差得到，
+ *            并累加进 64 位里程计数，期间不会丢失任何脉冲。
  */
 
 #ifndef USER_CODE_BSP_ENCODER_H_
@@ -16,24 +18,42 @@
 //-------------------------------------------------------------------------------------------------------------------
 // 函数原型声明 (Function Prototypes)
 // 这里只声明本模块向外提供的公共函数。
+// 所有计数单位与 zf_encoder_get_count 保持一致 (正交模式下 1 计数 = 4 个边沿)。
 //-------------------------------------------------------------------------------------------------------------------
 
 /**
  * @brief  编码器模块初始化
- * @note   初始化硬件编码器接口。
+ * @note   初始化硬件编码器接口，并记录自由运行计数器的初始值，里程清零。
  * @param  None
  * @retval None
  */
 void encoder_init(void);
 
 /**
- * @brief  获取并清零电机1的编码器增量计数
- * @note   这是一个原子操作，用于在控制中断中一次性完成读取和复位。
- *         它直接读取硬件定时器的计数值，然后将其清零。
+ * @brief  采样一次编码器，更新里程累加器
+ * @note   每个控制周期在控制中断中调用且只调用一次。
+ *         硬件计数器不清零，用 (int16)(本次 - 上次) 计算增量，天然处理 16 位回绕；
+ *         只要单个周期内不超过 32767 个边沿就不会出错 (10ms 周期下约 3.2M 边沿/秒)。
  * @param  None
- * @retval int16_t: 自上次调用以来的编码器脉冲增量。
+ * @retval int32_t: 本周期的编码器计数增量。
  */
-int16_t encoder_get_and_clear_counts(void);
+int32_t encoder_update(void);
+
+/**
+ * @brief  获取最近一个周期的编码器计数增量
+ * @note   即最近一次 encoder_update() 的返回值，供其它模块只读使用。
+ * @param  None
+ * @retval int32_t: 最近一个周期的计数增量。
+ */
+int32_t encoder_get_period_delta(void);
+
+/**
+ * @brief  获取上电以来累计的编码器计数 (里程)
+ * @note   64 位累加，不会溢出。读取过程中短暂关中断，可在任意上下文调用。
+ * @param  None
+ * @retval int64_t: 累计计数，正负代表方向。
+ */
+int64_t encoder_get_total_counts(void);
 
 
 /*
@@ -44,6 +64,8 @@ int16_t encoder_get_and_clear_counts(void);
  * int16_t get_motor1_speed(void);
  * extern volatile int16_t g_motor1_speed_counts;
  *
+ * [已移除] int16_t encoder_get_and_clear_counts(void);
+ * 读取与清零之间到达的脉冲会丢失，且 int16 在高速时会回绕，已由 encoder_update() 取代。
  */
 
 #endif /* USER_CODE_BSP_ENCODER_H_ */
@@ -0,0 +1,71 @@
+/*
+ * bsp_flash_param.c
+ *
+ *  Created on: 2025年7月20日
+ *      Author: 20766
+ */
+#include "bsp_flash_param.h"
+#include "zf_libraries_headfile.h"
+
+// ================== 内部宏定义 ==================
+#define FLASH_PARAM_MAGIC           (0x50415241u)   // "PARA"
+#define FLASH_PARAM_HEADER_WORDS    (3)
+#define FLASH_PARAM_MAX_WORDS       (FLASH_PARAM_HEADER_WORDS + (BSP_FLASH_PARAM_MAX_BYTES + 3) / 4)
+// zf_flash_read_page / zf_flash_write_page 的长度参数以字节为单位，最长一条记录也必须放得进一页
+_Static_assert(FLASH_PARAM_MAX_WORDS * sizeof(uint32) <= USER_FLASH_PAGE_SIZE, "flash param record exceeds one flash page");
+
+// ================== 内部变量 ==================
+// 读写共用的字缓冲区，放在静态区避免占用调用者栈空间
+static uint32 g_flash_param_buffer[FLASH_PARAM_MAX_WORDS];
+
+// ================== 内部辅助函数 ==================
+
+static uint32 flash_param_checksum(const uint32 *words, uint32 count)
+{
+    // 简单的循环移位异或和，足以识别擦除后的 0xFF 页和写入中断造成的残缺记录
+    uint32 sum = 0x5A5A5A5Au;
+    for (uint32 i = 0; i < count; i++)
+    {
+        sum = ((sum << 5) | (sum >> 27)) ^ words[i];
+    }
+    return sum;
+}
+
+// ================== API函数实现 ==================
+
+bool bsp_flash_param_load(bsp_flash_param_id_e id, void *data, uint16_t size)
+{
+    if (id >= BSP_FLASH_PARAM_NUM_MAX || data == NULL || size == 0 || size > BSP_FLASH_PARAM_MAX_BYTES) return false;
+
+    uint16_t data_words = (size + 3) / 4;
+    uint16_t record_bytes = (uint16_t)((FLASH_PARAM_HEADER_WORDS + data_words) * sizeof(uint32));
+
+    if (zf_flash_check_page(BSP_FLASH_PARAM_SECTOR, id) != FLASH_STATE_PAGE_OCCUPIED) return false;
+    if (zf_flash_read_page(BSP_FLASH_PARAM_SECTOR, id, g_flash_param_buffer, record_bytes) != ZF_NO_ERROR) return false;
+
+    if (g_flash_param_buffer[0] != FLASH_PARAM_MAGIC) return false;
+    if (g_flash_param_buffer[1] != (((uint32)id << 16) | size)) return false;
+    if (g_flash_param_buffer[2] != flash_param_checksum(&g_flash_param_buffer[FLASH_PARAM_HEADER_WORDS], data_words)) return false;
+
+    memcpy(data, &g_flash_param_buffer[FLASH_PARAM_HEADER_WORDS], size);
+    return true;
+}
+
+bool bsp_flash_param_save(bsp_flash_param_id_e id, const void *data, uint16_t size)
+{
+    if (id >= BSP_FLASH_PARAM_NUM_MAX || data == NULL || size == 0 || size > BSP_FLASH_PARAM_MAX_BYTES) return false;
+
+    uint16_t data_words = (size + 3) / 4;
+    uint16_t record_bytes = (uint16_t)((FLASH_PARAM_HEADER_WORDS + data_words) * sizeof(uint32));
+
+    memset(g_flash_param_buffer, 0, sizeof(g_flash_param_buffer));
+    memcpy(&g_flash_param_buffer[FLASH_PARAM_HEADER_WORDS], data, size);
+    g_flash_param_buffer[0] = FLASH_PARAM_MAGIC;
+    g_flash_param_buffer[1] = ((uint32)id << 16) | size;
+    g_flash_param_buffer[2] = flash_param_checksum(&g_flash_param_buffer[FLASH_PARAM_HEADER_WORDS], data_words);
+
+    // zf_flash_write_page 内部先擦除整页再编程
+    if (zf_flash_write_page(BSP_FLASH_PARAM_SECTOR, id, g_flash_param_buffer, record_bytes) != ZF_NO_ERROR) return false;
+
+    return true;
+}
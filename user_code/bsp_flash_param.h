@@ -0,0 +1,57 @@
+/*
+ * bsp_flash_param.h
+ *
+ *  Created on: 2025年7月20日
+ *      Author: 20766
+ *
+ *  [文件说明] 用户 FLASH 参数存储。
+ *            每类参数独占用户 FLASH 的一页 (16KB)，记录格式为:
+ *              [魔数][参数ID | 数据字节数][校验和][数据...]
+ *            读取时校验魔数、ID、长度与校验和，任意一项不符都视为无有效参数，由调用者使用默认值。
+ *            写入需要擦除整页，耗时较长，只能在主循环中调用，不可在控制中断中调用。
+ */
+
+#ifndef USER_CODE_BSP_FLASH_PARAM_H_
+#define USER_CODE_BSP_FLASH_PARAM_H_
+
+#include "zf_common_typedef.h"
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+// 参数记录所在页的分配 (用户 FLASH 扇区0 共4页)
+typedef enum
+{
+    BSP_FLASH_PARAM_MOTOR_PID,      // 电机速度环 PID 增益 (自整定结果)
+    BSP_FLASH_PARAM_SERVO_CALIB,    // 舵机脉宽-转角标定表
+    BSP_FLASH_PARAM_STEERING_EST,   // 转向零偏/增益/等效轴距在线估计结果
+    BSP_FLASH_PARAM_RESERVED_3,
+
+    BSP_FLASH_PARAM_NUM_MAX
+} bsp_flash_param_id_e;
+
+#define BSP_FLASH_PARAM_SECTOR      (0)
+#define BSP_FLASH_PARAM_MAX_BYTES   (1024)   // 单条记录最大数据字节数
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  从 FLASH 读取一条参数记录
+ * @param  id: 参数ID
+ * @param  data: 输出缓冲区
+ * @param  size: 期望的数据字节数，必须与写入时一致
+ * @retval bool: true-读取成功且校验通过, false-无有效记录 (data 内容不变)
+ */
+bool bsp_flash_param_load(bsp_flash_param_id_e id, void *data, uint16_t size);
+
+/**
+ * @brief  把一条参数记录写入 FLASH
+ * @note   会擦除整页，阻塞时间为毫秒级，禁止在中断中调用。
+ * @param  id: 参数ID
+ * @param  data: 数据
+ * @param  size: 数据字节数 (不超过 BSP_FLASH_PARAM_MAX_BYTES)
+ * @retval bool: true-写入成功, false-失败
+ */
+bool bsp_flash_param_save(bsp_flash_param_id_e id, const void *data, uint16_t size);
+
+#endif /* USER_CODE_BSP_FLASH_PARAM_H_ */
@@ -4,6 +4,9 @@
  *  [版本说明] 最终优化版。
  */
 #include "bsp_rtk.h"
+#include "topic.h"
+#include "latency_trace.h"
+#include <string.h>
 
 // ================== 外部变量与函数声明 ==================
 // 这些变量和函数由逐飞的 `zf_device_gnss` 库定义并导出。
@@ -40,12 +43,17 @@ bool bsp_rtk_data_task(void)
     {
         // 清除标志，避免重复处理。这是必须的步骤。
         gnss_flag = 0;
+        const uint16_t trace_id = latency_trace_begin();
 
         // 调用解析函数。它会处理已分类的内部缓冲区(gnss_xxx_buffer)，
         // 进行校验和验证，并更新全局的 `gnss_info` 结构体。
         // 函数返回0 (ZF_NO_ERROR) 表示所有已接收的语句都校验成功并被解析。
         if (gnss_data_parse() == 0)
         {
+            latency_trace_point(trace_id, LATENCY_STAGE_PARSED);
+            // 发布一份完整快照，其他任务通过 TOPIC_GNSS_FIX 读取，不直接访问正在被解析的 gnss_info
+            topic_publish(TOPIC_GNSS_FIX, &gnss_info);
+            latency_trace_point(trace_id, LATENCY_STAGE_PUBLISHED);
             return true; // 确认有新数据，并且已成功更新。
         }
     }
@@ -60,7 +68,11 @@ bool bsp_rtk_data_task(void)
  */
 gnss_info_struct bsp_rtk_get_info(void)
 {
-    // 直接返回全局结构体的副本，这是最安全的方式，
-    // 可以防止上层应用的数据在读取过程中被中断意外修改（虽然在此架构中风险极低）。
-    return gnss_info;
+    // 返回最近一次解析成功时发布的快照，任何任务调用都得到同一时刻的完整数据。
+    gnss_info_struct info;
+    if (!topic_read(TOPIC_GNSS_FIX, &info, NULL, NULL))
+    {
+        memset(&info, 0, sizeof(info)); // 尚无有效定位
+    }
+    return info;
 }
@@ -7,7 +7,7 @@ typedef struct
     zf_uart_index_enum  hw_uart_index;
     zf_uart_tx_pin_enum tx_pin;
     zf_uart_rx_pin_enum rx_pin;
-    zf_fifo_obj_struct  rx_fifo;
+    zf_ring_obj_struct  rx_ring;
     uint8_t             *rx_buffer;
     uint16_t            rx_buffer_size;
     bool                is_initialized;
@@ -46,7 +46,7 @@ static void universal_uart_handler(uint32_t event, void* ptr)
     {
         uint8_t data_byte = 0;
         zf_uart_query_byte(instance->hw_uart_index, &data_byte);
-        zf_fifo_write_element(&instance->rx_fifo, data_byte);
+        zf_ring_write_byte(&instance->rx_ring, data_byte);  // 满时丢弃并计入 overflow_count
     }
 }
 
@@ -60,10 +60,15 @@ void bsp_uart_init(bsp_uart_e uart_ch, uint32_t baudrate)
 
     if (instance->is_initialized) return;
 
-    zf_fifo_init(&instance->rx_fifo, FIFO_DATA_8BIT, instance->rx_buffer, instance->rx_buffer_size);
     zf_uart_init(instance->hw_uart_index, baudrate, instance->tx_pin, instance->rx_pin);
-    zf_uart_set_interrupt_callback(instance->hw_uart_index, universal_uart_handler, (void*)instance);
-    zf_uart_set_interrupt_config(instance->hw_uart_index, UART_INTERRUPT_CONFIG_RX_ENABLE);
+
+    // 接收缓冲区不可用时保持接收中断关闭，串口仍可用于发送
+    if (ZF_NO_ERROR == zf_ring_init(&instance->rx_ring, instance->rx_buffer, instance->rx_buffer_size))
+    {
+        zf_watermark_register_ring((BSP_UART_DEBUG == uart_ch) ? "debug_rx" : "rtk_rx", &instance->rx_ring);
+        zf_uart_set_interrupt_callback(instance->hw_uart_index, universal_uart_handler, (void*)instance);
+        zf_uart_set_interrupt_config(instance->hw_uart_index, UART_INTERRUPT_CONFIG_RX_ENABLE);
+    }
 
     // [已删除] 不再需要手动设置debug uart
 
@@ -86,11 +91,5 @@ bool bsp_uart_read_byte(bsp_uart_e uart_ch, uint8_t* data)
 {
     if (uart_ch >= BSP_UART_NUM_MAX || data == NULL) return false;
 
-    // [已修正] 添加了第三个参数 FIFO_READ_WITH_CLEAN
-    if (zf_fifo_read_element(&g_uart_instances[uart_ch].rx_fifo, data, FIFO_READ_WITH_CLEAN))
-    {
-        return true;
-    }
-
-    return false;
+    return ZF_NO_ERROR == zf_ring_read_byte(&g_uart_instances[uart_ch].rx_ring, data);
 }
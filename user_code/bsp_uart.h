@@ -10,7 +10,8 @@
 
 
 #include "zf_driver_uart.h"
-#include "zf_common_fifo.h" // 因为我们用到了 zf_fifo_obj_struct
+#include "zf_common_ring.h" // 接收缓冲区使用 zf_ring_obj_struct
+#include "zf_common_watermark.h"
 #include <stdbool.h>
 
 // ================== 配置与宏定义 ==================
@@ -28,8 +29,11 @@ typedef enum
 // 定义每个UART接收缓冲区的大小 (单位: 字节)
 // 这个值应该足够大，以防止在主循环处理不及时的情况下数据丢失
 // 对于高波特率的RTK，建议至少512字节或更大
+// 接收缓冲区为 zf_ring 环形缓冲区，长度必须为 2 的幂
 #define BSP_UART_DEBUG_RX_BUF_SIZE   (256)
 #define BSP_UART_RTK_RX_BUF_SIZE     (1024)
+_Static_assert((BSP_UART_DEBUG_RX_BUF_SIZE & (BSP_UART_DEBUG_RX_BUF_SIZE - 1)) == 0, "BSP_UART_DEBUG_RX_BUF_SIZE must be a power of 2");
+_Static_assert((BSP_UART_RTK_RX_BUF_SIZE & (BSP_UART_RTK_RX_BUF_SIZE - 1)) == 0, "BSP_UART_RTK_RX_BUF_SIZE must be a power of 2");
 
 // ================== API函数声明 ==================
 
@@ -38,6 +42,7 @@ typedef enum
  * @param  uart_ch: 要初始化的逻辑UART通道 (BSP_UART_DEBUG 或 BSP_UART_RTK)
  * @param  baudrate: 波特率
  * @retval None
+ * @note   接收缓冲区初始化失败时只初始化发送，不打开接收中断。
  */
 void bsp_uart_init(bsp_uart_e uart_ch, uint32_t baudrate);
 
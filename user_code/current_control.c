@@ -0,0 +1,254 @@
+/*
+ * current_control.c
+ *
+ *  Created on: 2025年7月24日
+ *      Author: 20766
+ */
+#include "current_control.h"
+#include "motion_control.h"
+#include "pid.h"
+#include <math.h>
+
+// ================== 内部变量 ==================
+static volatile current_state_e g_current_state = CURRENT_STATE_CALIBRATING;
+static volatile current_mode_e  g_current_mode = CURRENT_MODE_DUTY;
+
+static volatile float g_duty_request = 0.0f;        // DUTY 模式请求占空比
+static volatile float g_current_target_a = 0.0f;    // TORQUE 模式目标电流
+static volatile float g_current_a = 0.0f;           // 最近一次采样电流
+static volatile float g_current_filtered_a = 0.0f;
+static volatile float g_duty_ceiling = 1.0f;
+
+static float    g_amps_per_lsb = 0.0f;
+static float    g_offset_lsb = 0.0f;
+static uint32_t g_offset_sum = 0;
+static uint16_t g_offset_samples = 0;
+static uint8_t  g_trip_counter = 0;
+static uint8_t  g_loop_divider = 0;
+static uint64   g_calib_start_us = 0;
+
+static pid_ctrl_t g_limit_pid;      // 输出为占空比上限 0 - 1
+static pid_ctrl_t g_current_pid;    // 输出为占空比 -1 - 1
+
+// ================== 内部辅助函数 ==================
+
+static void current_control_output_off(void)
+{
+    motion_set_motor_duty(0.0f);
+    motion_control_commit_motor();
+}
+
+/**
+ * @brief  ADC 注入序列完成回调，每个 PWM 周期执行一次
+ * @note   由 HRTIM 在脉冲中点触发，运行在 ADC 中断上下文
+ */
+static void current_control_adc_handler(uint32_t event, void *ptr)
+{
+    (void)event; (void)ptr;
+
+    uint16 raw = 0;
+    zf_adc_get_injected_data(CURRENT_SENSE_ADC_INDEX, 0, &raw);
+
+    // 标定超时后不再使用采样结果
+    if (CURRENT_STATE_BYPASS == g_current_state) return;
+
+    // --- 1. 上电零偏标定 ---
+    if (CURRENT_STATE_CALIBRATING == g_current_state)
+    {
+        current_control_output_off();
+        g_offset_sum += raw;
+        if (++g_offset_samples >= CURRENT_SENSE_OFFSET_SAMPLES)
+        {
+            g_offset_lsb = (float)g_offset_sum / (float)g_offset_samples;
+            g_current_state = CURRENT_STATE_RUNNING;
+        }
+        return;
+    }
+
+    // --- 2. 换算与过流保护 (每个 PWM 周期都检查) ---
+    float current = ((float)raw - g_offset_lsb) * g_amps_per_lsb;
+    float current_abs = fabsf(current);
+    g_current_a = current;
+    g_current_filtered_a += CURRENT_SENSE_FILTER_ALPHA * (current - g_current_filtered_a);
+
+    if (current_abs > CURRENT_TRIP_A)
+    {
+        if (++g_trip_counter >= CURRENT_TRIP_COUNT)
+        {
+            g_current_state = CURRENT_STATE_FAULT;
+        }
+    }
+    else
+    {
+        g_trip_counter = 0;
+    }
+
+    if (CURRENT_STATE_FAULT == g_current_state)
+    {
+        current_control_output_off();
+        return;
+    }
+
+    // --- 3. 电流环 (分频执行) ---
+    if (++g_loop_divider < CURRENT_LOOP_DIVIDER) return;
+    g_loop_divider = 0;
+
+    // 限流环: 误差 = 上限 - |I|，未超限时输出饱和在 1，超限后积分下降压低占空比上限
+    g_duty_ceiling = PID_TO_FLOAT(pid_ctrl_update(&g_limit_pid,
+                                                  PID_REAL(CURRENT_LIMIT_A),
+                                                  PID_REAL(current_abs),
+                                                  PID_REAL(0.0f)));
+
+    float duty;
+    if (CURRENT_MODE_TORQUE == g_current_mode)
+    {
+        duty = PID_TO_FLOAT(pid_ctrl_update(&g_current_pid,
+                                            PID_REAL(g_current_target_a),
+                                            PID_REAL(current),
+                                            PID_REAL(0.0f)));
+    }
+    else
+    {
+        duty = g_duty_request;
+    }
+
+    if (duty > g_duty_ceiling)  duty = g_duty_ceiling;
+    if (duty < -g_duty_ceiling) duty = -g_duty_ceiling;
+
+    // 电流环比控制周期快，只提交电机通道，舵机暂存值仍由速度环统一提交
+    motion_set_motor_duty(duty);
+    motion_control_commit_motor();
+}
+
+// ================== API函数实现 ==================
+
+void current_control_init(void)
+{
+    g_amps_per_lsb = CURRENT_SENSE_DIRECTION * CURRENT_SENSE_VREF
+                   / (CURRENT_SENSE_ADC_MAX * CURRENT_SENSE_AMP_GAIN * CURRENT_SENSE_SHUNT_OHM);
+
+    const pid_ctrl_config_t limit_config = {
+        .mode           = PID_MODE_POSITIONAL,
+        .kp             = PID_REAL(CURRENT_LIMIT_KP),
+        .ki             = PID_REAL(CURRENT_LIMIT_KI),
+        .kd             = PID_REAL(0.0f),
+        .kb             = PID_REAL(0.0f),
+        .beta           = PID_REAL(1.0f),
+        .gamma          = PID_REAL(0.0f),
+        .d_filter_alpha = PID_REAL(1.0f),
+        .kff_static     = PID_REAL(0.0f),
+        .kff_velocity   = PID_REAL(0.0f),
+        .out_min        = PID_REAL(0.0f),
+        .out_max        = PID_REAL(1.0f),
+        .rate_limit     = PID_REAL(0.0f),
+    };
+    pid_ctrl_init(&g_limit_pid, &limit_config);
+    pid_ctrl_reset(&g_limit_pid, PID_REAL(1.0f));
+
+    const pid_ctrl_config_t current_config = {
+        .mode           = PID_MODE_POSITIONAL,
+        .kp             = PID_REAL(CURRENT_PI_KP),
+        .ki             = PID_REAL(CURRENT_PI_KI),
+        .kd             = PID_REAL(0.0f),
+        .kb             = PID_REAL(CURRENT_PI_KI / CURRENT_PI_KP),
+        .beta           = PID_REAL(1.0f),
+        .gamma          = PID_REAL(0.0f),
+        .d_filter_alpha = PID_REAL(1.0f),
+        .kff_static     = PID_REAL(0.0f),
+        .kff_velocity   = PID_REAL(0.0f),
+        .out_min        = PID_REAL(-1.0f),
+        .out_max        = PID_REAL(1.0f),
+        .rate_limit     = PID_REAL(0.0f),
+    };
+    pid_ctrl_init(&g_current_pid, &current_config);
+
+    g_offset_sum = 0;
+    g_offset_samples = 0;
+    g_calib_start_us = zf_time_now_us();
+    g_current_state = CURRENT_STATE_CALIBRATING;
+
+    // ADC 注入组由 HRTIM 在 PWM 中点触发，结果留在注入数据寄存器，序列完成才进中断
+    const zf_adc_channel_enum channel_list[1] = {CURRENT_SENSE_ADC_CHANNEL};
+    zf_adc_module_init(CURRENT_SENSE_ADC_INDEX, ADC_RES12BIT);
+    zf_adc_channel_init(CURRENT_SENSE_ADC_CHANNEL);
+    zf_adc_injected_trigger_init(CURRENT_SENSE_ADC_INDEX, channel_list, 1,
+                                 CURRENT_SENSE_ADC_JEXTSEL, ADC_TRIGGER_EDGE_RISING,
+                                 current_control_adc_handler, NULL);
+    zf_hrtim_adc_trigger_init(HRTIM_1, CURRENT_SENSE_HRTIM_TRIGGER, zf_hrtim_get_period(HRTIM_1) / 2);
+}
+
+void current_control_set_mode(current_mode_e mode)
+{
+    if (mode == g_current_mode) return;
+
+    uint32 primask = zf_interrupt_global_disable();
+    // 以当前实际占空比预置，避免切换瞬间输出跳变
+    pid_ctrl_reset(&g_current_pid, PID_REAL(motion_get_motor_duty()));
+    g_duty_request = motion_get_motor_duty();
+    g_current_mode = mode;
+    zf_interrupt_global_enable(primask);
+}
+
+void current_control_set_duty(float duty)
+{
+    if (duty > 1.0f)  duty = 1.0f;
+    if (duty < -1.0f) duty = -1.0f;
+    g_duty_request = duty;
+
+    if (CURRENT_STATE_CALIBRATING == g_current_state &&
+        zf_time_now_us() - g_calib_start_us > (uint64)CURRENT_SENSE_CALIB_TIMEOUT_MS * 1000)
+    {
+        uint32 primask = zf_interrupt_global_disable();
+        if (CURRENT_STATE_CALIBRATING == g_current_state)
+        {
+            g_current_state = CURRENT_STATE_BYPASS;
+        }
+        zf_interrupt_global_enable(primask);
+        // 控制任务中不打印，由 speed_control_background_task 在主循环中检测 BYPASS 状态后输出提示
+    }
+    if (CURRENT_STATE_BYPASS == g_current_state)
+    {
+        motion_set_motor_duty(duty);
+    }
+}
+
+void current_control_set_current(float current_a)
+{
+    if (current_a > CURRENT_LIMIT_A)  current_a = CURRENT_LIMIT_A;
+    if (current_a < -CURRENT_LIMIT_A) current_a = -CURRENT_LIMIT_A;
+    g_current_target_a = current_a;
+}
+
+float current_control_get_current(void)
+{
+    return g_current_a;
+}
+
+float current_control_get_current_filtered(void)
+{
+    return g_current_filtered_a;
+}
+
+float current_control_get_duty_ceiling(void)
+{
+    return g_duty_ceiling;
+}
+
+current_state_e current_control_get_state(void)
+{
+    return g_current_state;
+}
+
+void current_control_clear_fault(void)
+{
+    if (CURRENT_STATE_FAULT != g_current_state) return;
+
+    uint32 primask = zf_interrupt_global_disable();
+    g_trip_counter = 0;
+    g_duty_request = 0.0f;
+    g_current_target_a = 0.0f;
+    pid_ctrl_reset(&g_limit_pid, PID_REAL(1.0f));
+    pid_ctrl_reset(&g_current_pid, PID_REAL(0.0f));
+    g_current_state = CURRENT_STATE_RUNNING;
+    zf_interrupt_global_enable(primask);
+}
@@ -0,0 +1,116 @@
+/*
+ * current_control.h
+ *
+ *  Created on: 2025年7月24日
+ *      Author: 20766
+ *
+ *  [文件说明] 电机电流采样与电流内环。
+ *            HRTIM 主定时器在每个 PWM 周期的脉冲中点触发 ADC 注入组转换，中心对齐 PWM 的中点
+ *            采到的是电流平均值且远离开关沿；转换完成中断里读数、限流并更新占空比，CPU 不等待转换。
+ *            两种工作模式:
+ *              DUTY   模式: 速度环给出占空比，本模块只做限流，过流时自动压低占空比上限。
+ *              TORQUE 模式: 外部给出电流目标，本模块用 PI 闭环电流 (即转矩)。
+ *            任何模式下瞬时电流连续 CURRENT_TRIP_COUNT 次超过 CURRENT_TRIP_A 即关断输出并锁存故障，
+ *            用于堵转、短路保护，需调用 current_control_clear_fault() 才能恢复。
+ */
+
+#ifndef USER_CODE_CURRENT_CONTROL_H_
+#define USER_CODE_CURRENT_CONTROL_H_
+
+#include "zf_libraries_headfile.h"
+#include <stdint.h>
+
+// ================== 配置与宏定义 ==================
+
+// ---- 采样硬件 (这是最需要你确认和修改的地方！) ----
+#define CURRENT_SENSE_ADC_INDEX       (ADC_1)
+#define CURRENT_SENSE_ADC_CHANNEL     (ADC1_CH1_B2)          // [请修改] 电流放大器输出所接的 ADC 引脚
+#define CURRENT_SENSE_HRTIM_TRIGGER   (HRTIM_ADC_TRIGGER_2)  // HRTIM ADC 触发输出 2 接 ADC1/2 注入组
+#define CURRENT_SENSE_ADC_JEXTSEL     (27)                   // [请核对] 参考手册中 ADC1 注入组 hrtim_adc_trg2 的 JEXTSEL 编号
+#define CURRENT_SENSE_VREF            (3.3f)                 // ADC 参考电压 (V)
+#define CURRENT_SENSE_ADC_MAX         (4095.0f)              // 12 位 ADC 满量程
+#define CURRENT_SENSE_SHUNT_OHM       (0.005f)               // [请修改] 采样电阻 (Ω)
+#define CURRENT_SENSE_AMP_GAIN        (20.0f)                // [请修改] 电流放大器增益 (V/V)
+#define CURRENT_SENSE_DIRECTION       (1.0f)                 // 正占空比对应正电流时为 1，否则改为 -1
+#define CURRENT_SENSE_OFFSET_SAMPLES  (256)                  // 上电零偏标定的采样次数 (输出为 0 时采集)
+#define CURRENT_SENSE_FILTER_ALPHA    (0.02f)                // 上报用一阶低通系数，不参与控制
+#define CURRENT_SENSE_CALIB_TIMEOUT_MS (100)                 // 零偏标定超时 (ms)，正常约 15ms 完成，超时说明 ADC 没有被触发
+
+// ---- 电流环 ----
+#define CURRENT_LOOP_DIVIDER          (2)       // 每 N 个 PWM 周期执行一次电流环 (17kHz / 2 = 8.5kHz)
+#define CURRENT_LIMIT_A               (8.0f)    // 持续电流上限 (A)，超过后限流环压低占空比
+#define CURRENT_LIMIT_KP              (0.02f)   // 限流环比例增益 (占空比 / A)
+#define CURRENT_LIMIT_KI              (0.002f)  // 限流环积分增益 (占空比 / A / 周期)
+#define CURRENT_PI_KP                 (0.03f)   // 转矩模式电流环比例增益 (占空比 / A)
+#define CURRENT_PI_KI                 (0.003f)  // 转矩模式电流环积分增益 (占空比 / A / 周期)
+#define CURRENT_TRIP_A                (15.0f)   // 瞬时过流关断阈值 (A)
+#define CURRENT_TRIP_COUNT            (3)       // 连续超过阈值的采样次数，滤除单点毛刺
+
+typedef enum
+{
+    CURRENT_MODE_DUTY,          // 占空比直通 + 限流
+    CURRENT_MODE_TORQUE,        // 电流 (转矩) 闭环
+} current_mode_e;
+
+typedef enum
+{
+    CURRENT_STATE_CALIBRATING,  // 上电零偏标定中，输出强制为 0
+    CURRENT_STATE_RUNNING,
+    CURRENT_STATE_FAULT,        // 过流关断，输出锁定为 0
+    CURRENT_STATE_BYPASS,       // 标定超时 (引脚或触发配置有误)，占空比直通不限流
+} current_state_e;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化电流采样与电流环
+ * @note   必须在 motion_control_init() 之后调用 (依赖 HRTIM 已初始化)。
+ *         初始化后先进行零偏标定，标定期间电机输出为 0。
+ */
+void current_control_init(void);
+
+/**
+ * @brief  切换工作模式，切换时内部 PI 以当前占空比无扰预置
+ */
+void current_control_set_mode(current_mode_e mode);
+
+/**
+ * @brief  DUTY 模式下设置请求占空比
+ * @param  duty: -1.0 到 +1.0，实际输出受限流环约束
+ * @note   标定超过 CURRENT_SENSE_CALIB_TIMEOUT_MS 仍未完成时进入 BYPASS 状态，
+ *         此后直接调用 motion_set_motor_duty 施加，保证采样电路或触发配置有误时电机仍可运行。
+ */
+void current_control_set_duty(float duty);
+
+/**
+ * @brief  TORQUE 模式下设置电流目标
+ * @param  current_a: 目标电流 (A)，会被限制在 ±CURRENT_LIMIT_A 内
+ */
+void current_control_set_current(float current_a);
+
+/**
+ * @brief  获取最近一次采样的电流 (A)，带符号
+ */
+float current_control_get_current(void);
+
+/**
+ * @brief  获取低通滤波后的电流 (A)，用于显示与上报
+ */
+float current_control_get_current_filtered(void);
+
+/**
+ * @brief  获取限流环给出的占空比上限 (0 - 1)，小于 1 表示正在限流
+ */
+float current_control_get_duty_ceiling(void);
+
+/**
+ * @brief  获取模块状态
+ */
+current_state_e current_control_get_state(void);
+
+/**
+ * @brief  清除过流故障并恢复输出
+ */
+void current_control_clear_fault(void);
+
+#endif /* USER_CODE_CURRENT_CONTROL_H_ */
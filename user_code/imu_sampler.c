@@ -0,0 +1,358 @@
+/*
+ * imu_sampler.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ */
+#include "imu_sampler.h"
+
+#if IMU_SAMPLER_ENABLE
+
+// LSM6DSR 寄存器 (IMU660RB 与 IMU963RA 相同)
+#define IMU_SAMPLER_DEV_ADDR            (0x6B)  // 仅 IIC 接口使用，SPI 接口忽略
+#define IMU_SAMPLER_SPI_R               (0x80)
+#define IMU_SAMPLER_REG_FIFO_CTRL1      (0x07)  // WTM[7:0]
+#define IMU_SAMPLER_REG_FIFO_CTRL2      (0x08)  // WTM[8]
+#define IMU_SAMPLER_REG_FIFO_CTRL3      (0x09)  // BDR_GY[7:4] BDR_XL[3:0]
+#define IMU_SAMPLER_REG_FIFO_CTRL4      (0x0A)  // FIFO_MODE[2:0]
+#define IMU_SAMPLER_REG_INT1_CTRL       (0x0D)
+#define IMU_SAMPLER_REG_FIFO_STATUS1    (0x3A)  // DIFF_FIFO[7:0]，FIFO_STATUS2 紧随其后
+#define IMU_SAMPLER_REG_FIFO_DATA_OUT   (0x78)  // 标签 + XYZ 共 7 字节，连续读取时地址在 0x78 ~ 0x7E 之间循环
+
+#define IMU_SAMPLER_FIFO_BDR_1666HZ     (0x88)  // 陀螺仪与加速度计均以 1666Hz 批量写入
+#define IMU_SAMPLER_FIFO_MODE_BYPASS    (0x00)
+#define IMU_SAMPLER_FIFO_MODE_CONTINUOUS (0x06)
+#define IMU_SAMPLER_INT1_FIFO_TH        (0x08)
+#define IMU_SAMPLER_STATUS2_DIFF_MASK   (0x03)  // DIFF_FIFO[9:8]
+#define IMU_SAMPLER_STATUS2_OVR         (0x40)  // FIFO_OVR_IA
+
+#define IMU_SAMPLER_TAG_GYRO            (0x01)  // 标签字节高 5 位
+#define IMU_SAMPLER_TAG_ACC             (0x02)
+#define IMU_SAMPLER_WORD_SIZE           (7)
+#define IMU_SAMPLER_WATERMARK           (IMU_SAMPLER_BATCH * 2)
+#define IMU_SAMPLER_READ_WORDS_MAX      (IMU_SAMPLER_READ_MAX * 2)
+
+#define IMU_SAMPLER_PERIOD_Q8_NOMINAL   ((uint32_t)((1000000ULL * 256ULL) / IMU_SAMPLER_ODR_HZ))
+#define IMU_SAMPLER_PERIOD_Q8_TOLERANCE (IMU_SAMPLER_PERIOD_Q8_NOMINAL / 20)    // 周期估计只接受 ±5% 以内的测量值
+#define IMU_SAMPLER_INT_PIN             ((zf_gpio_pin_enum)(IMU_SAMPLER_INT_EXTI & EXTI_PIN_INDEX_MASK))
+
+// ================== 内部变量 ==================
+
+static zf_ring_obj_struct   g_sample_ring;
+static uint8                g_sample_buffer[IMU_SAMPLER_BUFFER_SIZE * sizeof(imu_sampler_sample_t)];
+
+// DMA 收发缓冲区 (位于 SRAM，不能放在 DTCM)
+static uint8                g_status_cmd;
+static uint8                g_status_data[2];
+static uint8                g_fifo_cmd;
+static uint8                g_fifo_data[IMU_SAMPLER_READ_WORDS_MAX * IMU_SAMPLER_WORD_SIZE];
+
+static zf_spi_dma_descriptor_struct g_status_descriptor[2];
+static zf_spi_dma_descriptor_struct g_fifo_descriptor[2];
+static zf_spi_dma_transfer_struct   g_status_transfer;
+static zf_spi_dma_transfer_struct   g_fifo_transfer;
+
+// 以下变量只在 EXTI 与 SPI DMA 中断 (同一优先级，互不嵌套) 以及关中断的后台任务中访问
+static volatile bool        g_busy = false;             // 状态读取或数据读取进行中
+static uint32_t             g_fifo_words = 0;           // 本次突发读取的 FIFO 字数
+
+static int16_t              g_pending_acc[3];
+static int16_t              g_pending_gyro[3];
+static uint8_t              g_pending_mask = 0;         // bit0 加速度计 bit1 陀螺仪
+
+static uint32_t             g_sample_index = 0;         // 已配对的样本序号 (只增)
+static uint32_t             g_anchor_index = 0;         // 对齐到中断时刻的样本序号
+static uint32_t             g_anchor_us = 0;            // 中断时刻
+static bool                 g_anchor_valid = false;     // 上一次的对齐点可用于估计周期
+static uint32_t             g_period_q8 = IMU_SAMPLER_PERIOD_Q8_NOMINAL;
+
+static imu_sampler_stats_t  g_stats;
+
+// ================== 内部函数 ==================
+
+static void imu_sampler_write_register(uint8 reg, uint8 data)
+{
+    imu_interface_write_8bit_register(&imu_interface_default_obj, IMU_SAMPLER_DEV_ADDR, reg, data);
+}
+
+/**
+ * @brief  提交 FIFO_STATUS1/2 读取
+ * @note   调用前 g_busy 必须为 false，且处于 EXTI / SPI DMA 中断或关中断状态。
+ */
+static void imu_sampler_start_status_read(void)
+{
+    g_busy = true;
+    if (zf_spi_dma_transfer(IMU_INTERFACE_SPI_INDEX, &g_status_transfer))
+    {
+        g_stats.spi_error_count++;
+        g_busy = false;
+    }
+}
+
+/**
+ * @brief  以本次中断更新对齐点，并根据与上一次对齐点的间隔修正采样周期
+ * @param  now_us: 中断时刻
+ * @param  index: 此刻刚好写入 FIFO 的样本序号
+ */
+static void imu_sampler_update_anchor(uint32_t now_us, uint32_t index)
+{
+    if (g_anchor_valid)
+    {
+        const uint32_t sample_span = index - g_anchor_index;
+        if (sample_span > 0 && sample_span <= IMU_SAMPLER_BUFFER_SIZE)
+        {
+            const uint32_t measured_q8 = (uint32_t)(((uint64_t)(now_us - g_anchor_us) << 8) / sample_span);
+            if (measured_q8 + IMU_SAMPLER_PERIOD_Q8_TOLERANCE >= IMU_SAMPLER_PERIOD_Q8_NOMINAL &&
+                measured_q8 <= IMU_SAMPLER_PERIOD_Q8_NOMINAL + IMU_SAMPLER_PERIOD_Q8_TOLERANCE)
+            {
+                // 一阶低通，抑制中断响应抖动
+                g_period_q8 = (uint32_t)((int32_t)g_period_q8 + ((int32_t)(measured_q8 - g_period_q8) / 8));
+            }
+        }
+    }
+    g_anchor_index = index;
+    g_anchor_us = now_us;
+    g_anchor_valid = true;
+}
+
+static void imu_sampler_push_sample(void)
+{
+    imu_sampler_sample_t sample;
+    const int32_t offset = (int32_t)(g_sample_index - g_anchor_index);
+
+    sample.timestamp_us = g_anchor_us + (uint32_t)(((int64_t)offset * (int64_t)g_period_q8) >> 8);
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        sample.acc[i] = g_pending_acc[i];
+        sample.gyro[i] = g_pending_gyro[i];
+    }
+    g_sample_index++;
+
+    // 只整样本写入，保证读取方按样本大小对齐
+    if (zf_ring_free(&g_sample_ring) >= sizeof(sample))
+    {
+        zf_ring_write(&g_sample_ring, &sample, sizeof(sample));
+        g_stats.sample_count++;
+    }
+    else
+    {
+        g_stats.drop_count++;
+    }
+}
+
+static void imu_sampler_parse_fifo(void)
+{
+    const uint8 *word = g_fifo_data;
+    for (uint32_t i = 0; i < g_fifo_words; i++, word += IMU_SAMPLER_WORD_SIZE)
+    {
+        int16_t *axis = NULL;
+        uint8_t mask = 0;
+        switch (word[0] >> 3)
+        {
+            case IMU_SAMPLER_TAG_GYRO: axis = g_pending_gyro; mask = 0x02; break;
+            case IMU_SAMPLER_TAG_ACC:  axis = g_pending_acc;  mask = 0x01; break;
+            default: break;                                 // 其他标签 (时间戳、温度等) 未使能，忽略
+        }
+        if (NULL == axis) continue;
+
+        axis[0] = (int16_t)(((uint16_t)word[2] << 8) | word[1]);
+        axis[1] = (int16_t)(((uint16_t)word[4] << 8) | word[3]);
+        axis[2] = (int16_t)(((uint16_t)word[6] << 8) | word[5]);
+        g_pending_mask |= mask;
+
+        if (0x03 == g_pending_mask)
+        {
+            imu_sampler_push_sample();
+            g_pending_mask = 0;
+        }
+    }
+}
+
+/**
+ * @brief  INT1 上升沿 (FIFO 达到水位线) EXTI 回调
+ */
+static void imu_sampler_on_int1(uint32 event, void *ptr)
+{
+    (void)event;
+    (void)ptr;
+    const uint32_t now_us = (uint32_t)zf_time_now_us();
+
+    // 读取进行中时本次中断没有确定的对齐关系，读取完成后根据 INT1 电平继续读取
+    if (g_busy) return;
+
+    imu_sampler_update_anchor(now_us, g_sample_index + IMU_SAMPLER_BATCH - 1U);
+    imu_sampler_start_status_read();
+}
+
+/**
+ * @brief  FIFO_STATUS1/2 读取完成回调 (SPI DMA 中断上下文)
+ */
+static void imu_sampler_on_status(uint32 state, void *ptr)
+{
+    (void)ptr;
+    if (SPI_DMA_STATE_DONE != state)
+    {
+        if (SPI_DMA_STATE_ABORT != state) g_stats.spi_error_count++;
+        g_busy = false;
+        return;
+    }
+
+    if (g_status_data[1] & IMU_SAMPLER_STATUS2_OVR)
+    {
+        // 片内 FIFO 已覆盖旧数据，样本序号不再连续，下一次中断重新对齐
+        g_stats.fifo_overrun_count++;
+        g_anchor_valid = false;
+    }
+
+    uint32_t words = ((uint32_t)(g_status_data[1] & IMU_SAMPLER_STATUS2_DIFF_MASK) << 8) | g_status_data[0];
+    words &= ~1U;                                           // 只读取成对的字，保持加速度计与陀螺仪配对
+    if (words > IMU_SAMPLER_READ_WORDS_MAX) words = IMU_SAMPLER_READ_WORDS_MAX;
+    if (0 == words)
+    {
+        g_busy = false;
+        return;
+    }
+
+    g_fifo_words = words;
+    g_fifo_descriptor[1].length = words * IMU_SAMPLER_WORD_SIZE;
+    if (zf_spi_dma_transfer(IMU_INTERFACE_SPI_INDEX, &g_fifo_transfer))
+    {
+        g_stats.spi_error_count++;
+        g_busy = false;
+    }
+}
+
+/**
+ * @brief  FIFO 数据突发读取完成回调 (SPI DMA 中断上下文)
+ */
+static void imu_sampler_on_fifo(uint32 state, void *ptr)
+{
+    (void)ptr;
+    if (SPI_DMA_STATE_DONE != state)
+    {
+        if (SPI_DMA_STATE_ABORT != state) g_stats.spi_error_count++;
+        g_busy = false;
+        return;
+    }
+
+    g_stats.burst_count++;
+    imu_sampler_parse_fifo();
+
+    // 仍高于水位线 (读取期间又写入了一批或单次读取上限不够) 时不会再有上升沿，直接继续读取
+    g_busy = false;
+    if (zf_gpio_get_level(IMU_SAMPLER_INT_PIN))
+    {
+        imu_sampler_start_status_read();
+    }
+}
+
+// ================== API函数实现 ==================
+
+uint8_t imu_sampler_init(void)
+{
+    uint8_t result = 1;
+
+    do
+    {
+        zf_ring_init(&g_sample_ring, g_sample_buffer, sizeof(g_sample_buffer));
+        memset(&g_stats, 0, sizeof(g_stats));
+        g_busy = false;
+        g_pending_mask = 0;
+        g_sample_index = 0;
+        g_anchor_valid = false;
+        g_period_q8 = IMU_SAMPLER_PERIOD_Q8_NOMINAL;
+
+        // 1. 接口初始化、自检与基本配置由设备驱动完成，再把输出频率提到 1666Hz
+#if IMU_SAMPLER_USE_IMU963RA
+        if (imu963ra_init()) break;
+        imu963ra_set_config(IMU_CONFIG_ACC_OUTPUT_RATE_32_MUL);
+        imu963ra_set_config(IMU_CONFIG_GYRO_OUTPUT_RATE_32_MUL);
+#else
+        if (imu660rb_init()) break;
+        imu660rb_set_config(IMU_CONFIG_ACC_OUTPUT_RATE_32_MUL);
+        imu660rb_set_config(IMU_CONFIG_GYRO_OUTPUT_RATE_32_MUL);
+#endif
+
+        // 2. FIFO 先切到旁路模式清空，再设置水位线与批量频率，INT1 改为只输出水位线中断
+        imu_sampler_write_register(IMU_SAMPLER_REG_FIFO_CTRL4, IMU_SAMPLER_FIFO_MODE_BYPASS);
+        imu_sampler_write_register(IMU_SAMPLER_REG_FIFO_CTRL1, (uint8)(IMU_SAMPLER_WATERMARK & 0xFF));
+        imu_sampler_write_register(IMU_SAMPLER_REG_FIFO_CTRL2, (uint8)((IMU_SAMPLER_WATERMARK >> 8) & 0x01));
+        imu_sampler_write_register(IMU_SAMPLER_REG_FIFO_CTRL3, IMU_SAMPLER_FIFO_BDR_1666HZ);
+        imu_sampler_write_register(IMU_SAMPLER_REG_INT1_CTRL, IMU_SAMPLER_INT1_FIFO_TH);
+
+        // 3. 状态读取: 1 字节地址 + 2 字节状态；数据读取: 1 字节地址 + N 个 FIFO 字，长度在状态读取完成后填写
+        g_status_cmd = IMU_SAMPLER_REG_FIFO_STATUS1 | IMU_SAMPLER_SPI_R;
+        g_status_descriptor[0] = (zf_spi_dma_descriptor_struct){ &g_status_cmd, NULL, 1, &g_status_descriptor[1] };
+        g_status_descriptor[1] = (zf_spi_dma_descriptor_struct){ NULL, g_status_data, sizeof(g_status_data), NULL };
+        g_status_transfer = (zf_spi_dma_transfer_struct){ .descriptor = &g_status_descriptor[0], .cs_pin = IMU_INTERFACE_CS_PIN,
+                                                          .callback = imu_sampler_on_status, .callback_ptr = NULL };
+
+        g_fifo_cmd = IMU_SAMPLER_REG_FIFO_DATA_OUT | IMU_SAMPLER_SPI_R;
+        g_fifo_descriptor[0] = (zf_spi_dma_descriptor_struct){ &g_fifo_cmd, NULL, 1, &g_fifo_descriptor[1] };
+        g_fifo_descriptor[1] = (zf_spi_dma_descriptor_struct){ NULL, g_fifo_data, IMU_SAMPLER_WORD_SIZE, NULL };
+        g_fifo_transfer = (zf_spi_dma_transfer_struct){ .descriptor = &g_fifo_descriptor[0], .cs_pin = IMU_INTERFACE_CS_PIN,
+                                                        .callback = imu_sampler_on_fifo, .callback_ptr = NULL };
+
+        if (zf_spi_dma_init(IMU_INTERFACE_SPI_INDEX)) break;
+
+        // 4. EXTI 与 SPI DMA 中断同优先级，二者互不嵌套，内部状态无需额外保护
+        if (zf_exti_channel_init(IMU_SAMPLER_INT_EXTI, EXTI_TRIGGER_TYPE_RISING, imu_sampler_on_int1, NULL)) break;
+        zf_exti_set_interrupt_priority(IMU_SAMPLER_INT_EXTI, SPI_DMA_IRQ_PRIORITY);
+
+        // 5. 最后进入连续模式，开始批量写入 FIFO
+        imu_sampler_write_register(IMU_SAMPLER_REG_FIFO_CTRL4, IMU_SAMPLER_FIFO_MODE_CONTINUOUS);
+
+        // 6. 此后 SPI 只允许 DMA 访问，imu660rb_get_acc 等阻塞接口或同一 SPI 上的无线模块再访问时断言报错
+        zf_spi_dma_set_exclusive(IMU_INTERFACE_SPI_INDEX, ZF_TRUE);
+
+        result = 0;
+    } while (0);
+
+    return result;
+}
+
+uint32_t imu_sampler_available(void)
+{
+    return zf_ring_used(&g_sample_ring) / sizeof(imu_sampler_sample_t);
+}
+
+uint32_t imu_sampler_read(imu_sampler_sample_t *samples, uint32_t max_count)
+{
+    if (NULL == samples) return 0;
+
+    uint32_t count = imu_sampler_available();
+    if (count > max_count) count = max_count;
+    if (0 == count) return 0;
+
+    return zf_ring_read(&g_sample_ring, samples, count * sizeof(imu_sampler_sample_t)) / sizeof(imu_sampler_sample_t);
+}
+
+void imu_sampler_get_stats(imu_sampler_stats_t *stats)
+{
+    if (NULL == stats) return;
+
+    uint32 primask = zf_interrupt_global_disable();
+    *stats = g_stats;
+    stats->period_q8 = g_period_q8;
+    zf_interrupt_global_enable(primask);
+}
+
+void imu_sampler_background_task(void)
+{
+    uint32 primask = zf_interrupt_global_disable();
+    if (!g_busy && zf_gpio_get_level(IMU_SAMPLER_INT_PIN))
+    {
+        imu_sampler_start_status_read();
+    }
+    zf_interrupt_global_enable(primask);
+}
+
+#else
+
+uint8_t imu_sampler_init(void) { return 0; }
+uint32_t imu_sampler_available(void) { return 0; }
+uint32_t imu_sampler_read(imu_sampler_sample_t *samples, uint32_t max_count) { (void)samples; (void)max_count; return 0; }
+void imu_sampler_get_stats(imu_sampler_stats_t *stats) { if (NULL != stats) memset(stats, 0, sizeof(*stats)); }
+void imu_sampler_background_task(void) {}
+
+#endif
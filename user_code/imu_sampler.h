@@ -0,0 +1,90 @@
+/*
+ * imu_sampler.h
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] 基于传感器片内 FIFO 的 IMU 中断采集服务。
+ *            IMU660RB / IMU963RA 均为 LSM6DSR 内核，FIFO 寄存器一致:
+ *              加速度计与陀螺仪以 IMU_SAMPLER_ODR_HZ 批量写入片内 FIFO (连续模式，每个字 7 字节 = 标签 + XYZ)
+ *              FIFO 字数达到水位线时 INT1 拉高，触发 EXTI 中断并记录时间戳
+ *              EXTI 中断通过 SPI DMA 读 FIFO_STATUS1/2 得到字数，完成回调中再提交一次突发读取整批 FIFO 数据
+ *              数据读取完成回调中按标签配对成 (加速度, 陀螺仪) 样本，推算每个样本的时间戳后写入环形缓冲区
+ *            整个过程 CPU 只在 EXTI 与两次 DMA 完成中断中各执行一小段代码，不再逐个寄存器轮询。
+ *            样本时间戳: 触发中断时 FIFO 中恰好有水位线对应的样本数，以此将最后一个样本对齐到中断时刻，
+ *            其余样本按采样周期前后推算；采样周期由相邻两次中断的时间差与样本数差在线估计 (补偿传感器晶振偏差)。
+ *            需要将 IMU 模块的 INT1 引脚连接到 IMU_SAMPLER_INT_EXTI 对应的引脚。
+ */
+
+#ifndef USER_CODE_IMU_SAMPLER_H_
+#define USER_CODE_IMU_SAMPLER_H_
+
+#include "zf_libraries_headfile.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+#define IMU_SAMPLER_ENABLE              (0)             // 采集服务开关，关闭时所有接口为空操作，不占用 SPI DMA 与 EXTI
+#define IMU_SAMPLER_USE_IMU963RA        (0)             // 0: IMU660RB  1: IMU963RA (只使用其中的加速度计与陀螺仪)
+#define IMU_SAMPLER_INT_EXTI            (EXTI1_CH9_D9)  // IMU INT1 引脚对应的 EXTI 通道 (SPI 接法下 D9 空闲，按实际接线修改)
+
+#define IMU_SAMPLER_ODR_HZ              (1666)          // 加速度计与陀螺仪输出及 FIFO 批量频率 (固定为 1666Hz 档位)
+#define IMU_SAMPLER_BATCH               (8)             // 水位线对应的样本数，每个样本占 2 个 FIFO 字，即每 8 个样本中断一次
+#define IMU_SAMPLER_READ_MAX            (32)            // 单次突发读取的最大样本数，超过时分多次读取
+#define IMU_SAMPLER_BUFFER_SIZE         (256)           // 环形缓冲区样本数，必须为 2 的幂 (每个样本 16 字节)
+
+typedef struct
+{
+    uint32_t timestamp_us;              // 采样时刻 zf_time_now_us 低 32 位
+    int16_t  acc[3];                    // 加速度计原始值 XYZ (量程见 zf_device_imu_interface.h 默认配置)
+    int16_t  gyro[3];                   // 陀螺仪原始值 XYZ
+} imu_sampler_sample_t;
+
+typedef struct
+{
+    uint32_t sample_count;              // 写入环形缓冲区的样本总数
+    uint32_t burst_count;               // FIFO 突发读取次数
+    uint32_t drop_count;                // 环形缓冲区满丢弃的样本数
+    uint32_t fifo_overrun_count;        // 片内 FIFO 溢出次数 (读取不及时，最旧的数据被覆盖)
+    uint32_t spi_error_count;           // SPI DMA 传输异常次数
+    uint32_t period_q8;                 // 当前估计的采样周期 us (Q8 定点，除以 256 得到 us)
+} imu_sampler_stats_t;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化 IMU 并启动 FIFO 中断采集
+ * @return uint8_t: 0 成功，非 0 为 IMU 初始化或 SPI DMA / EXTI 初始化失败
+ * @note   内部调用 imu660rb_init / imu963ra_init 完成接口与基本配置，然后配置 FIFO 与 INT1，
+ *         之后 IMU 所在的 SPI 由本服务通过 DMA 独占访问 (zf_spi_dma_set_exclusive)，
+ *         再调用 imu660rb_get_acc 等轮询接口或使用同一 SPI 上的无线模块会触发 SPI 驱动断言。
+ */
+uint8_t imu_sampler_init(void);
+
+/**
+ * @brief  查询环形缓冲区中可读取的样本数
+ */
+uint32_t imu_sampler_available(void);
+
+/**
+ * @brief  读出样本
+ * @param  samples: 样本存放地址
+ * @param  max_count: 最多读出的样本数
+ * @return uint32_t: 实际读出的样本数
+ * @note   只能由一个读取方调用 (主循环或某一个任务)，按时间先后顺序输出。
+ */
+uint32_t imu_sampler_read(imu_sampler_sample_t *samples, uint32_t max_count);
+
+/**
+ * @brief  获取采集统计信息
+ */
+void imu_sampler_get_stats(imu_sampler_stats_t *stats);
+
+/**
+ * @brief  后台任务 (在主循环中调用)
+ * @note   INT1 保持高电平而没有传输进行时 (错过了上升沿) 重新发起一次读取，避免采集停止。
+ */
+void imu_sampler_background_task(void);
+
+#endif /* USER_CODE_IMU_SAMPLER_H_ */
@@ -0,0 +1,146 @@
+/*
+ * latency_trace.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ */
+#include "latency_trace.h"
+
+#if LATENCY_TRACE_ENABLE
+
+#define LATENCY_TRACE_INDEX_MASK    (LATENCY_TRACE_BUFFER_SIZE - 1U)
+
+// ================== 内部变量 ==================
+
+static latency_trace_record_t g_trace_buffer[LATENCY_TRACE_BUFFER_SIZE];
+static volatile uint32_t      g_trace_head = 0;         // 写入计数 (只增)
+static volatile uint32_t      g_trace_tail = 0;         // 读出计数 (只增)
+static volatile uint32_t      g_trace_drop_count = 0;
+static uint32_t               g_trace_drop_reported = 0;
+
+static volatile uint16_t      g_trace_id = 0;
+static volatile uint32_t      g_rx_eol_us = 0;          // 最近一次收到 '\n' 的时间戳
+static volatile uint32_t      g_trace_deferred = 0;     // 预约的阶段: 有效位 | 阶段 << 16 | 编号，单字读写不会被打断
+
+#define LATENCY_TRACE_DEFERRED_VALID    (0x80000000U)
+
+// ================== 内部函数 ==================
+
+/**
+ * @brief  GNSS 语句接收完成回调 (串口中断上下文)
+ */
+static void latency_trace_on_sentence(uint32 event, void *ptr)
+{
+    (void)event;
+    (void)ptr;
+    g_rx_eol_us = latency_trace_now_us();
+}
+
+static void latency_trace_write(uint16_t trace_id, latency_trace_stage_e stage, uint32_t timestamp_us)
+{
+    uint32 primask = zf_interrupt_global_disable();
+    if (g_trace_head - g_trace_tail >= LATENCY_TRACE_BUFFER_SIZE)
+    {
+        g_trace_drop_count++;
+    }
+    else
+    {
+        latency_trace_record_t *record = &g_trace_buffer[g_trace_head & LATENCY_TRACE_INDEX_MASK];
+        record->timestamp_us = timestamp_us;
+        record->trace_id = trace_id;
+        record->stage = (uint8_t)stage;
+        record->reserved = 0;
+        g_trace_head++;
+    }
+    zf_interrupt_global_enable(primask);
+}
+
+// ================== API函数实现 ==================
+
+void latency_trace_init(void)
+{
+    g_trace_head = 0;
+    g_trace_tail = 0;
+    g_trace_drop_count = 0;
+    g_trace_drop_reported = 0;
+    g_trace_id = 0;
+    g_rx_eol_us = 0;
+    g_trace_deferred = 0;
+
+    gnss_set_sentence_callback(latency_trace_on_sentence, NULL);
+}
+
+uint32_t latency_trace_now_us(void)
+{
+    return (uint32_t)zf_time_now_us();
+}
+
+uint16_t latency_trace_begin(void)
+{
+    const uint16_t trace_id = (uint16_t)(g_trace_id + 1U);
+    g_trace_id = trace_id;
+    latency_trace_write(trace_id, LATENCY_STAGE_RX_EOL, g_rx_eol_us);
+    return trace_id;
+}
+
+uint16_t latency_trace_current_id(void)
+{
+    return g_trace_id;
+}
+
+void latency_trace_point(uint16_t trace_id, latency_trace_stage_e stage)
+{
+    if (stage >= LATENCY_STAGE_NUM) return;
+    latency_trace_write(trace_id, stage, latency_trace_now_us());
+}
+
+void latency_trace_defer(uint16_t trace_id, latency_trace_stage_e stage)
+{
+    if (stage >= LATENCY_STAGE_NUM) return;
+    g_trace_deferred = LATENCY_TRACE_DEFERRED_VALID | ((uint32_t)stage << 16) | trace_id;
+}
+
+void latency_trace_flush_deferred(void)
+{
+    uint32 primask = zf_interrupt_global_disable();
+    const uint32_t deferred = g_trace_deferred;
+    g_trace_deferred = 0;
+    zf_interrupt_global_enable(primask);
+
+    if (!(deferred & LATENCY_TRACE_DEFERRED_VALID)) return;
+    latency_trace_point((uint16_t)(deferred & 0xFFFFU), (latency_trace_stage_e)((deferred >> 16) & 0xFFU));
+}
+
+void latency_trace_background_task(void)
+{
+    if (g_trace_head - g_trace_tail < LATENCY_TRACE_DUMP_THRESHOLD) return;
+
+    // 只输出进入时已有的记录，输出期间新写入的留到下一次
+    const uint32_t head = g_trace_head;
+    while (g_trace_tail != head)
+    {
+        const latency_trace_record_t record = g_trace_buffer[g_trace_tail & LATENCY_TRACE_INDEX_MASK];
+        g_trace_tail++;
+        printf("$LT,%u,%u,%lu\r\n", record.trace_id, record.stage, (unsigned long)record.timestamp_us);
+    }
+
+    const uint32_t drop_count = g_trace_drop_count;
+    if (drop_count != g_trace_drop_reported)
+    {
+        printf("$LT,DROP,%lu\r\n", (unsigned long)(drop_count - g_trace_drop_reported));
+        g_trace_drop_reported = drop_count;
+    }
+}
+
+#else
+
+void latency_trace_init(void) {}
+uint32_t latency_trace_now_us(void) { return 0; }
+uint16_t latency_trace_begin(void) { return 0; }
+uint16_t latency_trace_current_id(void) { return 0; }
+void latency_trace_point(uint16_t trace_id, latency_trace_stage_e stage) { (void)trace_id; (void)stage; }
+void latency_trace_defer(uint16_t trace_id, latency_trace_stage_e stage) { (void)trace_id; (void)stage; }
+void latency_trace_flush_deferred(void) {}
+void latency_trace_background_task(void) {}
+
+#endif
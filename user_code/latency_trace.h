@@ -0,0 +1,106 @@
+/*
+ * latency_trace.h
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] GNSS 定位到舵机输出的端到端延迟跟踪。
+ *            每一帧定位分配一个跟踪编号，沿流水线在以下各点记录 (编号, 阶段, 时间戳) 到 RAM 环形缓冲区:
+ *              RX_EOL     : 串口中断收到该帧最后一条语句的 '\n'
+ *              PARSED     : gnss_data_parse 校验并解析完成
+ *              PUBLISHED  : TOPIC_GNSS_FIX 发布完成
+ *              NAV_DONE   : 导航计算完成，即将下发舵机指令
+ *              PWM_COMMIT : 舵机比较值已由速度环任务末尾的 motion_control_commit 写入预装载寄存器
+ *                           (导航只暂存比较值并预约本阶段，在下一个速度环周期提交，再在下一个 PWM 周期边界输出)
+ *            时间戳取 zf_time_now_us 的低 32 位 (约 71 分钟回绕一次，相邻记录间隔远小于此值)。
+ *            主循环中按文本行 "$LT,<编号>,<阶段>,<时间戳us>" 输出到调试串口，
+ *            由 tools/latency_trace_decode.py 在上位机统计各阶段延迟分布。
+ */
+
+#ifndef USER_CODE_LATENCY_TRACE_H_
+#define USER_CODE_LATENCY_TRACE_H_
+
+#include "zf_libraries_headfile.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+#define LATENCY_TRACE_ENABLE            (0)     // 跟踪开关，关闭时所有接口为空操作，不占用串口带宽
+#define LATENCY_TRACE_BUFFER_SIZE       (256)   // 环形缓冲区记录数，必须为 2 的幂 (每条 8 字节)
+#define LATENCY_TRACE_DUMP_THRESHOLD    (64)    // 缓冲区中累计到该数量的记录后，后台任务一次性输出
+
+typedef enum
+{
+    LATENCY_STAGE_RX_EOL,
+    LATENCY_STAGE_PARSED,
+    LATENCY_STAGE_PUBLISHED,
+    LATENCY_STAGE_NAV_DONE,
+    LATENCY_STAGE_PWM_COMMIT,
+    LATENCY_STAGE_NUM,
+} latency_trace_stage_e;
+
+typedef struct
+{
+    uint32_t timestamp_us;              // zf_time_now_us 低 32 位
+    uint16_t trace_id;                  // 跟踪编号，每帧定位加 1
+    uint8_t  stage;                     // latency_trace_stage_e
+    uint8_t  reserved;
+} latency_trace_record_t;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化跟踪缓冲区并注册 GNSS 语句接收回调
+ * @note   在 bsp_rtk_init 之后调用。
+ */
+void latency_trace_init(void);
+
+/**
+ * @brief  获取跟踪时间戳 (us)
+ * @note   即 zf_time_now_us 的低 32 位，可在中断中调用。
+ */
+uint32_t latency_trace_now_us(void);
+
+/**
+ * @brief  开始跟踪一帧定位
+ * @return uint16_t: 新分配的跟踪编号
+ * @note   在取走 gnss_flag 准备解析时调用，以最近一次收到 '\n' 的时间记录 RX_EOL 阶段。
+ */
+uint16_t latency_trace_begin(void);
+
+/**
+ * @brief  获取最近一次 latency_trace_begin 分配的跟踪编号
+ * @note   供与解析处于同一任务的后续阶段 (导航、舵机输出) 使用。
+ */
+uint16_t latency_trace_current_id(void);
+
+/**
+ * @brief  记录一个阶段
+ * @param  trace_id: 跟踪编号
+ * @param  stage: 阶段
+ * @note   可在中断中调用。缓冲区满时丢弃本条并计数，已记录的不会被覆盖。
+ */
+void latency_trace_point(uint16_t trace_id, latency_trace_stage_e stage);
+
+/**
+ * @brief  预约一个阶段，在下一次 latency_trace_flush_deferred 时才记录
+ * @param  trace_id: 跟踪编号
+ * @param  stage: 阶段
+ * @note   用于真正发生在其它任务中的阶段 (PWM_COMMIT)。只保留一个预约，新的预约覆盖尚未记录的旧预约。
+ */
+void latency_trace_defer(uint16_t trace_id, latency_trace_stage_e stage);
+
+/**
+ * @brief  记录尚未记录的预约阶段，时间戳取本次调用时刻
+ * @note   可在中断中调用，没有预约时为空操作。
+ */
+void latency_trace_flush_deferred(void);
+
+/**
+ * @brief  后台任务 (在主循环中调用)
+ * @note   记录数达到 LATENCY_TRACE_DUMP_THRESHOLD 时全部输出，有丢弃时额外输出 "$LT,DROP,<数量>"。
+ */
+void latency_trace_background_task(void);
+
+#endif /* USER_CODE_LATENCY_TRACE_H_ */
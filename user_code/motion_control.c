@@ -1,10 +1,18 @@
 #include "motion_control.h"
-#include <stdlib.h> // for abs()
+#include "bsp_battery.h"
+#include "servo_calib.h"
+#include "latency_trace.h"
+#include <math.h>
 
 // ================== 内部宏定义 ==================
 
 // -- 舵机通道定义 (来自 bsp_pwm.h, 正确) --
 #define SERVO_CHANNEL       BSP_PWM_SERVO_1
+#define SERVO_DECIDEG_MIN   ((int16_t)(-SERVO_ANGLE_LIMIT_DEG * 10))
+#define SERVO_DECIDEG_MAX   ((int16_t)(SERVO_ANGLE_LIMIT_DEG * 10))
+#define SERVO_MODEL_DELAY_TICKS (SERVO_MODEL_DELAY_MS / SERVO_MODEL_PERIOD_MS)
+#define SERVO_MODEL_DT_S    ((float)SERVO_MODEL_PERIOD_MS / 1000.0f)
+#define SERVO_TABLE_SIZE    (2 * SERVO_ANGLE_LIMIT_DEG * SERVO_TABLE_STEPS_PER_DEG + 1)   // 由转角范围与分辨率推出，两端都包含
 
 // -- 电机通道定义 (来自原理图和你的代码, 确认无误) --
 #define MOTOR_PWM_CH        BSP_PWM_MOTOR_L1   // 使用 E4 引脚作为速度PWM
@@ -14,6 +22,22 @@
 #define MOTOR_DIR_FORWARD   (GPIO_HIGH)
 #define MOTOR_DIR_REVERSE   (GPIO_LOW)
 
+#define MOTOR_DUTY_Q15_ONE  (32768)
+#define MOTOR_DEADBAND_Q15  ((int32_t)(MOTOR_DUTY_DEADBAND * MOTOR_DUTY_Q15_ONE))
+
+// ================== 内部变量 ==================
+static int8_t  g_motor_dir = 1;              // 当前方向引脚对应的方向 +1 前进 / -1 后退
+static int32_t g_motor_applied_q15 = 0;      // 实际施加的带符号占空比 (额定电压等效)
+static uint8_t g_motor_dir_change_countdown = 0;
+static uint16_t g_servo_count_table[SERVO_TABLE_SIZE];  // 角度 (0.1° 一格，从 SERVO_ANGLE_MIN 开始) -> 比较计数
+
+// 舵机滞后模型
+static volatile float g_servo_command_deg = 0.0f;                   // 最近一次下发的指令角 (限幅后)
+static float   g_servo_delay_line[SERVO_MODEL_DELAY_TICKS];         // 尚在延迟中的指令，g_servo_delay_head 处最旧
+static uint8_t g_servo_delay_head = 0;
+static volatile float g_servo_model_deg = 0.0f;                     // 模型估计的实际转角
+static float   g_servo_lead_decay = 0.0f;                           // exp(-HORIZON / TAU)
+
 // ================== 内部辅助函数 ==================
 
 // 线性映射辅助函数
@@ -22,43 +46,171 @@ static inline float map_value(float value, float from_min, float from_max, float
     return (value - from_min) * (to_max - to_min) / (from_max - from_min) + to_min;
 }
 
+/**
+ * @brief 舵机模型推进一个周期: 一阶惯性 + 转速限制
+ */
+static inline float motion_servo_model_advance(float angle, float command)
+{
+    const float alpha = SERVO_MODEL_DT_S / (SERVO_MODEL_TAU_S + SERVO_MODEL_DT_S);
+    const float max_step = SERVO_MODEL_SLEW_DPS * SERVO_MODEL_DT_S;
+    float step = (command - angle) * alpha;
+    if (step > max_step)  step = max_step;
+    if (step < -max_step) step = -max_step;
+    return angle + step;
+}
+
 // ================== API函数实现 ==================
 
 void motion_control_init(void)
 {
     // 1. 初始化PWM模块
     bsp_pwm_init(MOTOR_PWM_FREQ_HZ, SERVO_PWM_FREQ_HZ);
+    bsp_battery_init();   // 依赖 HRTIM，必须在 PWM 初始化之后
+    servo_calib_init();   // 加载 FLASH 中的舵机标定表并生成角度->比较计数表，依赖舵机定时器的实际计数频率
 
-    // 2. [已修正] 初始化电机的方向控制引脚
-    //    使用官方宏 GPO_PUSH_PULL 和 MOTOR_DIR_REVERSE (即 GPIO_LOW)。
-    //    函数调用为正确的3个参数。
-    zf_gpio_init(MOTOR_DIR_PIN, GPO_PUSH_PULL, MOTOR_DIR_REVERSE);
+    for (uint8_t i = 0; i < SERVO_MODEL_DELAY_TICKS; i++)
+    {
+        g_servo_delay_line[i] = 0.0f;
+    }
+    g_servo_delay_head = 0;
+    g_servo_model_deg = 0.0f;
+    g_servo_command_deg = 0.0f;
+    g_servo_lead_decay = expf(-SERVO_LEAD_HORIZON_S / SERVO_MODEL_TAU_S);
 
-    // 3. 设置初始状态
+    // 2. 初始化电机的方向控制引脚
+    //    初始电平必须与 g_motor_dir 的初值 (+1 前进) 一致，否则首次前进指令不会翻转引脚
+    g_motor_dir = 1;
+    g_motor_dir_change_countdown = 0;
+    zf_gpio_init(MOTOR_DIR_PIN, GPO_PUSH_PULL, MOTOR_DIR_FORWARD);
+
+    // 3. 设置初始状态，此时调度器尚未运行，直接提交
     motion_set_servo_angle(0.0f);
     motion_set_motor_speed_openloop(0, 0);
+    bsp_pwm_commit();
+}
+
+bool motion_servo_build_table(const float *angle_deg, const uint16_t *pulse_us, uint8_t count)
+{
+    if (angle_deg == NULL || pulse_us == NULL || count < 2) return false;
+    for (uint8_t i = 1; i < count; i++)
+    {
+        if (angle_deg[i] <= angle_deg[i - 1]) return false;
+    }
+
+    float counts_per_us = (float)bsp_pwm_get_count_freq(SERVO_CHANNEL) / 1000000.0f;
+    uint8_t segment = 0;
+
+    for (uint16_t i = 0; i < SERVO_TABLE_SIZE; i++)
+    {
+        float angle = SERVO_ANGLE_MIN + (float)i / SERVO_TABLE_STEPS_PER_DEG;
+        float duty_us;
+
+        // 表格角度单调递增，分段下标只需向前推进
+        while (segment < count - 2 && angle > angle_deg[segment + 1]) segment++;
+
+        if (angle <= angle_deg[0])
+        {
+            duty_us = pulse_us[0];              // 超出标定范围时停在端点，不外推
+        }
+        else if (angle >= angle_deg[count - 1])
+        {
+            duty_us = pulse_us[count - 1];
+        }
+        else
+        {
+            duty_us = map_value(angle, angle_deg[segment], angle_deg[segment + 1],
+                                pulse_us[segment], pulse_us[segment + 1]);
+        }
+        g_servo_count_table[i] = (uint16_t)(duty_us * counts_per_us + 0.5f);
+    }
+    return true;
 }
 
 void motion_set_servo_angle(float angle)
 {
-    // ... 此部分代码不涉及GPIO，是正确的，无需修改 ...
     if (angle > SERVO_ANGLE_MAX) angle = SERVO_ANGLE_MAX;
     if (angle < SERVO_ANGLE_MIN) angle = SERVO_ANGLE_MIN;
 
-    uint16_t duty_us;
-    if (angle >= 0)
+    // 定点化为 (表格下标 << 8 | 小数)，相邻两格之间整数线性插值
+    g_servo_command_deg = angle;
+
+    uint32_t position = (uint32_t)((angle - SERVO_ANGLE_MIN) * (SERVO_TABLE_STEPS_PER_DEG * 256) + 0.5f);
+    uint16_t index = (uint16_t)(position >> 8);
+    int32_t  count = g_servo_count_table[index];
+    if (index < SERVO_TABLE_SIZE - 1)
     {
-        duty_us = (uint16_t)map_value(angle, 0, SERVO_ANGLE_MAX, SERVO_DUTY_NEUTRAL_US, SERVO_DUTY_MAX_US);
+        count += ((int32_t)g_servo_count_table[index + 1] - count) * (int32_t)(position & 0xFF) / 256;
     }
-    else
+    bsp_pwm_stage_compare(SERVO_CHANNEL, (uint32_t)count);
+}
+
+void motion_set_servo_angle_decideg(int16_t angle_decideg)
+{
+    if (angle_decideg > SERVO_DECIDEG_MAX) angle_decideg = SERVO_DECIDEG_MAX;
+    if (angle_decideg < SERVO_DECIDEG_MIN) angle_decideg = SERVO_DECIDEG_MIN;
+    g_servo_command_deg = (float)angle_decideg / 10.0f;
+
+    // 表格按 0.1° 一格，SERVO_TABLE_STEPS_PER_DEG 为 10 时下标即为偏移后的 decideg
+    uint16_t index = (uint16_t)((angle_decideg - SERVO_DECIDEG_MIN) * SERVO_TABLE_STEPS_PER_DEG / 10);
+    bsp_pwm_stage_compare(SERVO_CHANNEL, g_servo_count_table[index]);
+}
+
+void motion_servo_model_update(void)
+{
+#if SERVO_MODEL_ENABLE
+    float applied = g_servo_delay_line[g_servo_delay_head];
+    g_servo_delay_line[g_servo_delay_head] = g_servo_command_deg;
+    g_servo_delay_head = (uint8_t)((g_servo_delay_head + 1) % SERVO_MODEL_DELAY_TICKS);
+    g_servo_model_deg = motion_servo_model_advance(g_servo_model_deg, applied);
+#else
+    g_servo_model_deg = g_servo_command_deg;
+#endif
+}
+
+float motion_servo_get_model_angle(void)
+{
+    return g_servo_model_deg;
+}
+
+float motion_servo_lead_compensate(float target_deg)
+{
+#if SERVO_MODEL_ENABLE
+    float   delay_line[SERVO_MODEL_DELAY_TICKS];
+    uint8_t head;
+    float   predicted;
+
+    // 模型在速度环中断中推进，拷贝期间屏蔽中断
+    uint32 primask = zf_interrupt_global_disable();
+    for (uint8_t i = 0; i < SERVO_MODEL_DELAY_TICKS; i++)
     {
-        duty_us = (uint16_t)map_value(angle, SERVO_ANGLE_MIN, 0, SERVO_DUTY_MIN_US, SERVO_DUTY_NEUTRAL_US);
+        delay_line[i] = g_servo_delay_line[i];
     }
+    head = g_servo_delay_head;
+    predicted = g_servo_model_deg;
+    zf_interrupt_global_enable(primask);
 
-    uint32_t period_us = 1000000 / SERVO_PWM_FREQ_HZ;
-    uint16_t duty_permillage = (uint32_t)duty_us * 10000 / period_us;
+    // 1. 延迟线里的指令已经无法更改，推演到它们全部生效之后的转角
+    for (uint8_t i = 0; i < SERVO_MODEL_DELAY_TICKS; i++)
+    {
+        predicted = motion_servo_model_advance(predicted, delay_line[(head + i) % SERVO_MODEL_DELAY_TICKS]);
+    }
+
+    // 2. 一阶响应 theta(T) = u + (theta0 - u) * e^(-T/tau)，令 theta(T) = target 反解 u
+    float command = (target_deg - predicted * g_servo_lead_decay) / (1.0f - g_servo_lead_decay);
+    command = target_deg + SERVO_LEAD_GAIN * (command - target_deg);
 
-    bsp_pwm_set_duty(SERVO_CHANNEL, duty_permillage);
+    if (command > SERVO_ANGLE_MAX) command = SERVO_ANGLE_MAX;
+    if (command < SERVO_ANGLE_MIN) command = SERVO_ANGLE_MIN;
+    return command;
+#else
+    return target_deg;
+#endif
+}
+
+void motion_set_servo_pulse_us(uint16_t pulse_us)
+{
+    uint32_t count = ((uint32_t)pulse_us * bsp_pwm_get_count_freq(SERVO_CHANNEL) + 500000) / 1000000;
+    bsp_pwm_stage_compare(SERVO_CHANNEL, count);
 }
 
 void motion_set_motor_speed_openloop(int16_t left_speed, int16_t right_speed)
@@ -68,29 +220,82 @@ void motion_set_motor_speed_openloop(int16_t left_speed, int16_t right_speed)
     if (speed > 100)  speed = 100;
     if (speed < -100) speed = -100;
 
-    if (speed >= 0) // 前进或停止
+    // 百分比接口保留给旧代码，内部统一走全分辨率占空比通路
+    motion_set_motor_duty_q15((int16_t)((int32_t)speed * 32767 / 100));
+}
+
+void motion_set_motor_speed_closedloop(float left_target_speed, float right_target_speed)
+{
+    (void)left_target_speed;
+    (void)right_target_speed;
+    // 待实现
+}
+
+void motion_set_motor_duty(float duty)
+{
+    if (duty > 1.0f)  duty = 1.0f;
+    if (duty < -1.0f) duty = -1.0f;
+
+    motion_set_motor_duty_q15((int16_t)(duty * 32767.0f));
+}
+
+void motion_set_motor_duty_q15(int16_t duty_q15)
+{
+    int32_t magnitude = (duty_q15 >= 0) ? duty_q15 : -(int32_t)duty_q15;
+    int8_t  dir = (duty_q15 > 0) ? 1 : ((duty_q15 < 0) ? -1 : 0);
+
+    // 1. 死区: 过小的占空比驱动不动电机，只会发热，直接关断
+    if (magnitude < MOTOR_DEADBAND_Q15)
     {
-        // 1. [已修正] 设置方向为前进
-        zf_gpio_set_level(MOTOR_DIR_PIN, MOTOR_DIR_FORWARD);
+        magnitude = 0;
+        dir = 0;
+    }
 
-        // 2. 设置PWM占空比
-        uint16_t duty = (uint16_t)(speed * 100);
-        bsp_pwm_set_duty(MOTOR_PWM_CH, duty);
+    // 2. 换向: 先关断 MOTOR_DIR_CHANGE_HOLD 个周期，再翻转方向引脚
+    if (dir != 0 && dir != g_motor_dir)
+    {
+        if (g_motor_dir_change_countdown == 0 && g_motor_applied_q15 != 0)
+        {
+            g_motor_dir_change_countdown = MOTOR_DIR_CHANGE_HOLD;
+        }
+        if (g_motor_dir_change_countdown > 0)
+        {
+            g_motor_dir_change_countdown--;
+            bsp_pwm_stage_duty_q15(MOTOR_PWM_CH, 0);
+            g_motor_applied_q15 = 0;
+            return;
+        }
+        zf_gpio_set_level(MOTOR_DIR_PIN, (dir > 0) ? MOTOR_DIR_FORWARD : MOTOR_DIR_REVERSE);
+        g_motor_dir = dir;
     }
-    else // 后退
+    else
     {
-        // 1. [已修正] 设置方向为后退
-        zf_gpio_set_level(MOTOR_DIR_PIN, MOTOR_DIR_REVERSE);
-
-        // 2. 设置PWM占空比
-        uint16_t duty = (uint16_t)(abs(speed) * 100);
-        bsp_pwm_set_duty(MOTOR_PWM_CH, duty);
+        g_motor_dir_change_countdown = 0;
     }
+
+    // 3. 电池电压补偿: 记录的是额定电压下的等效占空比，写入硬件的是补偿后的值
+    g_motor_applied_q15 = (int32_t)g_motor_dir * magnitude;
+#if MOTOR_VOLTAGE_COMP_ENABLE
+    magnitude = (int32_t)((float)magnitude * bsp_battery_get_compensation());
+    if (magnitude > MOTOR_DUTY_Q15_ONE) magnitude = MOTOR_DUTY_Q15_ONE;
+#endif
+
+    // 4. 暂存 HRTIM 比较计数，由 motion_control_commit 与舵机一起提交，占空比未变时不写寄存器
+    bsp_pwm_stage_duty_q15(MOTOR_PWM_CH, (uint16_t)magnitude);
 }
 
-void motion_set_motor_speed_closedloop(float left_target_speed, float right_target_speed)
+void motion_control_commit(void)
 {
-    (void)left_target_speed;
-    (void)right_target_speed;
-    // 待实现
+    bsp_pwm_commit();
+    latency_trace_flush_deferred();
+}
+
+void motion_control_commit_motor(void)
+{
+    bsp_pwm_commit_mask(BSP_PWM_MASK_MOTOR);
+}
+
+float motion_get_motor_duty(void)
+{
+    return (float)g_motor_applied_q15 / (float)MOTOR_DUTY_Q15_ONE;
 }
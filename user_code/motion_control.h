@@ -8,22 +8,115 @@ extern "C" {
 
 #include "bsp_PWM.h"
 #include <stdint.h> // 明确包含
+#include <stdbool.h>
 
 // ================== 宏定义与配置 ==================
 // [确认] 这些是你通过标定得到的精确值，保持不变
-#define SERVO_ANGLE_MAX       (30.0f)
-#define SERVO_ANGLE_MIN       (-30.0f)
+// FLASH 中没有舵机标定表 (servo_calib) 时，以 MIN/NEUTRAL/MAX 三点作为默认标定
+#define SERVO_ANGLE_LIMIT_DEG (30)      // 左右对称的转角限幅 (整数度，角度->比较计数表长度由它推出)
+#define SERVO_ANGLE_MAX       ((float)SERVO_ANGLE_LIMIT_DEG)
+#define SERVO_ANGLE_MIN       (-(float)SERVO_ANGLE_LIMIT_DEG)
 #define SERVO_DUTY_MAX_US     (1900)
 #define SERVO_DUTY_NEUTRAL_US (1550)
 #define SERVO_DUTY_MIN_US     (1200)
-#define SERVO_PWM_FREQ_HZ     (50)
 #define MOTOR_PWM_FREQ_HZ     (17000)
 
+// ---- 舵机输出 ----
+// 数字舵机可接受 333Hz 刷新，转向指令最多延迟一个 3ms 周期到达舵机 (50Hz 时为 20ms)。
+// 默认按 50Hz 模拟舵机输出；确认 TIM8/TIM16 上所有舵机通道都是数字舵机后再改为 1，
+// 模拟舵机在 333Hz 下会发热甚至损坏。
+#define SERVO_DIGITAL_MODE    (0)       // 1: 333Hz 数字舵机 / 0: 50Hz 模拟舵机
+#if SERVO_DIGITAL_MODE
+#define SERVO_PWM_FREQ_HZ     (333)
+#else
+#define SERVO_PWM_FREQ_HZ     (50)
+#endif
+#define SERVO_TABLE_STEPS_PER_DEG (10)  // 角度->比较计数表的分辨率，每度 10 格 (0.1°)
+
+// ---- 舵机滞后模型 (一阶 + 纯延迟 + 转速限制) ----
+// 舵机从收到指令到开始转动有几十毫秒的传输延迟，之后按一阶惯性并受最大转速限制趋近指令角。
+// 模型由速度环中断每 SERVO_MODEL_PERIOD_MS 推进一次，用于估计车轮实际转角并为横向控制提供超前补偿。
+#define SERVO_MODEL_ENABLE        (1)
+#define SERVO_MODEL_PERIOD_MS     (10)      // 模型推进周期，必须与 motion_servo_model_update 的调用周期一致
+#define SERVO_MODEL_DELAY_MS      (80)      // [请标定] 纯延迟，需为 SERVO_MODEL_PERIOD_MS 的整数倍且不小于它
+#define SERVO_MODEL_TAU_S         (0.04f)   // [请标定] 延迟之后的一阶时间常数
+#define SERVO_MODEL_SLEW_DPS      (500.0f)  // [请标定] 最大转速 (度/秒)，舵机标称 0.12s/60° 即 500°/s
+#define SERVO_LEAD_HORIZON_S      (0.1f)    // 超前补偿希望车轮到位的时间，取横向控制周期 (RTK 10Hz)
+#define SERVO_LEAD_GAIN           (0.6f)    // 超前补偿强度 0 - 1，1 为按模型完全反解，0 为不补偿
+
+// ---- 电机占空比输出 ----
+#define MOTOR_DUTY_DEADBAND       (0.02f)   // |占空比| 低于此值直接输出 0 (驱动芯片最小脉宽/电机死区)
+#define MOTOR_DIR_CHANGE_HOLD     (1)       // 换向时先输出 0 的调用次数，避免带载瞬间反接
+#define MOTOR_VOLTAGE_COMP_ENABLE (BATTERY_MONITOR_ENABLE)  // 按 V_nominal / V_measured 补偿占空比，电池放电时等效电压不变，随电池采样一同开关
+
 // ================== API函数声明 ==================
 
 void motion_control_init(void);
+
+/**
+ * @brief 提交本周期暂存的舵机与电机输出
+ * @note  下面所有 motion_set_xxx 只暂存比较值，不写寄存器；由速度环任务在电机与舵机都暂存完之后
+ *        每个控制周期调用一次，两者在各自定时器的同一个更新事件生效。同时记录导航预约的 PWM_COMMIT 延迟阶段。
+ */
+void motion_control_commit(void);
+
+/**
+ * @brief 只提交电机通道
+ * @note  供比控制周期更快的电流环中断使用，不会把上层暂存的舵机值提前写出。
+ */
+void motion_control_commit_motor(void);
+
+/**
+ * @brief 设置舵机转角
+ * @param angle: 角度 (度)，限幅到 SERVO_ANGLE_MIN - SERVO_ANGLE_MAX
+ * @note  查初始化时预先算好的角度->比较计数表 (0.1° 一格，由舵机标定表生成)，相邻两格整数插值后
+ *        暂存为定时器比较计数 (motion_control_commit 时生效)，分辨率为一个定时器计数 (333Hz 时约 0.1us)，不经过万分比量化。
+ */
 void motion_set_servo_angle(float angle);
 
+/**
+ * @brief 以 0.1° 为单位设置舵机转角 (纯整数路径)
+ * @param angle_decideg: 角度 * 10，例如 125 代表 12.5°
+ */
+void motion_set_servo_angle_decideg(int16_t angle_decideg);
+
+/**
+ * @brief 推进舵机滞后模型一个周期
+ * @note  在周期为 SERVO_MODEL_PERIOD_MS 的定时中断中调用 (速度环中断)。
+ */
+void motion_servo_model_update(void);
+
+/**
+ * @brief 获取模型估计的车轮当前实际转角 (度)
+ */
+float motion_servo_get_model_angle(void);
+
+/**
+ * @brief 对横向控制器的期望转角做超前补偿
+ * @param target_deg: 希望车轮达到的转角 (度)
+ * @return float: 应下发给 motion_set_servo_angle 的指令角 (度)，已限幅
+ * @note  先用模型把已在延迟线中的指令推演到延迟结束时刻，得到届时的预测转角，
+ *        再按一阶响应反解出能在 SERVO_LEAD_HORIZON_S 内把车轮带到目标的指令，按 SERVO_LEAD_GAIN 混合。
+ *        目标不变时输出收敛到目标本身，稳态无偏差。
+ */
+float motion_servo_lead_compensate(float target_deg);
+
+/**
+ * @brief 以脉宽直接驱动舵机，不经过角度表 (标定时使用)
+ * @param pulse_us: 高电平宽度 (us)
+ */
+void motion_set_servo_pulse_us(uint16_t pulse_us);
+
+/**
+ * @brief 由标定点重建角度->比较计数表
+ * @param angle_deg: 各标定点的实际转角 (度)，必须严格递增
+ * @param pulse_us:  各标定点对应的脉宽 (us)
+ * @param count:     标定点个数，至少 2 个
+ * @return bool: 标定点不单调时返回 false，原表保持不变
+ * @note  点与点之间线性插值，超出标定范围的角度停在端点脉宽。含浮点运算，只在初始化/标定完成时调用。
+ */
+bool motion_servo_build_table(const float *angle_deg, const uint16_t *pulse_us, uint8_t count);
+
 /**
  * @brief 设置左右轮的目标速度。
  * @param left_speed:  左轮速度 (-100 到 +100)。
@@ -36,6 +129,27 @@ void motion_set_motor_speed_openloop(int16_t left_speed, int16_t right_speed);
 
 void motion_set_motor_speed_closedloop(float left_target_speed, float right_target_speed);
 
+/**
+ * @brief 以归一化占空比驱动电机 (全分辨率)
+ * @param duty: -1.0 到 +1.0，正为前进
+ * @note  换算为 HRTIM 比较计数暂存 (motion_control_commit 时生效)，包含死区与换向处理，取代按整数百分比量化的 openloop 接口。
+ */
+void motion_set_motor_duty(float duty);
+
+/**
+ * @brief 以 Q15 占空比驱动电机 (全分辨率，定点版本)
+ * @param duty_q15: -32768 到 +32767，正为前进
+ */
+void motion_set_motor_duty_q15(int16_t duty_q15);
+
+/**
+ * @brief 获取实际施加到电机的占空比 (经过死区与换向处理后)
+ * @return float: -1.0 到 +1.0
+ * @note  开启电压补偿时返回的是额定电压下的等效占空比 (补偿前)，
+ *        与速度环、电机模型使用的量纲一致，不随电池电压变化。
+ */
+float motion_get_motor_duty(void);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,120 @@
+/*
+ * motor_model.c
+ *
+ *  Created on: 2025年7月22日
+ *      Author: 20766
+ */
+#include "motor_model.h"
+#include <math.h>
+
+// ================== 内部辅助函数 ==================
+
+static inline float sign_of(float x)
+{
+    return (x > 0.0f) ? 1.0f : ((x < 0.0f) ? -1.0f : 0.0f);
+}
+
+// ================== API函数实现 ==================
+
+void motor_model_init(motor_model_t *model, float lambda, float a0, float b0, float c0)
+{
+    model->theta[0] = a0;
+    model->theta[1] = b0;
+    model->theta[2] = c0;
+    for (int i = 0; i < MOTOR_MODEL_PARAM_NUM; i++)
+    {
+        for (int j = 0; j < MOTOR_MODEL_PARAM_NUM; j++)
+        {
+            model->P[i][j] = (i == j) ? MOTOR_MODEL_P_INIT : 0.0f;
+        }
+    }
+    model->lambda = lambda;
+    model->samples = 0;
+}
+
+void motor_model_update(motor_model_t *model, float speed_prev, float output_prev, float speed_now)
+{
+    // 回归向量 phi = [v[k-1], u[k-1], -sign(v[k-1])]
+    const float phi[MOTOR_MODEL_PARAM_NUM] = { speed_prev, output_prev, -sign_of(speed_prev) };
+    float (*P)[MOTOR_MODEL_PARAM_NUM] = model->P;
+
+    // 1. Pphi = P * phi
+    float Pphi[MOTOR_MODEL_PARAM_NUM];
+    for (int i = 0; i < MOTOR_MODEL_PARAM_NUM; i++)
+    {
+        Pphi[i] = P[i][0] * phi[0] + P[i][1] * phi[1] + P[i][2] * phi[2];
+    }
+
+    // 2. 增益 k = Pphi / (lambda + phi' * Pphi)
+    const float denom = model->lambda + phi[0] * Pphi[0] + phi[1] * Pphi[1] + phi[2] * Pphi[2];
+    const float inv_denom = 1.0f / denom;
+    float k[MOTOR_MODEL_PARAM_NUM];
+    for (int i = 0; i < MOTOR_MODEL_PARAM_NUM; i++)
+    {
+        k[i] = Pphi[i] * inv_denom;
+    }
+
+    // 3. 参数更新 theta += k * (y - phi' * theta)
+    const float error = speed_now - (phi[0] * model->theta[0] + phi[1] * model->theta[1] + phi[2] * model->theta[2]);
+    for (int i = 0; i < MOTOR_MODEL_PARAM_NUM; i++)
+    {
+        model->theta[i] += k[i] * error;
+    }
+
+    // 4. 协方差更新 P = (P - k * Pphi') / lambda，只算上三角再镜像，保证对称
+    const float inv_lambda = 1.0f / model->lambda;
+    float trace = 0.0f;
+    for (int i = 0; i < MOTOR_MODEL_PARAM_NUM; i++)
+    {
+        for (int j = i; j < MOTOR_MODEL_PARAM_NUM; j++)
+        {
+            P[i][j] = (P[i][j] - k[i] * Pphi[j]) * inv_lambda;
+            P[j][i] = P[i][j];
+        }
+        trace += P[i][i];
+    }
+
+    // 5. 激励不足时遗忘因子会让协方差指数增长，超过上限则整体缩小
+    if (trace > MOTOR_MODEL_P_TRACE_MAX)
+    {
+        const float scale = MOTOR_MODEL_P_TRACE_MAX / trace;
+        for (int i = 0; i < MOTOR_MODEL_PARAM_NUM; i++)
+        {
+            for (int j = 0; j < MOTOR_MODEL_PARAM_NUM; j++)
+            {
+                P[i][j] *= scale;
+            }
+        }
+    }
+
+    model->samples++;
+}
+
+bool motor_model_is_valid(const motor_model_t *model)
+{
+    return (model->samples >= MOTOR_MODEL_MIN_SAMPLES) &&
+           (model->theta[0] > 0.0f) && (model->theta[0] < 1.0f) &&
+           (model->theta[1] > 0.0f);
+}
+
+float motor_model_get_gain(const motor_model_t *model)
+{
+    return model->theta[1] / (1.0f - model->theta[0]);
+}
+
+float motor_model_get_time_constant(const motor_model_t *model, float ts_s)
+{
+    return -ts_s / logf(model->theta[0]);
+}
+
+float motor_model_get_friction_output(const motor_model_t *model)
+{
+    return model->theta[2] / model->theta[1];
+}
+
+float motor_model_feedforward(const motor_model_t *model, float speed_now, float speed_next)
+{
+    // 由 v[k+1] = a*v[k] + b*u[k] - c*sign(v) 反解 u[k]，摩擦按目标运动方向补偿
+    const float direction = sign_of(speed_next != 0.0f ? speed_next : speed_now);
+    return (speed_next - model->theta[0] * speed_now + model->theta[2] * direction) / model->theta[1];
+}
@@ -0,0 +1,86 @@
+/*
+ * motor_model.h
+ *
+ *  Created on: 2025年7月22日
+ *      Author: 20766
+ *
+ *  [文件说明] 电机一阶模型的在线递推最小二乘 (RLS) 辨识。
+ *            离散模型 (每个控制周期):
+ *                v[k] = a * v[k-1] + b * u[k-1] - c * sign(v[k-1])
+ *            其中 v 为速度 (cm/s)，u 为电机输出 (百分比)。对应的物理量:
+ *                时间常数 tau = -Ts / ln(a)
+ *                稳态增益 K   = b / (1 - a)        (cm/s 每 1% 输出)
+ *                摩擦输出 u_f = c / b              (克服摩擦所需的输出百分比)
+ *            使用遗忘因子跟踪电池电压、温度、负载带来的参数漂移。
+ *            单次更新固定为 3x3 运算: 约 45 次乘法, 1 次除法, 循环次数固定，耗时有界。
+ */
+
+#ifndef USER_CODE_MOTOR_MODEL_H_
+#define USER_CODE_MOTOR_MODEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+#define MOTOR_MODEL_PARAM_NUM       (3)
+#define MOTOR_MODEL_P_INIT          (1000.0f)   // 协方差初值，越大收敛越快
+#define MOTOR_MODEL_P_TRACE_MAX     (10000.0f)  // 协方差迹上限，防止激励不足时协方差爆炸
+#define MOTOR_MODEL_MIN_SAMPLES     (100)       // 至少更新这么多次才认为模型可用 (10ms 周期即 1 秒)
+
+typedef struct
+{
+    float    theta[MOTOR_MODEL_PARAM_NUM];      // [a, b, c]
+    float    P[MOTOR_MODEL_PARAM_NUM][MOTOR_MODEL_PARAM_NUM];
+    float    lambda;                            // 遗忘因子 (0.98 ~ 0.999)
+    uint32_t samples;                           // 已执行的有效更新次数
+} motor_model_t;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化模型
+ * @param  model: 模型实例
+ * @param  lambda: 遗忘因子，等效记忆长度约 1/(1-lambda) 个周期
+ * @param  a0, b0, c0: 参数初值 (可用台架标定值，未知时 a0 取 0.9、b0 取 0.1、c0 取 0)
+ * @retval None
+ */
+void motor_model_init(motor_model_t *model, float lambda, float a0, float b0, float c0);
+
+/**
+ * @brief  用一组观测更新模型
+ * @param  model: 模型实例
+ * @param  speed_prev: 上一周期速度 v[k-1]
+ * @param  output_prev: 上一周期施加的输出 u[k-1]
+ * @param  speed_now: 本周期速度 v[k]
+ * @retval None
+ */
+void motor_model_update(motor_model_t *model, float speed_prev, float output_prev, float speed_now);
+
+/**
+ * @brief  模型是否已收敛且参数物理上合理 (0 < a < 1, b > 0)
+ */
+bool motor_model_is_valid(const motor_model_t *model);
+
+/**
+ * @brief  稳态增益 K (cm/s 每 1% 输出)
+ */
+float motor_model_get_gain(const motor_model_t *model);
+
+/**
+ * @brief  时间常数 tau (秒)
+ * @param  ts_s: 控制周期 (秒)
+ */
+float motor_model_get_time_constant(const motor_model_t *model, float ts_s);
+
+/**
+ * @brief  克服摩擦所需的输出 (百分比)
+ */
+float motor_model_get_friction_output(const motor_model_t *model);
+
+/**
+ * @brief  基于模型的前馈：求使速度从 speed_now 在一个周期后到达 speed_next 所需的输出
+ * @note   speed_next == speed_now 时即为保持该速度的稳态输出。
+ */
+float motor_model_feedforward(const motor_model_t *model, float speed_now, float speed_next);
+
+#endif /* USER_CODE_MOTOR_MODEL_H_ */
@@ -17,6 +17,12 @@
 #include "path_manager.h"    // 路径管理模块的接口
 #include "motion_control.h"  // 运动控制模块的接口
 #include "speed_control.h"   // 速度闭环控制模块的接口
+#include "traction_control.h" // 打滑估计 (需要 GNSS 对地速度)
+#include "steering_estimator.h" // 转向零偏/增益/轴距在线估计
+#include "servo_calib.h"     // 标定期间不输出舵机指令
+#include "topic.h"           // 任务间共享状态话题
+#include "latency_trace.h"   // 定位到舵机输出的延迟跟踪
+#include "scheduler.h"       // 事件跟踪编号
 #include <math.h>            // C语言标准数学库
 #include <stdio.h>           // C语言标准输入输出库
 
@@ -26,7 +32,8 @@
 
 // --- Pure Pursuit 算法核心参数 ---
 // [!!!请务必测量并修改!!!] 小车的前后轮轴距，单位：米。这是算法必需的关键物理参数。
-#define VEHICLE_WHEELBASE   (0.22f)
+// 标称值在 steering_estimator.h 中修改，行驶中辨识出的等效轴距会自动修正转向指令。
+#define VEHICLE_WHEELBASE   (STEER_EST_WHEELBASE_NOMINAL)
 
 // --- 动态前瞻距离 (Ld) 的配置参数 ---
 // [核心调试参数#1] 速度增益系数 k (单位:秒)。表示预瞄前方多少秒路程的点。
@@ -42,6 +49,9 @@
 #define MIN_SPEED_CMPS      (20.0f)
 #define SPEED_P_GAIN        (1.5f)  // 转向角越大，速度降低越多的比例系数
 
+// ---- 电池低电压保护 ----
+#define LOW_BATTERY_SPEED_CMPS  (15.0f) // 低电压时的限速，严重低电压直接停车
+
 // ---- 舵机物理限制 ----
 #define SERVO_ANGLE_MAX     (30.0f)
 #define SERVO_ANGLE_MIN     (-30.0f)
@@ -49,7 +59,10 @@
 // ====================================================================
 // 内部变量定义
 // ====================================================================
-static float g_steering_output = 0.0f; // 存储最终计算出的舵机转向角度
+static float g_steering_output = 0.0f; // 存储最终计算出的舵机转向角度 (希望车轮达到的转角)
+static float g_wheel_angle_prev_deg = 0.0f; // 上一帧时舵机模型估计的车轮实际转角
+static volatile bsp_battery_level_e g_battery_level = BATTERY_LEVEL_NORMAL; // 由电池事件回调更新
+static volatile float g_battery_event_voltage = 0.0f;
 
 // ====================================================================
 // 内部辅助函数定义
@@ -99,6 +112,24 @@ static bool find_lookahead_point(Point_t p, Point_t a, Point_t b, float ld, Poin
     return false; // 两个交点都不在线段ab上
 }
 
+/**
+ * @brief  下发舵机指令并发布 TOPIC_STEERING。
+ */
+static void navigation_output_steering(float servo_command_deg)
+{
+    // 只在处理新定位的路径上调用，沿用本帧定位的跟踪编号
+    const uint16_t trace_id = latency_trace_current_id();
+    latency_trace_point(trace_id, LATENCY_STAGE_NAV_DONE);
+    if (SERVO_CALIB_RUNNING == servo_calib_get_state()) return;   // 标定中舵机停在标定点，不覆盖
+    motion_set_servo_angle(servo_command_deg);
+    latency_trace_defer(trace_id, LATENCY_STAGE_PWM_COMMIT);    // 比较值只是暂存，由速度环末尾的提交记录本阶段
+    const topic_steering_t steering = {
+        .target_deg        = g_steering_output,
+        .servo_command_deg = servo_command_deg,
+    };
+    topic_publish(TOPIC_STEERING, &steering);
+}
+
 // ====================================================================
 // API函数实现
 // ====================================================================
@@ -110,6 +141,32 @@ void navigation_init(void)
 {
     path_manager_init();
     g_steering_output = 0.0f; // 初始化舵机角度为0
+    steering_estimator_init();
+    g_battery_level = bsp_battery_get_level();
+    bsp_battery_set_event_callback(navigation_on_battery_event);
+}
+
+/**
+ * @brief  电池电压等级变化事件 (ADC 中断上下文)。
+ */
+void navigation_on_battery_event(bsp_battery_level_e level, float voltage)
+{
+    g_battery_level = level;
+    g_battery_event_voltage = voltage;
+}
+
+/**
+ * @brief  导航周期任务。
+ */
+void navigation_task(void)
+{
+    // 只有在确认有新的、有效的数据时，才执行导航计算
+    if (bsp_rtk_data_task())
+    {
+        zf_trace_marker(SCHED_TRACE_MARKER_GNSS_FIX);
+        gnss_info_struct rtk_info = bsp_rtk_get_info();
+        navigation_run_once(&rtk_info);
+    }
 }
 
 /**
@@ -120,12 +177,37 @@ void navigation_run_once(const gnss_info_struct* rtk_info)
     // --- 第一部分：安全与状态检查 ---
     if (path_manager_is_mission_completed()) {
         speed_control_set_speed(0);
-        motion_set_servo_angle(0.0f);
+        g_steering_output = 0.0f;
+        navigation_output_steering(0.0f);
         return;
     }
     if (rtk_info->state == 0) {
         speed_control_set_speed(0);
-        motion_set_servo_angle(0.0f);
+        g_steering_output = 0.0f;
+        navigation_output_steering(0.0f);
+        return;
+    }
+    // GNSS 多普勒速度 (km/h) 作为对地速度，供牵引力控制估计打滑
+    traction_control_update_ground(rtk_info->speed * (100000.0f / 3600.0f));
+
+    // 航向变化率 / 对地速度 = 实际曲率，与两帧间车轮实际转角 (舵机模型估计，已扣除延迟与惯性) 的均值一起用于转向参数辨识
+    float wheel_angle_deg = motion_servo_get_model_angle();
+    steering_estimator_update((rtk_info->antenna_direction_state == 1) ? rtk_info->antenna_direction : rtk_info->direction,
+                              rtk_info->antenna_direction_state,
+                              rtk_info->speed / 3.6f,
+                              0.5f * (wheel_angle_deg + g_wheel_angle_prev_deg));
+    g_wheel_angle_prev_deg = wheel_angle_deg;
+
+    if (g_battery_level == BATTERY_LEVEL_CRITICAL) {
+        // 严重低电压：停车保护，避免过放损坏电池
+        static bool critical_reported = false;
+        if (!critical_reported) {
+            printf("Battery critical (%.2fV), vehicle stopped\r\n", g_battery_event_voltage);
+            critical_reported = true;
+        }
+        speed_control_set_speed(0);
+        g_steering_output = 0.0f;
+        navigation_output_steering(0.0f);
         return;
     }
 
@@ -135,8 +217,10 @@ void navigation_run_once(const gnss_info_struct* rtk_info)
     Point_t start_waypoint = path_manager_get_start_waypoint();
     Point_t target_waypoint = path_manager_get_target_waypoint();
 
-    // [依赖确认] 假设 speed_control_get_current_speed() 返回单位为 cm/s 的当前速度。
-    float current_speed_mps = speed_control_get_current_speed() / 100.0f; // 转换为 m/s
+    // 速度环发布的车轮速度快照 (cm/s)，尚未发布时按静止处理
+    topic_wheel_speed_t wheel_speed;
+    if (!topic_read(TOPIC_WHEEL_SPEED, &wheel_speed, NULL, NULL)) wheel_speed.current_cmps = 0.0f;
+    float current_speed_mps = wheel_speed.current_cmps / 100.0f; // 转换为 m/s
     float lookahead_dist_dynamic = LD_GAIN_K * current_speed_mps + LD_BASE;
 
     // 对计算出的动态Ld进行限幅
@@ -222,16 +306,24 @@ void navigation_run_once(const gnss_info_struct* rtk_info)
     // 如果上车测试时转向方向错误（例如应左转却右转），请将下面这行代码注释掉，反之则保留。
     g_steering_output = -g_steering_output;
 
+    // 以上为标称模型 (标称轴距、零偏 0、增益 1) 下的舵机角，估计收敛后按实测的零偏/增益/轴距修正。
+    // 若上面的取反设错，估计出的增益为负，修正后方向也会被纠正 (前提是车还能开出足够的有效数据)。
+    g_steering_output = steering_estimator_correct(g_steering_output);
+
     // --- 第四部分：执行控制指令 ---
     // 对最终计算出的转向角进行物理限幅
     if (g_steering_output > SERVO_ANGLE_MAX) g_steering_output = SERVO_ANGLE_MAX;
     else if (g_steering_output < SERVO_ANGLE_MIN) g_steering_output = SERVO_ANGLE_MIN;
 
     // [依赖确认] 假设 motion_set_servo_angle() 接收的是角度值。
-    motion_set_servo_angle(g_steering_output);
+    // Pure Pursuit 假设转向瞬时到位，实际舵机有延迟和惯性，按舵机模型做超前补偿后再下发
+    navigation_output_steering(motion_servo_lead_compensate(g_steering_output));
     //*************************************************************************
     float target_speed = 20.0f; // 定义一个名为 target_speed 的局部变量并赋值
-    speed_control_set_speed(20.0f); // 固定为20 cm/s
+    if (g_battery_level == BATTERY_LEVEL_LOW && target_speed > LOW_BATTERY_SPEED_CMPS) {
+        target_speed = LOW_BATTERY_SPEED_CMPS; // 低电压降速
+    }
+    speed_control_set_speed(target_speed); // 默认 20 cm/s，电池低电压时降到 LOW_BATTERY_SPEED_CMPS
     // 动态速度规划：转角越大，速度越慢
     //************************************************************************
     /*
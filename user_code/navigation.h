@@ -7,6 +7,7 @@ extern "C" {
 
 // 依赖 bsp_rtk.h 来获取 'gnss_info_struct' 类型的定义。
 #include "bsp_rtk.h"
+#include "bsp_battery.h"
 
 /**
  * @brief  导航模块初始化。
@@ -24,6 +25,24 @@ void navigation_init(void);
  */
 void navigation_run_once(const gnss_info_struct* rtk_info);
 
+/**
+ * @brief  导航周期任务：解析 RTK 数据，有新的有效定位时执行一次 navigation_run_once。
+ * @note   由 scheduler 以 SCHED_NAVIGATION_PERIOD_MS 周期在 BACKGROUND 等级调度。
+ * @param  None
+ * @retval None
+ */
+void navigation_task(void);
+
+/**
+ * @brief  电池电压等级变化事件。
+ * @note   由 bsp_battery 在 ADC 中断中回调 (navigation_init 中注册)，只记录等级，
+ *         降速/停车在下一次 navigation_run_once 中执行。
+ * @param  level   新的电压等级
+ * @param  voltage 当前滤波后的电压 (V)
+ * @retval None
+ */
+void navigation_on_battery_event(bsp_battery_level_e level, float voltage);
+
 
 #ifdef __cplusplus
 }
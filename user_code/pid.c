@@ -21,11 +21,126 @@ float PID_IncCalc(PID_Controller *pid, float feedback_value) {
     pid->PrevError = pid->LastError;
     pid->LastError = error;
     return increment;
-}/*
+}
+
+// ================== 通用控制器 pid_ctrl ==================
+
+static inline pid_real_t pid_clamp(pid_real_t value, pid_real_t min, pid_real_t max)
+{
+    if (value > max) return max;
+    if (value < min) return min;
+    return value;
+}
+
+void pid_ctrl_init(pid_ctrl_t *pid, const pid_ctrl_config_t *cfg)
+{
+    pid->cfg = *cfg;
+    pid_ctrl_reset(pid, PID_REAL(0.0f));
+}
+
+void pid_ctrl_reset(pid_ctrl_t *pid, pid_real_t output)
+{
+    output = pid_clamp(output, pid->cfg.out_min, pid->cfg.out_max);
+
+    // 位置式把预置输出全部放进积分项，下一周期 P/D 为 0 时输出不跳变
+    pid->integral = output;
+    pid->d_term = PID_REAL(0.0f);
+    pid->last_d_input = PID_REAL(0.0f);
+    pid->last_p_term = PID_REAL(0.0f);
+    pid->last_d_term = PID_REAL(0.0f);
+    pid->last_ff = PID_REAL(0.0f);
+    pid->output = output;
+    pid->first_run = 1;
+}
+
+void pid_ctrl_set_gains(pid_ctrl_t *pid, pid_real_t kp, pid_real_t ki, pid_real_t kd)
+{
+    pid->cfg.kp = kp;
+    pid->cfg.ki = ki;
+    pid->cfg.kd = kd;
+}
+
+void pid_ctrl_set_output_limits(pid_ctrl_t *pid, pid_real_t out_min, pid_real_t out_max)
+{
+    pid->cfg.out_min = out_min;
+    pid->cfg.out_max = out_max;
+}
+
+pid_real_t pid_ctrl_update(pid_ctrl_t *pid, pid_real_t setpoint, pid_real_t measurement, pid_real_t feedforward)
+{
+    const pid_ctrl_config_t *cfg = &pid->cfg;
+    pid_real_t error = setpoint - measurement;
+
+    // --- 1. P 项 (设定值加权) ---
+    pid_real_t p_term = PID_MUL(cfg->kp, PID_MUL(cfg->beta, setpoint) - measurement);
+
+    // --- 2. D 项 (设定值加权 + 一阶低通) ---
+    pid_real_t d_input = PID_MUL(cfg->gamma, setpoint) - measurement;
+    if (pid->first_run)
+    {
+        pid->last_d_input = d_input;
+    }
+    pid_real_t d_raw = PID_MUL(cfg->kd, d_input - pid->last_d_input);
+    pid->last_d_input = d_input;
+    pid->d_term += PID_MUL(cfg->d_filter_alpha, d_raw - pid->d_term);
+
+    // --- 3. 前馈 (静摩擦 + 速度 + 外部) ---
+    pid_real_t ff = PID_MUL(cfg->kff_velocity, setpoint) + feedforward;
+    if (setpoint > 0)      ff += cfg->kff_static;
+    else if (setpoint < 0) ff -= cfg->kff_static;
+
+    // --- 4. 合成未限幅输出 ---
+    pid_real_t unsat;
+    if (PID_MODE_POSITIONAL == cfg->mode)
+    {
+        unsat = p_term + pid->integral + pid->d_term + ff;
+    }
+    else
+    {
+        if (pid->first_run)
+        {
+            pid->last_p_term = p_term;
+            pid->last_d_term = pid->d_term;
+            pid->last_ff = ff;
+        }
+        unsat = pid->output
+              + (p_term - pid->last_p_term)
+              + PID_MUL(cfg->ki, error)
+              + (pid->d_term - pid->last_d_term)
+              + (ff - pid->last_ff);
+        pid->last_p_term = p_term;
+        pid->last_d_term = pid->d_term;
+        pid->last_ff = ff;
+    }
+
+    // --- 5. 输出限幅与变化率限制 ---
+    pid_real_t output = pid_clamp(unsat, cfg->out_min, cfg->out_max);
+    if (cfg->rate_limit > 0)
+    {
+        output = pid_clamp(output, pid->output - cfg->rate_limit, pid->output + cfg->rate_limit);
+    }
+
+    // --- 6. 积分更新 (位置式)，用最终输出做反算，限速期间同样不会积累 ---
+    if (PID_MODE_POSITIONAL == cfg->mode)
+    {
+        if (cfg->kb != 0)
+        {
+            pid->integral += PID_MUL(cfg->ki, error) + PID_MUL(cfg->kb, output - unsat);
+        }
+        else if (!((output >= cfg->out_max && error > 0) || (output <= cfg->out_min && error < 0)))
+        {
+            // 条件积分: 已经饱和且误差还在推向饱和方向时停止积分
+            pid->integral += PID_MUL(cfg->ki, error);
+        }
+    }
+
+    pid->output = output;
+    pid->first_run = 0;
+    return output;
+}
+/*
  * pid.c
  *
  *  Created on: 2025年7月6日
  *      Author: 20766
  */
-
-
@@ -8,6 +8,10 @@
 #ifndef USER_CODE_PID_H_
 #define USER_CODE_PID_H_
 
+#include <stdint.h>
+
+// ================== 旧版增量式接口 (保留以兼容旧测试程序) ==================
+
 typedef struct {
     float Kp, Ki, Kd;
     float SetPoint;
@@ -20,4 +24,114 @@ void PID_SetPoint(PID_Controller *pid, float setpoint);
 float PID_IncCalc(PID_Controller *pid, float feedback_value);
 
 
+// ================== 通用控制器 pid_ctrl ==================
+//
+// 支持位置式/增量式两种形式，包含:
+//   - 反算 (back-calculation) 抗积分饱和
+//   - 一阶低通的微分项 (抑制编码器量化噪声)
+//   - 设定值加权: P 项使用 beta*r - y，D 项使用 gamma*r - y (gamma=0 即微分先行，消除设定值突变冲击)
+//   - 前馈: 静摩擦 kff_static*sign(r) + 速度前馈 kff_velocity*r + 调用者传入的外部前馈
+//   - 输出限幅与输出变化率限制
+//
+// 增益均按"每个控制周期"定义，与旧版 PID_IncCalc 一致，因此旧的 Kp/Ki/Kd 可直接用于位置式。
+//
+// 数值类型由 PID_CTRL_FIXED_POINT 选择:
+//   0 - float (默认，M7 带单精度 FPU)
+//   1 - Q16.16 定点，int64 中间乘积，表示范围 ±32767，适用于无 FPU 或需要逐位可复现的场合
+//
+// 单次 pid_ctrl_update 开销 (按源码统计，不含函数调用):
+//   位置式: 8 次乘法, 约 12 次加减, 最多 8 次比较, 无除法, 无库函数
+//   增量式: 7 次乘法, 约 14 次加减, 最多 6 次比较, 无除法, 无库函数
+//   实际周期数与编译选项相关，打开 pid_benchmark.h 中的 PID_BENCHMARK_ENABLE 在目标板上用 DWT 实测。
+//   上位机功能测试 (限幅、抗饱和、微分先行) 见 tools/pid_ctrl_test.c。
+
+#ifndef PID_CTRL_FIXED_POINT
+#define PID_CTRL_FIXED_POINT    (0)
+#endif
+
+#if PID_CTRL_FIXED_POINT
+typedef int32_t pid_real_t;
+#define PID_Q_SHIFT             (16)
+#define PID_REAL(x)             ((pid_real_t)((x) * 65536.0f))
+#define PID_TO_FLOAT(x)         ((float)(x) / 65536.0f)
+#define PID_MUL(a, b)           ((pid_real_t)(((int64_t)(a) * (int64_t)(b)) >> PID_Q_SHIFT))
+#else
+typedef float pid_real_t;
+#define PID_REAL(x)             ((pid_real_t)(x))
+#define PID_TO_FLOAT(x)         ((float)(x))
+#define PID_MUL(a, b)           ((a) * (b))
+#endif
+
+typedef enum
+{
+    PID_MODE_POSITIONAL,    // 位置式: u = P + I + D + FF，积分状态显式保存，使用反算抗饱和
+    PID_MODE_INCREMENTAL,   // 增量式: u = u_prev + dP + dI + dD + dFF，对饱和后的输出累加，天然抗饱和
+} pid_mode_e;
+
+typedef struct
+{
+    pid_mode_e mode;
+    pid_real_t kp, ki, kd;
+    pid_real_t kb;              // 反算抗饱和增益 (仅位置式)，0 表示仅做条件积分保护，通常取 ki/kp 附近
+    pid_real_t beta;            // P 项设定值权重，1 为标准形式
+    pid_real_t gamma;           // D 项设定值权重，0 为微分先行
+    pid_real_t d_filter_alpha;  // 微分一阶低通系数 (0,1]，1 为不滤波；alpha = Ts / (Tf + Ts)
+    pid_real_t kff_static;      // 静摩擦前馈，按设定值符号施加
+    pid_real_t kff_velocity;    // 速度前馈增益
+    pid_real_t out_min, out_max;
+    pid_real_t rate_limit;      // 每周期输出最大变化量，0 为不限制
+} pid_ctrl_config_t;
+
+typedef struct
+{
+    pid_ctrl_config_t cfg;
+    pid_real_t integral;        // 位置式积分项
+    pid_real_t d_term;          // 滤波后的微分项
+    pid_real_t last_d_input;    // 上一周期 gamma*r - y
+    pid_real_t last_p_term;     // 上一周期 P 项 (增量式用)
+    pid_real_t last_d_term;     // 上一周期 D 项 (增量式用)
+    pid_real_t last_ff;         // 上一周期前馈 (增量式用)
+    pid_real_t output;          // 上一周期最终输出 (限幅、限速后)
+    uint8_t    first_run;       // 首次调用时不计算微分，避免初值冲击
+} pid_ctrl_t;
+
+/**
+ * @brief  初始化控制器并清零内部状态
+ * @param  pid: 控制器实例
+ * @param  cfg: 配置参数，内容会被复制
+ * @retval None
+ */
+void pid_ctrl_init(pid_ctrl_t *pid, const pid_ctrl_config_t *cfg);
+
+/**
+ * @brief  复位内部状态，并把输出预置为 output (用于无扰切换)
+ * @param  pid: 控制器实例
+ * @param  output: 预置输出
+ * @retval None
+ */
+void pid_ctrl_reset(pid_ctrl_t *pid, pid_real_t output);
+
+/**
+ * @brief  运行时修改 PID 增益，不清除内部状态
+ * @note   位置式下积分项保存的是 ki*Σe 的结果，因此修改 ki 不会引起输出跳变。
+ */
+void pid_ctrl_set_gains(pid_ctrl_t *pid, pid_real_t kp, pid_real_t ki, pid_real_t kd);
+
+/**
+ * @brief  运行时修改输出限幅，不清除内部状态
+ * @note   用于外部限制器 (如牵引力控制) 动态收紧输出范围；收紧后反算抗饱和同样生效，积分不会累积。
+ */
+void pid_ctrl_set_output_limits(pid_ctrl_t *pid, pid_real_t out_min, pid_real_t out_max);
+
+/**
+ * @brief  执行一次控制计算
+ * @param  pid: 控制器实例
+ * @param  setpoint: 设定值 r
+ * @param  measurement: 反馈值 y
+ * @param  feedforward: 外部前馈 (如加速度前馈、模型前馈)，不需要时传 0
+ * @return pid_real_t: 限幅、限速后的控制输出
+ */
+pid_real_t pid_ctrl_update(pid_ctrl_t *pid, pid_real_t setpoint, pid_real_t measurement, pid_real_t feedforward);
+
+
 #endif /* USER_CODE_PID_H_ */
@@ -0,0 +1,110 @@
+/*
+ * pid_benchmark.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ */
+#include "pid_benchmark.h"
+#include "pid.h"
+
+#if PID_BENCHMARK_ENABLE
+
+typedef struct
+{
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint32_t total_cycles;
+} pid_bench_result_t;
+
+// ================== 内部函数 ==================
+
+/**
+ * @brief  连续读两次 DWT 的差值，即计时本身的开销
+ */
+static uint32_t bench_overhead(void)
+{
+    uint32_t best = UINT32_MAX;
+    for (uint8_t i = 0; i < 16; i++)
+    {
+        const uint32_t start = DWT->CYCCNT;
+        const uint32_t cycles = DWT->CYCCNT - start;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+static void bench_mode(pid_mode_e mode, uint32_t overhead, pid_bench_result_t *result)
+{
+    const pid_ctrl_config_t cfg = {
+        .mode           = mode,
+        .kp             = PID_REAL(0.4f),
+        .ki             = PID_REAL(0.15f),
+        .kd             = PID_REAL(0.8f),
+        .kb             = PID_REAL(0.3f),
+        .beta           = PID_REAL(1.0f),
+        .gamma          = PID_REAL(0.0f),
+        .d_filter_alpha = PID_REAL(0.3f),
+        .kff_static     = PID_REAL(2.0f),
+        .kff_velocity   = PID_REAL(0.1f),
+        .out_min        = PID_REAL(-100.0f),
+        .out_max        = PID_REAL(100.0f),
+        .rate_limit     = PID_REAL(10.0f),
+    };
+    pid_ctrl_t pid;
+    pid_ctrl_init(&pid, &cfg);
+
+    result->min_cycles = UINT32_MAX;
+    result->max_cycles = 0;
+    result->total_cycles = 0;
+
+    // 一阶对象 y += (1.2u - y) * 0.1，设定值在大阶跃 (饱和) 与小阶跃之间切换
+    pid_real_t measurement = PID_REAL(0.0f);
+    for (uint32_t i = 0; i < PID_BENCHMARK_CALLS; i++)
+    {
+        const pid_real_t setpoint = ((i / 100) & 1) ? PID_REAL(-20.0f) : PID_REAL(300.0f);
+
+        const uint32_t start = DWT->CYCCNT;
+        const pid_real_t output = pid_ctrl_update(&pid, setpoint, measurement, PID_REAL(0.0f));
+        uint32_t cycles = DWT->CYCCNT - start;
+
+        cycles = (cycles > overhead) ? (cycles - overhead) : 0;
+        if (cycles < result->min_cycles) result->min_cycles = cycles;
+        if (cycles > result->max_cycles) result->max_cycles = cycles;
+        result->total_cycles += cycles;
+
+        measurement += PID_MUL(PID_MUL(PID_REAL(1.2f), output) - measurement, PID_REAL(0.1f));
+    }
+}
+
+static void bench_print(const char *name, const pid_bench_result_t *result)
+{
+    printf("[PID_BENCH] %-12s min %4lu  avg %7.1f  max %4lu cycles/call\r\n",
+           name, (unsigned long)result->min_cycles,
+           (double)result->total_cycles / (double)PID_BENCHMARK_CALLS,
+           (unsigned long)result->max_cycles);
+}
+
+// ================== API函数实现 ==================
+
+void pid_benchmark_run(void)
+{
+    pid_bench_result_t positional;
+    pid_bench_result_t incremental;
+
+    const uint32 primask = zf_interrupt_global_disable();
+    const uint32_t overhead = bench_overhead();
+    bench_mode(PID_MODE_POSITIONAL, overhead, &positional);
+    bench_mode(PID_MODE_INCREMENTAL, overhead, &incremental);
+    zf_interrupt_global_enable(primask);
+
+    printf("\r\n[PID_BENCH] %u calls, %s, timer overhead %lu cycles removed\r\n",
+           (unsigned)PID_BENCHMARK_CALLS, PID_CTRL_FIXED_POINT ? "Q16.16" : "float", (unsigned long)overhead);
+    bench_print("positional", &positional);
+    bench_print("incremental", &incremental);
+}
+
+#else
+
+void pid_benchmark_run(void) {}
+
+#endif
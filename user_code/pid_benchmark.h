@@ -0,0 +1,33 @@
+/*
+ * pid_benchmark.h
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] pid_ctrl_update 单次调用的 DWT 周期数实测。
+ *            位置式与增量式各跑 PID_BENCHMARK_CALLS 次，所有功能 (反算抗饱和、微分低通、设定值加权、
+ *            前馈、限幅与限速) 全部打开，输入来自一个一阶对象的闭环仿真，覆盖饱和与非饱和分支。
+ *            每次调用单独计时，关中断执行，输出最小/平均/最大周期数 (已扣除读 DWT 本身的开销)。
+ *            数值类型随 PID_CTRL_FIXED_POINT，切换后重新测量。上位机的功能测试见 tools/pid_ctrl_test.c。
+ */
+
+#ifndef USER_CODE_PID_BENCHMARK_H_
+#define USER_CODE_PID_BENCHMARK_H_
+
+#include "zf_libraries_headfile.h"
+
+// ================== 配置与宏定义 ==================
+
+#define PID_BENCHMARK_ENABLE            (0)     // 实测开关，关闭时 pid_benchmark_run 为空操作
+#define PID_BENCHMARK_CALLS             (1000)  // 每种模式的调用次数
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  执行一次实测并通过 printf 输出结果
+ * @note   需要 DWT 周期计数器已使能 (zf_profile_init 或 zf_trace_init 之后调用)。
+ *         测试期间关中断，总耗时不到 1ms，只在启动阶段调用。
+ */
+void pid_benchmark_run(void);
+
+#endif /* USER_CODE_PID_BENCHMARK_H_ */
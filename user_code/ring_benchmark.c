@@ -0,0 +1,145 @@
+/*
+ * ring_benchmark.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ */
+#include "ring_benchmark.h"
+
+#if RING_BENCHMARK_ENABLE
+
+// ================== 内部变量 ==================
+
+static uint8_t            g_bench_storage[RING_BENCHMARK_BUFFER_SIZE];
+static uint8_t            g_bench_block[RING_BENCHMARK_BLOCK];
+static zf_fifo_obj_struct g_bench_fifo;
+static zf_ring_obj_struct g_bench_ring;
+static uint32_t           g_bench_errors = 0;       // 读出数据与写入不一致的次数
+
+// ================== 内部函数 ==================
+
+static uint32_t bench_fifo_byte(void)
+{
+    zf_fifo_init(&g_bench_fifo, FIFO_DATA_8BIT, g_bench_storage, sizeof(g_bench_storage));
+
+    const uint32_t start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < RING_BENCHMARK_BYTES; i++)
+    {
+        uint8 data = 0;
+        zf_fifo_write_element(&g_bench_fifo, (uint8_t)i);
+        zf_fifo_read_element(&g_bench_fifo, &data, FIFO_READ_WITH_CLEAN);
+        if (data != (uint8_t)i) g_bench_errors++;
+    }
+    return DWT->CYCCNT - start;
+}
+
+static uint32_t bench_ring_byte(void)
+{
+    zf_ring_init(&g_bench_ring, g_bench_storage, sizeof(g_bench_storage));
+
+    const uint32_t start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < RING_BENCHMARK_BYTES; i++)
+    {
+        uint8 data = 0;
+        zf_ring_write_byte(&g_bench_ring, (uint8_t)i);
+        zf_ring_read_byte(&g_bench_ring, &data);
+        if (data != (uint8_t)i) g_bench_errors++;
+    }
+    return DWT->CYCCNT - start;
+}
+
+static uint32_t bench_fifo_bulk(void)
+{
+    zf_fifo_init(&g_bench_fifo, FIFO_DATA_8BIT, g_bench_storage, sizeof(g_bench_storage));
+
+    const uint32_t start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < RING_BENCHMARK_BYTES; i += RING_BENCHMARK_BLOCK)
+    {
+        uint32 length = RING_BENCHMARK_BLOCK;
+        g_bench_block[0] = (uint8_t)i;
+        zf_fifo_write_buffer(&g_bench_fifo, g_bench_block, &length);
+        g_bench_block[0] = 0;
+        length = RING_BENCHMARK_BLOCK;
+        zf_fifo_read_buffer(&g_bench_fifo, g_bench_block, &length, FIFO_READ_WITH_CLEAN);
+        if (g_bench_block[0] != (uint8_t)i || length != RING_BENCHMARK_BLOCK) g_bench_errors++;
+    }
+    return DWT->CYCCNT - start;
+}
+
+static uint32_t bench_ring_bulk(void)
+{
+    zf_ring_init(&g_bench_ring, g_bench_storage, sizeof(g_bench_storage));
+
+    const uint32_t start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < RING_BENCHMARK_BYTES; i += RING_BENCHMARK_BLOCK)
+    {
+        g_bench_block[0] = (uint8_t)i;
+        zf_ring_write(&g_bench_ring, g_bench_block, RING_BENCHMARK_BLOCK);
+        g_bench_block[0] = 0;
+        const uint32 length = zf_ring_read(&g_bench_ring, g_bench_block, RING_BENCHMARK_BLOCK);
+        if (g_bench_block[0] != (uint8_t)i || length != RING_BENCHMARK_BLOCK) g_bench_errors++;
+    }
+    return DWT->CYCCNT - start;
+}
+
+static uint32_t bench_ring_span(void)
+{
+    zf_ring_init(&g_bench_ring, g_bench_storage, sizeof(g_bench_storage));
+
+    // 写入方直接在缓冲区内填充，读取方直接在缓冲区内检查，不经过中间数组
+    const uint32_t start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < RING_BENCHMARK_BYTES; i += RING_BENCHMARK_BLOCK)
+    {
+        uint8 *write_span = NULL;
+        const uint8 *read_span = NULL;
+
+        // 缓冲区长度是 BLOCK 的整数倍，连续区间不会被末尾截断
+        uint32 length = zf_ring_write_reserve(&g_bench_ring, &write_span);
+        if (length < RING_BENCHMARK_BLOCK) { g_bench_errors++; break; }
+        write_span[0] = (uint8_t)i;
+        zf_ring_write_commit(&g_bench_ring, RING_BENCHMARK_BLOCK);
+
+        length = zf_ring_read_reserve(&g_bench_ring, &read_span);
+        if (read_span[0] != (uint8_t)i || length != RING_BENCHMARK_BLOCK) g_bench_errors++;
+        zf_ring_read_commit(&g_bench_ring, length);
+    }
+    return DWT->CYCCNT - start;
+}
+
+static void bench_print(const char *name, uint32_t cycles)
+{
+    printf("[RING_BENCH] %-10s %8lu cycles  %6.2f cycles/byte\r\n",
+           name, (unsigned long)cycles, (double)cycles / (double)RING_BENCHMARK_BYTES);
+}
+
+// ================== API函数实现 ==================
+
+void ring_benchmark_run(void)
+{
+    uint32_t cycles[5];
+
+    g_bench_errors = 0;
+
+    const uint32 primask = zf_interrupt_global_disable();
+    cycles[0] = bench_fifo_byte();
+    cycles[1] = bench_ring_byte();
+    cycles[2] = bench_fifo_bulk();
+    cycles[3] = bench_ring_bulk();
+    cycles[4] = bench_ring_span();
+    zf_interrupt_global_enable(primask);
+
+    printf("\r\n[RING_BENCH] %u bytes, buffer %u, block %u\r\n",
+           (unsigned)RING_BENCHMARK_BYTES, (unsigned)RING_BENCHMARK_BUFFER_SIZE, (unsigned)RING_BENCHMARK_BLOCK);
+    bench_print("fifo byte", cycles[0]);
+    bench_print("ring byte", cycles[1]);
+    bench_print("fifo bulk", cycles[2]);
+    bench_print("ring bulk", cycles[3]);
+    bench_print("ring span", cycles[4]);
+    printf("[RING_BENCH] data errors %lu\r\n", (unsigned long)g_bench_errors);
+}
+
+#else
+
+void ring_benchmark_run(void) {}
+
+#endif
@@ -0,0 +1,37 @@
+/*
+ * ring_benchmark.h
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] zf_ring 与 zf_fifo 的单字节/批量读写耗时对比。
+ *            用 DWT 周期计数器测量，关中断执行，避免中断打断影响结果。
+ *            场景与串口接收一致: 8 位数据，缓冲区 256 字节，写入方与读取方交替进行:
+ *              byte  : 每次写 1 字节再读 1 字节 (串口中断写入、主循环逐字节读取)
+ *              bulk  : 每次写 BLOCK 字节再读 BLOCK 字节 (GNSS 语句拷贝)
+ *              span  : zf_ring 的 reserve/commit 直接访问缓冲区，只与 bulk 对比
+ *            结果以每字节平均周期数输出，同时校验读出数据与写入一致。
+ */
+
+#ifndef USER_CODE_RING_BENCHMARK_H_
+#define USER_CODE_RING_BENCHMARK_H_
+
+#include "zf_libraries_headfile.h"
+
+// ================== 配置与宏定义 ==================
+
+#define RING_BENCHMARK_ENABLE           (0)     // 对比测试开关，关闭时 ring_benchmark_run 为空操作
+#define RING_BENCHMARK_BUFFER_SIZE      (256)   // 被测缓冲区长度，zf_ring 要求为 2 的幂
+#define RING_BENCHMARK_BYTES            (4096)  // 每个场景传输的总字节数
+#define RING_BENCHMARK_BLOCK            (64)    // bulk/span 场景每次读写的字节数
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  执行一次对比测试并通过 printf 输出结果
+ * @note   需要 DWT 周期计数器已使能 (zf_profile_init 或 zf_trace_init 之后调用)。
+ *         测试期间关中断，总耗时约数毫秒，只在启动阶段调用。
+ */
+void ring_benchmark_run(void);
+
+#endif /* USER_CODE_RING_BENCHMARK_H_ */
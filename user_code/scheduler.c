@@ -0,0 +1,235 @@
+/*
+ * scheduler.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ */
+#include "scheduler.h"
+#include "speed_control.h"
+#include "navigation.h"
+
+#if SCHED_KEY_TASK_ENABLE
+static void scheduler_key_task(void);
+#endif
+
+// ================== 任务表 ==================
+// 按速率单调顺序排列: 同一等级内周期越短越靠前，顺序即优先级
+static const scheduler_task_t g_task_table[SCHED_TASK_NUM] =
+{
+    [SCHED_TASK_SPEED]      = {"speed",      speed_control_task,        CONTROL_PERIOD_MS,          SCHED_SPEED_PHASE_MS,
+                               SCHED_SPEED_DEADLINE_MS,      SCHED_LEVEL_CONTROL},
+#if SCHED_KEY_TASK_ENABLE
+    [SCHED_TASK_KEY]        = {"key",        scheduler_key_task,        SCHED_KEY_PERIOD_MS,        SCHED_KEY_PHASE_MS,
+                               SCHED_KEY_DEADLINE_MS,        SCHED_LEVEL_CONTROL},
+#endif
+    [SCHED_TASK_NAVIGATION] = {"navigation", navigation_task,           SCHED_NAVIGATION_PERIOD_MS, SCHED_NAVIGATION_PHASE_MS,
+                               SCHED_NAVIGATION_DEADLINE_MS, SCHED_LEVEL_BACKGROUND},
+    [SCHED_TASK_REPORT]     = {"report",     speed_control_report_task, SCHED_REPORT_PERIOD_MS,     SCHED_REPORT_PHASE_MS,
+                               SCHED_REPORT_DEADLINE_MS,     SCHED_LEVEL_BACKGROUND},
+#if SCHED_TRACE_TASK_ENABLE
+    [SCHED_TASK_TRACE]      = {"trace",      zf_trace_drain,            SCHED_TRACE_PERIOD_MS,      SCHED_TRACE_PHASE_MS,
+                               SCHED_TRACE_DEADLINE_MS,      SCHED_LEVEL_BACKGROUND},
+#endif
+};
+
+static const char *const g_trace_marker_name[SCHED_TRACE_MARKER_NUM] =
+{
+    [SCHED_TRACE_MARKER_GNSS_FIX] = "gnss_fix",
+};
+
+static const char *const g_trace_counter_name[SCHED_TRACE_COUNTER_NUM] =
+{
+    [SCHED_TRACE_COUNTER_WHEEL_CMPS]   = "wheel_cmps",
+    [SCHED_TRACE_COUNTER_MOTOR_OUTPUT] = "motor_output_x100",
+};
+
+static const zf_pit_index_enum g_level_pit[SCHED_LEVEL_NUM] = {SCHED_CONTROL_PIT, SCHED_BACKGROUND_PIT};
+static const uint8 g_level_priority[SCHED_LEVEL_NUM] = {SCHED_CONTROL_PRIORITY, SCHED_BACKGROUND_PRIORITY};
+
+// ================== 内部变量 ==================
+static volatile uint32_t g_tick_ms = 0;
+static volatile uint32_t g_pending_mask = 0;            // 已释放、尚未完成的任务 (bit = 任务编号)
+static uint16_t g_countdown[SCHED_TASK_NUM];            // 距下次释放的节拍数，仅节拍中断访问
+static volatile uint32_t g_release_tick[SCHED_TASK_NUM];
+static volatile scheduler_task_stats_t g_stats[SCHED_TASK_NUM];
+static uint32_t g_reported_faults[SCHED_TASK_NUM];      // 后台任务上次打印时的 超限 + 错失 次数
+
+// ================== 内部辅助函数 ==================
+
+#if SCHED_KEY_TASK_ENABLE
+static void scheduler_key_task(void)
+{
+    key_scanner(0, NULL);
+}
+#endif
+
+/**
+ * @brief  1ms 节拍中断: 释放到期任务并挂起对应等级的软件中断
+ */
+static void scheduler_tick_handler(uint32 event, void *ptr)
+{
+    (void)event; (void)ptr;
+
+    const uint32_t now = ++g_tick_ms;
+    uint8_t level_mask = 0;
+
+    for (uint8_t i = 0; i < SCHED_TASK_NUM; i++)
+    {
+        if (g_countdown[i] > 0)
+        {
+            g_countdown[i]--;
+            continue;
+        }
+        g_countdown[i] = (uint16_t)(g_task_table[i].period_ms / SCHED_TICK_MS - 1);
+
+        const uint32_t bit = 1UL << i;
+        if (g_pending_mask & bit)
+        {
+            // 上一次释放还在排队或执行，丢弃本次释放，保持原释放时刻以便统计真实响应时间
+            g_stats[i].overrun_count++;
+            continue;
+        }
+        g_release_tick[i] = now;
+        g_pending_mask |= bit;  // 节拍中断优先级高于各等级中断，这里的读改写不会被打断
+        level_mask |= (uint8_t)(1U << g_task_table[i].level);
+    }
+
+    for (uint8_t level = 0; level < SCHED_LEVEL_NUM; level++)
+    {
+        if (level_mask & (1U << level)) zf_pit_trigger(g_level_pit[level]);
+    }
+}
+
+/**
+ * @brief  等级软件中断: 按任务表顺序执行本等级所有已释放任务，直到没有就绪任务
+ * @note   每执行完一个任务都从表头重新查找，期间新释放的更高优先级任务先执行
+ */
+static void scheduler_level_handler(uint32 event, void *ptr)
+{
+    (void)event;
+    const scheduler_level_e level = (scheduler_level_e)(uintptr_t)ptr;
+
+    for (;;)
+    {
+        const uint32_t pending = g_pending_mask;
+        uint8_t index = SCHED_TASK_NUM;
+        for (uint8_t i = 0; i < SCHED_TASK_NUM; i++)
+        {
+            if ((pending & (1UL << i)) && g_task_table[i].level == level)
+            {
+                index = i;
+                break;
+            }
+        }
+        if (index >= SCHED_TASK_NUM) break;
+
+        zf_trace_task_enter(index);
+        g_task_table[index].function();
+        zf_trace_task_exit(index);
+
+        uint32 primask = zf_interrupt_global_disable();
+        const uint32_t response = g_tick_ms - g_release_tick[index];
+        volatile scheduler_task_stats_t *stats = &g_stats[index];
+        stats->run_count++;
+        stats->last_response_ms = (uint16_t)((response > UINT16_MAX) ? UINT16_MAX : response);
+        if (stats->last_response_ms > stats->max_response_ms) stats->max_response_ms = stats->last_response_ms;
+        if (response > g_task_table[index].deadline_ms) stats->deadline_miss_count++;
+        g_pending_mask &= ~(1UL << index);
+        zf_interrupt_global_enable(primask);
+    }
+}
+
+// ================== API函数实现 ==================
+
+void scheduler_init(void)
+{
+    g_tick_ms = 0;
+    g_pending_mask = 0;
+    for (uint8_t i = 0; i < SCHED_TASK_NUM; i++)
+    {
+        g_countdown[i] = (uint16_t)(g_task_table[i].phase_ms / SCHED_TICK_MS);
+        g_release_tick[i] = 0;
+        g_reported_faults[i] = 0;
+    }
+    scheduler_reset_stats();
+
+    for (uint8_t i = 0; i < SCHED_TASK_NUM; i++) zf_trace_set_name(ZF_TRACE_KIND_TASK, i, g_task_table[i].name);
+    for (uint8_t i = 0; i < SCHED_TRACE_MARKER_NUM; i++) zf_trace_set_name(ZF_TRACE_KIND_MARKER, i, g_trace_marker_name[i]);
+    for (uint8_t i = 0; i < SCHED_TRACE_COUNTER_NUM; i++) zf_trace_set_name(ZF_TRACE_KIND_COUNTER, i, g_trace_counter_name[i]);
+
+#if SCHED_KEY_TASK_ENABLE
+    key_init(SCHED_KEY_PERIOD_MS);
+#endif
+
+    // 等级软件中断: 借用空闲 PIT 的中断向量，初始化后立即停止计数，只由节拍中断软件触发
+    for (uint8_t level = 0; level < SCHED_LEVEL_NUM; level++)
+    {
+        zf_pit_ms_init(g_level_pit[level], 1000, scheduler_level_handler, (void *)(uintptr_t)level);
+        zf_pit_disable(g_level_pit[level]);
+        zf_pit_set_interrupt_priority(g_level_pit[level], g_level_priority[level]);
+    }
+
+    zf_pit_ms_init(SCHED_TICK_PIT, SCHED_TICK_MS, scheduler_tick_handler, NULL);
+    zf_pit_set_interrupt_priority(SCHED_TICK_PIT, SCHED_TICK_PRIORITY);
+}
+
+uint32_t scheduler_get_tick_ms(void)
+{
+    return g_tick_ms;
+}
+
+const scheduler_task_t *scheduler_get_task(scheduler_task_id_e id)
+{
+    if (id >= SCHED_TASK_NUM) return NULL;
+    return &g_task_table[id];
+}
+
+bool scheduler_get_task_stats(scheduler_task_id_e id, scheduler_task_stats_t *stats)
+{
+    if (id >= SCHED_TASK_NUM || NULL == stats) return false;
+
+    uint32 primask = zf_interrupt_global_disable();
+    stats->run_count = g_stats[id].run_count;
+    stats->overrun_count = g_stats[id].overrun_count;
+    stats->deadline_miss_count = g_stats[id].deadline_miss_count;
+    stats->last_response_ms = g_stats[id].last_response_ms;
+    stats->max_response_ms = g_stats[id].max_response_ms;
+    zf_interrupt_global_enable(primask);
+    return true;
+}
+
+void scheduler_reset_stats(void)
+{
+    uint32 primask = zf_interrupt_global_disable();
+    for (uint8_t i = 0; i < SCHED_TASK_NUM; i++)
+    {
+        g_stats[i].run_count = 0;
+        g_stats[i].overrun_count = 0;
+        g_stats[i].deadline_miss_count = 0;
+        g_stats[i].last_response_ms = 0;
+        g_stats[i].max_response_ms = 0;
+        g_reported_faults[i] = 0;
+    }
+    zf_interrupt_global_enable(primask);
+}
+
+void scheduler_background_task(void)
+{
+    for (uint8_t i = 0; i < SCHED_TASK_NUM; i++)
+    {
+        scheduler_task_stats_t stats;
+        scheduler_get_task_stats((scheduler_task_id_e)i, &stats);
+
+        const uint32_t faults = stats.overrun_count + stats.deadline_miss_count;
+        if (faults == g_reported_faults[i]) continue;
+        g_reported_faults[i] = faults;
+
+        printf("Scheduler: task '%s' overrun=%lu deadline_miss=%lu max_response=%ums (deadline %ums) runs=%lu\n",
+               g_task_table[i].name,
+               (unsigned long)stats.overrun_count,
+               (unsigned long)stats.deadline_miss_count,
+               stats.max_response_ms,
+               g_task_table[i].deadline_ms,
+               (unsigned long)stats.run_count);
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * scheduler.h
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] 静态优先级 (速率单调) 周期任务调度器。
+ *            一个 1ms 节拍 PIT 中断只负责按固定任务表释放任务，本身不执行任何任务代码；
+ *            释放的任务按所属等级挂起对应的软件中断 (停止计数的空闲 PIT，用 zf_pit_trigger 触发)，
+ *            在该中断的优先级下按任务表顺序 (周期越短越靠前) 逐个执行，高等级可以抢占低等级。
+ *              CONTROL    : 速度环、按键扫描等短周期、短执行时间的任务
+ *              BACKGROUND : RTK 解析、导航计算、串口打印、事件跟踪输出等耗时任务，可被 CONTROL 等级随时抢占
+ *            每个任务有固定的相位偏移，感知/执行与导航计算的先后关系在每个周期都相同。
+ *            任务上一次释放尚未执行完又到释放时刻记为一次超限 (本次释放丢弃)，
+ *            从释放到完成的响应时间超过截止时间记为一次截止时间错失，统计值可随时读取。
+ */
+
+#ifndef USER_CODE_SCHEDULER_H_
+#define USER_CODE_SCHEDULER_H_
+
+#include "zf_libraries_headfile.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+// ---- 硬件资源 ----
+#define SCHED_TICK_PIT                (PIT_TIM7)                // 1ms 节拍
+#define SCHED_TICK_PRIORITY           (INTERRUPT_PRIORITY_2)    // 节拍中断只做释放，取高优先级保证节拍不漂移
+#define SCHED_CONTROL_PIT             (PIT_TIM6)                // CONTROL 等级软件中断 (停止计数，仅软件触发)
+#define SCHED_CONTROL_PRIORITY        (INTERRUPT_PRIORITY_5)
+#define SCHED_BACKGROUND_PIT          (PIT_TIM5)                // BACKGROUND 等级软件中断 (停止计数，仅软件触发)
+#define SCHED_BACKGROUND_PRIORITY     (INTERRUPT_PRIORITY_12)
+
+// ---- 任务周期 / 相位 / 截止时间 (单位 ms，相位需小于周期) ----
+#define SCHED_TICK_MS                 (1)
+#define SCHED_NAVIGATION_PERIOD_MS    (100)     // 与 RTK 输出频率 (10Hz) 一致
+#define SCHED_KEY_TASK_ENABLE         (1)       // [请确认硬件] 按键扫描任务，引脚见 zf_device_key.h 中 KEY_LIST
+#define SCHED_KEY_PERIOD_MS           (10)
+
+#define SCHED_SPEED_PHASE_MS          (0)       // 速度环: 编码器采样与 PWM 输出
+#define SCHED_SPEED_DEADLINE_MS       (2)
+#define SCHED_KEY_PHASE_MS            (3)
+#define SCHED_KEY_DEADLINE_MS         (SCHED_KEY_PERIOD_MS)
+#define SCHED_NAVIGATION_PHASE_MS     (5)       // 落在两次速度环之间，新的转向/速度指令在下一次速度环统一生效
+#define SCHED_NAVIGATION_DEADLINE_MS  (50)
+#define SCHED_REPORT_PERIOD_MS        (100)     // 速度环调试打印
+#define SCHED_REPORT_PHASE_MS         (55)
+#define SCHED_REPORT_DEADLINE_MS      (SCHED_REPORT_PERIOD_MS)
+#define SCHED_TRACE_TASK_ENABLE       (ZF_TRACE_ENABLE)   // 事件跟踪输出任务，跟踪关闭时不占用任务表
+#define SCHED_TRACE_PERIOD_MS         (25)      // 每次最多输出 ZF_TRACE_DRAIN_RECORDS_MAX 个事件 (阻塞约 23ms)，周期略长于此
+#define SCHED_TRACE_PHASE_MS          (15)
+#define SCHED_TRACE_DEADLINE_MS       (SCHED_TRACE_PERIOD_MS)
+
+typedef enum
+{
+    SCHED_LEVEL_CONTROL,
+    SCHED_LEVEL_BACKGROUND,
+    SCHED_LEVEL_NUM,
+} scheduler_level_e;
+
+// 任务编号，同时是任务表下标，同一等级内编号越小优先级越高
+typedef enum
+{
+    SCHED_TASK_SPEED,
+#if SCHED_KEY_TASK_ENABLE
+    SCHED_TASK_KEY,
+#endif
+    SCHED_TASK_NAVIGATION,
+    SCHED_TASK_REPORT,
+#if SCHED_TRACE_TASK_ENABLE
+    SCHED_TASK_TRACE,                   // 放在表尾，BACKGROUND 等级内优先级最低，不推迟导航计算
+#endif
+    SCHED_TASK_NUM,
+} scheduler_task_id_e;
+
+// 事件跟踪 (zf_common_trace.h) 的标记与计数编号，任务编号直接沿用 scheduler_task_id_e，名称均在 scheduler_init 中登记
+typedef enum
+{
+    SCHED_TRACE_MARKER_GNSS_FIX,        // 导航任务取到一帧新定位
+    SCHED_TRACE_MARKER_NUM,
+} scheduler_trace_marker_e;
+
+typedef enum
+{
+    SCHED_TRACE_COUNTER_WHEEL_CMPS,     // 车轮速度 cm/s
+    SCHED_TRACE_COUNTER_MOTOR_OUTPUT,   // 速度环输出，百分比 x100
+    SCHED_TRACE_COUNTER_NUM,
+} scheduler_trace_counter_e;
+
+typedef struct
+{
+    const char        *name;
+    void             (*function)(void);
+    uint16_t           period_ms;
+    uint16_t           phase_ms;
+    uint16_t           deadline_ms;
+    scheduler_level_e  level;
+} scheduler_task_t;
+
+typedef struct
+{
+    uint32_t run_count;             // 完成次数
+    uint32_t overrun_count;         // 释放时上一次尚未完成的次数 (该次释放被丢弃)
+    uint32_t deadline_miss_count;   // 响应时间超过截止时间的次数
+    uint16_t last_response_ms;      // 最近一次从释放到完成的时间
+    uint16_t max_response_ms;
+} scheduler_task_stats_t;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化并启动调度器
+ * @note   在所有被调度模块 (speed_control / navigation 等) 初始化完成后调用，调用后任务立即开始释放。
+ */
+void scheduler_init(void);
+
+/**
+ * @brief  获取调度器节拍计数 (ms)，启动后从 0 开始
+ */
+uint32_t scheduler_get_tick_ms(void);
+
+/**
+ * @brief  获取任务表项
+ * @return const scheduler_task_t*: 编号无效时返回 NULL
+ */
+const scheduler_task_t *scheduler_get_task(scheduler_task_id_e id);
+
+/**
+ * @brief  获取任务运行统计 (一致快照)
+ * @return bool: 编号无效时返回 false
+ */
+bool scheduler_get_task_stats(scheduler_task_id_e id, scheduler_task_stats_t *stats);
+
+/**
+ * @brief  清零所有任务的统计值
+ */
+void scheduler_reset_stats(void);
+
+/**
+ * @brief  后台任务 (在主循环中调用)
+ * @note   发现新的超限或截止时间错失时打印对应任务的统计值。
+ */
+void scheduler_background_task(void);
+
+#endif /* USER_CODE_SCHEDULER_H_ */
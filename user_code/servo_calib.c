@@ -0,0 +1,155 @@
+/*
+ * servo_calib.c
+ *
+ *  Created on: 2025年7月27日
+ *      Author: 20766
+ */
+#include "servo_calib.h"
+#include "motion_control.h"
+#include "bsp_flash_param.h"
+#include "zf_libraries_headfile.h"
+
+// ================== 内部变量 ==================
+static servo_calib_table_t g_calib_table;           // 当前生效的标定表
+static servo_calib_table_t g_calib_measure;         // 标定过程中的测量结果
+static volatile servo_calib_state_e g_calib_state = SERVO_CALIB_IDLE;
+static uint8_t g_calib_index = 0;
+static bool    g_calib_save_pending = false;
+
+// ================== 内部辅助函数 ==================
+
+static uint16_t servo_calib_point_pulse(uint8_t index)
+{
+    return (uint16_t)(SERVO_CALIB_PULSE_MIN_US
+                      + (uint32_t)(SERVO_CALIB_PULSE_MAX_US - SERVO_CALIB_PULSE_MIN_US) * index / (SERVO_CALIB_POINTS - 1));
+}
+
+/**
+ * @brief  检查单调性并生成角度->比较计数表
+ * @note   脉宽增大时转角可以增大也可以减小 (取决于舵机安装方向)，统一转换为转角递增的顺序交给 motion_control。
+ */
+static bool servo_calib_apply(const servo_calib_table_t *table)
+{
+    uint8_t  count = table->count;
+    float    angle_deg[SERVO_CALIB_POINTS];
+    uint16_t pulse_us[SERVO_CALIB_POINTS];
+
+    if (count < 2 || count > SERVO_CALIB_POINTS) return false;
+
+    bool increasing = (table->angle_deg[count - 1] > table->angle_deg[0]);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t src = increasing ? i : (uint8_t)(count - 1 - i);
+        angle_deg[i] = table->angle_deg[src];
+        pulse_us[i] = table->pulse_us[src];
+        if (i > 0 && angle_deg[i] - angle_deg[i - 1] < SERVO_CALIB_MIN_STEP_DEG) return false;
+    }
+
+    return motion_servo_build_table(angle_deg, pulse_us, count);
+}
+
+// ================== API函数实现 ==================
+
+void servo_calib_init(void)
+{
+    g_calib_state = SERVO_CALIB_IDLE;
+    g_calib_save_pending = false;
+
+    servo_calib_table_t stored_table;
+    if (bsp_flash_param_load(BSP_FLASH_PARAM_SERVO_CALIB, &stored_table, sizeof(stored_table))
+        && servo_calib_apply(&stored_table))
+    {
+        g_calib_table = stored_table;
+        printf("Servo calibration loaded from flash: %.1f deg @ %uus ... %.1f deg @ %uus\n",
+               g_calib_table.angle_deg[0], g_calib_table.pulse_us[0],
+               g_calib_table.angle_deg[g_calib_table.count - 1], g_calib_table.pulse_us[g_calib_table.count - 1]);
+        return;
+    }
+
+    // 无有效标定时，使用手工测得的三点 (MIN / NEUTRAL / MAX)
+    memset(&g_calib_table, 0, sizeof(g_calib_table));
+    g_calib_table.count = 3;
+    g_calib_table.pulse_us[0] = SERVO_DUTY_MIN_US;      g_calib_table.angle_deg[0] = SERVO_ANGLE_MIN;
+    g_calib_table.pulse_us[1] = SERVO_DUTY_NEUTRAL_US;  g_calib_table.angle_deg[1] = 0.0f;
+    g_calib_table.pulse_us[2] = SERVO_DUTY_MAX_US;      g_calib_table.angle_deg[2] = SERVO_ANGLE_MAX;
+    servo_calib_apply(&g_calib_table);
+}
+
+void servo_calib_start(void)
+{
+    if (SERVO_CALIB_RUNNING == g_calib_state) return;
+
+    g_calib_index = 0;
+    g_calib_measure.count = SERVO_CALIB_POINTS;
+    for (uint8_t i = 0; i < SERVO_CALIB_POINTS; i++)
+    {
+        g_calib_measure.pulse_us[i] = servo_calib_point_pulse(i);
+        g_calib_measure.angle_deg[i] = 0.0f;
+    }
+    g_calib_state = SERVO_CALIB_RUNNING;
+    motion_set_servo_pulse_us(g_calib_measure.pulse_us[0]);
+}
+
+bool servo_calib_record(float measured_angle_deg)
+{
+    if (SERVO_CALIB_RUNNING != g_calib_state) return false;
+
+    g_calib_measure.angle_deg[g_calib_index] = measured_angle_deg;
+    printf("Servo calibration point %u: %uus -> %.2f deg\n",
+           g_calib_index, g_calib_measure.pulse_us[g_calib_index], measured_angle_deg);
+
+    if (++g_calib_index < SERVO_CALIB_POINTS)
+    {
+        motion_set_servo_pulse_us(g_calib_measure.pulse_us[g_calib_index]);
+        return true;
+    }
+
+    // 全部测完: 单调才生效，否则沿用原表
+    if (servo_calib_apply(&g_calib_measure))
+    {
+        g_calib_table = g_calib_measure;
+        g_calib_save_pending = true;
+        g_calib_state = SERVO_CALIB_DONE;
+    }
+    else
+    {
+        printf("Servo calibration FAILED: angles are not monotonic\n");
+        g_calib_state = SERVO_CALIB_FAILED;
+    }
+    motion_set_servo_angle(0.0f);
+    return true;
+}
+
+void servo_calib_cancel(void)
+{
+    if (SERVO_CALIB_RUNNING != g_calib_state) return;
+
+    g_calib_state = SERVO_CALIB_IDLE;
+    motion_set_servo_angle(0.0f);
+}
+
+servo_calib_state_e servo_calib_get_state(void)
+{
+    return g_calib_state;
+}
+
+uint8_t servo_calib_get_point_index(void)
+{
+    return g_calib_index;
+}
+
+const servo_calib_table_t *servo_calib_get_table(void)
+{
+    return &g_calib_table;
+}
+
+void servo_calib_background_task(void)
+{
+    if (g_calib_save_pending)
+    {
+        g_calib_save_pending = false;
+        servo_calib_table_t table = g_calib_table;
+        bool ok = bsp_flash_param_save(BSP_FLASH_PARAM_SERVO_CALIB, &table, sizeof(table));
+        printf("Servo calibration flash %s\n", ok ? "saved" : "save FAILED");
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * servo_calib.h
+ *
+ *  Created on: 2025年7月27日
+ *      Author: 20766
+ *
+ *  [文件说明] 舵机脉宽-转角标定表。
+ *            舵机连杆是非线性的，不同车体的中位也不一样，MIN/NEUTRAL/MAX 三点两段直线只是近似。
+ *            标定时按 SERVO_CALIB_POINTS 个等间距脉宽依次驱动舵机，每一点由调用者测量实际转角
+ *            (量角器或转向估计) 后调用 servo_calib_record 记录，全部完成后检查单调性，
+ *            通过则立即重建 motion_control 的角度->比较计数表，并由后台任务写入 FLASH。
+ *            main_navigation_test 中 KEY_3 短按开始 / 放弃标定，实测转角通过调试串口发送 "cal <deg>" 记录，
+ *            标定期间 navigation 不输出舵机指令。
+ *            上电时 servo_calib_init 从 FLASH 读取标定表，无有效记录时使用三点默认值。
+ */
+
+#ifndef USER_CODE_SERVO_CALIB_H_
+#define USER_CODE_SERVO_CALIB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+#define SERVO_CALIB_POINTS          (9)       // 标定点数 (含两端)
+#define SERVO_CALIB_PULSE_MIN_US    (1150)    // [请修改] 标定起点脉宽，需略宽于实际使用范围
+#define SERVO_CALIB_PULSE_MAX_US    (1950)    // [请修改] 标定终点脉宽，注意不要超过机械限位
+#define SERVO_CALIB_MIN_STEP_DEG    (0.3f)    // 相邻标定点转角至少相差这么多，否则判定为不单调 (卡滞或测量错误)
+
+typedef enum
+{
+    SERVO_CALIB_IDLE,           // 未进行标定
+    SERVO_CALIB_RUNNING,        // 标定中，舵机停在当前标定点脉宽，等待记录实测转角
+    SERVO_CALIB_DONE,           // 完成，新表已生效 (等待后台任务写入 FLASH)
+    SERVO_CALIB_FAILED,         // 测量结果不单调，沿用原表
+} servo_calib_state_e;
+
+// 标定表，按脉宽递增顺序存放，也是写入 FLASH 的格式
+typedef struct
+{
+    uint8_t  count;                         // 有效点数 (默认三点表为 3)
+    uint16_t pulse_us[SERVO_CALIB_POINTS];
+    float    angle_deg[SERVO_CALIB_POINTS];
+} servo_calib_table_t;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  加载 FLASH 中的标定表并生成角度->比较计数表
+ * @note   由 motion_control_init 在 PWM 初始化之后调用。
+ */
+void servo_calib_init(void);
+
+/**
+ * @brief  开始标定，舵机转到第一个标定点
+ * @note   标定期间不要调用 motion_set_servo_angle，否则舵机会离开标定点。
+ */
+void servo_calib_start(void);
+
+/**
+ * @brief  记录当前标定点的实测转角，并转到下一个标定点
+ * @param  measured_angle_deg: 实测转角 (度)，符号约定与 motion_set_servo_angle 一致
+ * @return bool: 不在标定中时返回 false
+ */
+bool servo_calib_record(float measured_angle_deg);
+
+/**
+ * @brief  放弃标定，沿用原表，舵机回中
+ */
+void servo_calib_cancel(void);
+
+/**
+ * @brief  获取标定状态
+ */
+servo_calib_state_e servo_calib_get_state(void);
+
+/**
+ * @brief  获取当前标定点序号 (0 - SERVO_CALIB_POINTS-1)
+ */
+uint8_t servo_calib_get_point_index(void);
+
+/**
+ * @brief  获取当前生效的标定表
+ */
+const servo_calib_table_t *servo_calib_get_table(void);
+
+/**
+ * @brief  后台任务，在主循环中调用，负责把新标定表写入 FLASH
+ */
+void servo_calib_background_task(void);
+
+#endif /* USER_CODE_SERVO_CALIB_H_ */
@@ -6,61 +6,341 @@
 #include "motion_control.h"
 #include "bsp_encoder.h"
 #include "pid.h"
+#include "bsp_flash_param.h"
+#include "topic.h"
+#include "scheduler.h"
 #include "zf_libraries_headfile.h"
 #include <stdio.h> // 包含标准输入输出库，以使用printf
+#include <math.h>
 
 // ================== 内部变量 ==================
-static PID_Controller g_motor_pid;
+static pid_ctrl_t g_motor_pid;
 static float g_current_speed_cmps = 0.0f;
 static float g_target_speed_cmps = 0.0f;
+static uint32_t g_speed_command_seq = 0;    // 已采用的 TOPIC_SPEED_COMMAND 发布序号
+
+// 速度轨迹规划器状态
+static float g_planned_speed_cmps = 0.0f;
+static float g_planned_accel_cmps2 = 0.0f;
+static float g_profile_max_accel = SPEED_PROFILE_MAX_ACCEL;
+static float g_profile_max_jerk = SPEED_PROFILE_MAX_JERK;
 static float g_motor_output = 0.0f;
 static float g_counts_to_cmps_factor = 0.0f;
+static float g_cm_per_count = 0.0f;
+
+static speed_pid_param_t g_pid_param;
+
+// 在线电机模型
+static motor_model_t g_motor_model;
+static float g_model_prev_speed = 0.0f;
+static float g_model_prev_output = 0.0f;
+static float g_model_nominal_gain = 0.0f;   // 当前 PID 增益整定时对应的模型增益，0 表示尚未记录
+static volatile bool g_pid_param_save_pending = false;
+
+// 继电自整定实验的状态
+typedef struct
+{
+    volatile speed_autotune_state_e state;
+    float    setpoint;
+    float    bias;              // 继电输出偏置 (启动时的输出)
+    int8_t   relay_dir;         // 当前继电方向 +1 / -1
+    uint32_t tick;              // 实验开始后的控制周期数
+    uint32_t last_rise_tick;    // 上一次向上切换的时刻，0 表示尚未发生
+    uint8_t  cycles;            // 已完成的振荡周期数
+    float    peak_max, peak_min;
+    float    sum_period_ticks;
+    float    sum_amplitude;
+} speed_autotune_t;
+
+static speed_autotune_t g_autotune = { .state = SPEED_AUTOTUNE_IDLE };
+
+// ================== 内部函数 ==================
+
+/**
+ * @brief  根据临界增益与临界周期计算并应用新的 PID 增益
+ */
+static void speed_control_apply_autotune_result(float ku, float tu_s)
+{
+    const float ts = (float)CONTROL_PERIOD_MS / 1000.0f;
+    const float kp = MOTOR_AUTOTUNE_RULE_KP * ku;
+    const float ti = MOTOR_AUTOTUNE_RULE_TI * tu_s;
+    const float td = MOTOR_AUTOTUNE_RULE_TD * tu_s;
+
+    // 控制器增益是按"每周期"定义的，需要把连续域的 Ti/Td 换算到采样周期
+    g_pid_param.kp = kp;
+    g_pid_param.ki = kp * ts / ti;
+    g_pid_param.kd = kp * td / ts;
+    g_pid_param.ku = ku;
+    g_pid_param.tu_s = tu_s;
+
+    pid_ctrl_set_gains(&g_motor_pid, PID_REAL(g_pid_param.kp), PID_REAL(g_pid_param.ki), PID_REAL(g_pid_param.kd));
+
+    // 新增益是在当前被控对象上整定的，增益调度的基准需要重新记录
+    g_model_nominal_gain = 0.0f;
+}
+
+/**
+ * @brief  加加速度受限的速度轨迹规划，每个控制周期调用一次
+ * @note   规划速度以最快方式逼近目标，同时满足 |a| <= A、|da/dt| <= J。
+ *         判据: 若此刻开始以最大 J 把加速度减到 0，速度还会再变化 a|a|/(2J)，
+ *         把它与剩余速度差比较，决定加速度该增大、减小还是开始收敛。
+ */
+static void speed_control_profile_step(void)
+{
+    const float ts = (float)CONTROL_PERIOD_MS / 1000.0f;
+    const float jerk_step = g_profile_max_jerk * ts;
+    const float error = g_target_speed_cmps - g_planned_speed_cmps;
+#if TRACTION_CONTROL_ENABLE
+    const float max_accel = g_profile_max_accel * traction_control_get_accel_scale();
+#else
+    const float max_accel = g_profile_max_accel;
+#endif
+    float accel = g_planned_accel_cmps2;
+
+    // 已经足够接近时直接对齐，避免在目标附近来回抖动
+    if (fabsf(error) <= jerk_step * ts && fabsf(accel) <= jerk_step)
+    {
+        g_planned_speed_cmps = g_target_speed_cmps;
+        g_planned_accel_cmps2 = 0.0f;
+        return;
+    }
+
+    // 以下一周期的加速度预估收敛所需速度量，提前一步开始减小加速度
+    const float accel_next = accel + ((error > 0.0f) ? jerk_step : -jerk_step);
+    const float stop_delta = accel_next * fabsf(accel_next) / (2.0f * g_profile_max_jerk);
+    const float remaining = error - accel * ts;
+
+    float accel_target;
+    if (remaining > stop_delta)       accel_target = max_accel;
+    else if (remaining < stop_delta)  accel_target = -max_accel;
+    else                              accel_target = 0.0f;
+
+    // 开始收敛阶段 (剩余速度差不足以继续加大加速度) 时只朝 0 方向减小加速度
+    const float stop_now = accel * fabsf(accel) / (2.0f * g_profile_max_jerk);
+    if ((error > 0.0f && error <= stop_now) || (error < 0.0f && error >= stop_now))
+    {
+        accel_target = 0.0f;
+    }
+
+    if (accel < accel_target)       accel = fminf(accel + jerk_step, accel_target);
+    else if (accel > accel_target)  accel = fmaxf(accel - jerk_step, accel_target);
+
+    float speed = g_planned_speed_cmps + accel * ts;
+    // 不越过目标
+    if ((error > 0.0f && speed > g_target_speed_cmps) || (error < 0.0f && speed < g_target_speed_cmps))
+    {
+        speed = g_target_speed_cmps;
+        accel = 0.0f;
+    }
+
+    g_planned_speed_cmps = speed;
+    g_planned_accel_cmps2 = accel;
+}
+
+/**
+ * @brief  在线模型辨识、增益调度，并给出模型前馈
+ * @return float: 施加给 PID 的模型前馈 (输出百分比)
+ */
+static float speed_control_model_step(float speed_cmps)
+{
+#if MOTOR_MODEL_ENABLE
+    // 用上一周期的 (速度, 输出) 与本周期速度组成一组观测
+    if (fabsf(g_model_prev_output) > MOTOR_MODEL_MIN_OUTPUT || fabsf(g_model_prev_speed) > MOTOR_MODEL_MIN_SPEED)
+    {
+        motor_model_update(&g_motor_model, g_model_prev_speed, g_model_prev_output, speed_cmps);
+    }
+
+    if (!motor_model_is_valid(&g_motor_model))
+    {
+        return MOTOR_FF_ACCEL * g_planned_accel_cmps2;
+    }
+
+#if MOTOR_GAIN_SCHEDULE_ENABLE
+    const float gain = motor_model_get_gain(&g_motor_model);
+    if (g_model_nominal_gain <= 0.0f)
+    {
+        g_model_nominal_gain = gain;
+    }
+    float scale = g_model_nominal_gain / gain;
+    if (scale > MOTOR_GAIN_SCHEDULE_MAX) scale = MOTOR_GAIN_SCHEDULE_MAX;
+    else if (scale < MOTOR_GAIN_SCHEDULE_MIN) scale = MOTOR_GAIN_SCHEDULE_MIN;
+    pid_ctrl_set_gains(&g_motor_pid,
+                       PID_REAL(g_pid_param.kp * scale),
+                       PID_REAL(g_pid_param.ki * scale),
+                       PID_REAL(g_pid_param.kd * scale));
+#endif
 
-// ================== 内部函数 (中断服务程序) ==================
+    // 让规划速度在下一周期按规划加速度变化所需的输出 (稳态项 + 加速度项)
+    const float ts = (float)CONTROL_PERIOD_MS / 1000.0f;
+    return MOTOR_MODEL_FF_GAIN * motor_model_feedforward(&g_motor_model,
+                                                         g_planned_speed_cmps,
+                                                         g_planned_speed_cmps + g_planned_accel_cmps2 * ts);
+#else
+    (void)speed_cmps;
+    return MOTOR_FF_ACCEL * g_planned_accel_cmps2;
+#endif
+}
 
 /**
- * @brief  速度闭环控制中断服务程序 (已集成串口直接分析功能)
- * @note   此函数会被PIT定时器以 CONTROL_PERIOD_MS 的周期调用
+ * @brief  继电反馈实验单步，在控制中断中代替 PID 计算输出
+ * @return float: 本周期电机输出
  */
-static void speed_control_interrupt_handler(uint32_t event, void *ptr)
+static float speed_control_autotune_step(float speed_cmps)
 {
-    (void)event; (void)ptr;
+    speed_autotune_t *at = &g_autotune;
+    float error = at->setpoint - speed_cmps;
+
+    at->tick++;
+    if (speed_cmps > at->peak_max) at->peak_max = speed_cmps;
+    if (speed_cmps < at->peak_min) at->peak_min = speed_cmps;
+
+    // 带滞环的继电: 速度越过 setpoint±h 才切换，避免噪声引起的抖动切换
+    if (at->relay_dir > 0 && error < -MOTOR_AUTOTUNE_HYSTERESIS)
+    {
+        at->relay_dir = -1;
+    }
+    else if (at->relay_dir < 0 && error > MOTOR_AUTOTUNE_HYSTERESIS)
+    {
+        // 以向上切换为一个周期的起点，统计周期与峰峰值
+        at->relay_dir = 1;
+        if (at->last_rise_tick != 0)
+        {
+            at->cycles++;
+            if (at->cycles > MOTOR_AUTOTUNE_SKIP_CYCLES)
+            {
+                at->sum_period_ticks += (float)(at->tick - at->last_rise_tick);
+                at->sum_amplitude += (at->peak_max - at->peak_min) * 0.5f;
+            }
+        }
+        at->last_rise_tick = at->tick;
+        at->peak_max = speed_cmps;
+        at->peak_min = speed_cmps;
+    }
+
+    if (at->cycles >= MOTOR_AUTOTUNE_SKIP_CYCLES + MOTOR_AUTOTUNE_MEAS_CYCLES)
+    {
+        const float a = at->sum_amplitude / (float)MOTOR_AUTOTUNE_MEAS_CYCLES;
+        const float h = MOTOR_AUTOTUNE_HYSTERESIS;
+        if (a > h)
+        {
+            // 描述函数法: Ku = 4d / (π * sqrt(a² - h²))，滞环修正了切换延迟带来的偏差
+            const float ku = 4.0f * MOTOR_AUTOTUNE_RELAY_AMP / (3.1415926f * sqrtf(a * a - h * h));
+            const float tu_s = at->sum_period_ticks / (float)MOTOR_AUTOTUNE_MEAS_CYCLES * (float)CONTROL_PERIOD_MS / 1000.0f;
+            speed_control_apply_autotune_result(ku, tu_s);
+            g_pid_param_save_pending = true;
+            at->state = SPEED_AUTOTUNE_DONE;
+        }
+        else
+        {
+            at->state = SPEED_AUTOTUNE_FAILED;
+        }
+        // 从实验偏置无扰切回 PID，规划器从当前速度重新起步
+        pid_ctrl_reset(&g_motor_pid, PID_REAL(at->bias));
+        g_planned_speed_cmps = speed_cmps;
+        g_planned_accel_cmps2 = 0.0f;
+        return at->bias;
+    }
+
+    if (at->tick * CONTROL_PERIOD_MS >= MOTOR_AUTOTUNE_TIMEOUT_MS)
+    {
+        at->state = SPEED_AUTOTUNE_FAILED;
+        g_target_speed_cmps = 0.0f;
+        g_planned_speed_cmps = speed_cmps;
+        g_planned_accel_cmps2 = 0.0f;
+        pid_ctrl_reset(&g_motor_pid, PID_REAL(0.0f));
+        return 0.0f;
+    }
+
+    return at->bias + (float)at->relay_dir * MOTOR_AUTOTUNE_RELAY_AMP;
+}
+
+// ================== 调度任务 ==================
+
+void speed_control_task(void)
+{
+    // --- 0. 取新的速度指令 (只在发布序号变化时采用，自整定内部改写的目标不会被旧指令覆盖) ---
+    if (topic_get_sequence(TOPIC_SPEED_COMMAND) != g_speed_command_seq)
+    {
+        topic_speed_command_t command;
+        if (topic_read(TOPIC_SPEED_COMMAND, &command, &g_speed_command_seq, NULL))
+        {
+            g_target_speed_cmps = command.target_cmps;
+        }
+    }
 
     // --- 1. 感知 (Perception) ---
-    int16_t counts = encoder_get_and_clear_counts();
+    int32_t counts = encoder_update();
     counts = -counts;
     g_current_speed_cmps = (float)counts * g_counts_to_cmps_factor;
 
     // --- 2. 决策 (Decision) ---
-    float pid_increment = PID_IncCalc(&g_motor_pid, g_current_speed_cmps);
-
-    // --- 3. 执行 (Execution) ---
-    if (!((g_motor_output >= 100.0f && pid_increment > 0) ||
-          (g_motor_output <= -100.0f && pid_increment < 0)))
+#if TRACTION_CONTROL_ENABLE
+    // 每周期记录车轮速度并更新牵引力输出上限 (自整定期间同样记录，但不施加限制)
+    const float traction_ceiling = fminf(traction_control_step(g_current_speed_cmps, g_motor_output), MOTOR_OUTPUT_MAX);
+#endif
+    if (SPEED_AUTOTUNE_RUNNING == g_autotune.state)
     {
-        g_motor_output += pid_increment;
+        // 自整定期间由继电实验接管输出
+        g_motor_output = speed_control_autotune_step(g_current_speed_cmps);
     }
-    if (g_motor_output > 100.0f) { g_motor_output = 100.0f; }
-    else if (g_motor_output < -100.0f) { g_motor_output = -100.0f; }
+    else
+    {
+        // 先推进轨迹规划，PID 跟踪规划速度，规划速度/加速度同时作为前馈
+        speed_control_profile_step();
 
-    motion_set_motor_speed_openloop((int16_t)g_motor_output, (int16_t)g_motor_output);
+#if TRACTION_CONTROL_ENABLE
+        // 打滑时收紧 PID 输出限幅，反算抗饱和随之生效，积分不会在限幅期间累积
+        pid_ctrl_set_output_limits(&g_motor_pid, PID_REAL(-traction_ceiling), PID_REAL(traction_ceiling));
+#endif
 
+        // 位置式 PID，限幅、抗饱和与输出限速均在 pid_ctrl 内部完成
+        float model_ff = speed_control_model_step(g_current_speed_cmps);
+        g_motor_output = PID_TO_FLOAT(pid_ctrl_update(&g_motor_pid,
+                                                      PID_REAL(g_planned_speed_cmps),
+                                                      PID_REAL(g_current_speed_cmps),
+                                                      PID_REAL(model_ff)));
+    }
 
-    // --- 4. [AI-MOD] 调试信息打印 (用于直接串口分析) ---
-    // 使用一个静态计数器来降低打印频率，避免刷屏
-    static int print_counter = 0;
-    // 假设 CONTROL_PERIOD_MS=10ms, "10" 表示每 10*10ms = 100ms 打印一次
-    if (++print_counter >= 10)
-    {
-        print_counter = 0;
-        float error = g_target_speed_cmps - g_current_speed_cmps;
+    // --- 3. 执行 (Execution) ---
+    // 全分辨率占空比直接映射到 HRTIM 比较计数，不再量化为整数百分比
+#if CURRENT_CONTROL_ENABLE
+    // 由电流中断在下一个 PWM 周期施加，并受限流环约束
+    current_control_set_duty(g_motor_output / 100.0f);
+#else
+    motion_set_motor_duty(g_motor_output / 100.0f);
+#endif
 
-        printf("Target:%5.1f | Current:%5.1f | Error:%+6.1f | Output:%4d\n",
-               g_target_speed_cmps,
-               g_current_speed_cmps,
-               error,
-               (int)g_motor_output);
-    }
+    // 记录实际施加的输出 (经过死区与换向处理)，供下一周期模型辨识
+    g_model_prev_speed = g_current_speed_cmps;
+    g_model_prev_output = motion_get_motor_duty() * 100.0f;
+
+    // 舵机滞后模型与速度环同周期推进 (SERVO_MODEL_PERIOD_MS == CONTROL_PERIOD_MS)
+    motion_servo_model_update();
+
+    // 电机与舵机都已暂存，每个控制周期统一提交一次，两者落在同一个更新事件
+    motion_control_commit();
+
+    // --- 4. 发布本周期状态，其他任务读取同一时刻的一致快照 ---
+    const topic_wheel_speed_t wheel_speed = {
+        .current_cmps        = g_current_speed_cmps,
+        .planned_cmps        = g_planned_speed_cmps,
+        .planned_accel_cmps2 = g_planned_accel_cmps2,
+        .motor_output        = g_motor_output,
+    };
+    topic_publish(TOPIC_WHEEL_SPEED, &wheel_speed);
+    zf_trace_counter(SCHED_TRACE_COUNTER_WHEEL_CMPS, g_current_speed_cmps);
+    zf_trace_counter(SCHED_TRACE_COUNTER_MOTOR_OUTPUT, g_motor_output * 100.0f);
+}
+
+void speed_control_report_task(void)
+{
+    float error = g_planned_speed_cmps - g_current_speed_cmps;
+
+    printf("Target:%5.1f | Current:%5.1f | Error:%+6.1f | Output:%4d\n",
+           g_planned_speed_cmps,
+           g_current_speed_cmps,
+           error,
+           (int)g_motor_output);
 }
 
 // ================== API函数实现 ==================
@@ -72,6 +352,9 @@ void speed_control_init(void)
     // 1. 初始化依赖的底层模块
     encoder_init();
     motion_control_init();
+#if CURRENT_CONTROL_ENABLE
+    current_control_init();
+#endif
 
     // 2. 计算转换系数
     const float wheel_circumference_cm = (WHEEL_DIAMETER_MM / 10.0f) * 3.1415926f;
@@ -79,23 +362,139 @@ void speed_control_init(void)
     const float pulses_per_wheel_rev = total_pulses_per_rev * GEAR_RATIO;
     const float cm_per_pulse = wheel_circumference_cm / pulses_per_wheel_rev;
     const float control_period_s = (float)CONTROL_PERIOD_MS / 1000.0f;
+    g_cm_per_count = cm_per_pulse;
     g_counts_to_cmps_factor = cm_per_pulse / control_period_s;
 
     // 3. 初始化PID控制器
-    PID_Init(&g_motor_pid, MOTOR_PID_KP, MOTOR_PID_KI, MOTOR_PID_KD);
+    const pid_ctrl_config_t pid_config = {
+        .mode           = PID_MODE_POSITIONAL,
+        .kp             = PID_REAL(MOTOR_PID_KP),
+        .ki             = PID_REAL(MOTOR_PID_KI),
+        .kd             = PID_REAL(MOTOR_PID_KD),
+        .kb             = PID_REAL(MOTOR_PID_KB),
+        .beta           = PID_REAL(1.0f),
+        .gamma          = PID_REAL(MOTOR_PID_SP_WEIGHT_D),
+        .d_filter_alpha = PID_REAL(MOTOR_PID_D_FILTER),
+        .kff_static     = PID_REAL(MOTOR_FF_STATIC),
+        .kff_velocity   = PID_REAL(MOTOR_FF_VELOCITY),
+        .out_min        = PID_REAL(-MOTOR_OUTPUT_MAX),
+        .out_max        = PID_REAL(MOTOR_OUTPUT_MAX),
+        .rate_limit     = PID_REAL(MOTOR_OUTPUT_RATE_LIMIT),
+    };
+    pid_ctrl_init(&g_motor_pid, &pid_config);
+
+    motor_model_init(&g_motor_model, MOTOR_MODEL_LAMBDA, 0.9f, 0.1f, 0.0f);
+    traction_control_init();
+
+    // 若 FLASH 中有自整定保存的增益，则覆盖编译期默认值
+    g_pid_param.kp = MOTOR_PID_KP;
+    g_pid_param.ki = MOTOR_PID_KI;
+    g_pid_param.kd = MOTOR_PID_KD;
+    g_pid_param.ku = 0.0f;
+    g_pid_param.tu_s = 0.0f;
+    speed_pid_param_t stored_param;
+    if (bsp_flash_param_load(BSP_FLASH_PARAM_MOTOR_PID, &stored_param, sizeof(stored_param)))
+    {
+        g_pid_param = stored_param;
+        pid_ctrl_set_gains(&g_motor_pid, PID_REAL(g_pid_param.kp), PID_REAL(g_pid_param.ki), PID_REAL(g_pid_param.kd));
+        printf("Speed PID loaded from flash: Kp=%.3f Ki=%.3f Kd=%.3f\n", g_pid_param.kp, g_pid_param.ki, g_pid_param.kd);
+    }
     speed_control_set_speed(0.0f);
 
-    // 4. 初始化并启动单个PIT定时器，用于速度闭环控制
-    zf_pit_ms_init(PIT_TIM7, CONTROL_PERIOD_MS, speed_control_interrupt_handler, NULL);
+    // 4. 速度闭环由 scheduler 以 CONTROL_PERIOD_MS 周期调度 (speed_control_task)
 }
 
 void speed_control_set_speed(float target_speed_cmps)
 {
-    g_target_speed_cmps = target_speed_cmps;
-    PID_SetPoint(&g_motor_pid, g_target_speed_cmps);
+    const topic_speed_command_t command = { .target_cmps = target_speed_cmps };
+    topic_publish(TOPIC_SPEED_COMMAND, &command);
+}
+
+void speed_control_set_profile_limits(float max_accel_cmps2, float max_jerk_cmps3)
+{
+    if (max_accel_cmps2 <= 0.0f || max_jerk_cmps3 <= 0.0f) return;
+    g_profile_max_accel = max_accel_cmps2;
+    g_profile_max_jerk = max_jerk_cmps3;
+}
+
+float speed_control_get_planned_speed(void)
+{
+    return g_planned_speed_cmps;
+}
+
+float speed_control_get_planned_accel(void)
+{
+    return g_planned_accel_cmps2;
 }
 
 float speed_control_get_current_speed(void)
 {
     return g_current_speed_cmps;
 }
+
+void speed_control_autotune_start(float setpoint_cmps)
+{
+    if (SPEED_AUTOTUNE_RUNNING == g_autotune.state) return;
+
+    g_autotune.setpoint = setpoint_cmps;
+    g_autotune.bias = g_motor_output;
+    g_autotune.relay_dir = 1;
+    g_autotune.tick = 0;
+    g_autotune.last_rise_tick = 0;
+    g_autotune.cycles = 0;
+    g_autotune.peak_max = g_current_speed_cmps;
+    g_autotune.peak_min = g_current_speed_cmps;
+    g_autotune.sum_period_ticks = 0.0f;
+    g_autotune.sum_amplitude = 0.0f;
+    g_target_speed_cmps = setpoint_cmps;
+
+    // 状态最后置位，控制中断看到 RUNNING 时其余字段已准备好
+    g_autotune.state = SPEED_AUTOTUNE_RUNNING;
+}
+
+speed_autotune_state_e speed_control_autotune_get_state(void)
+{
+    return g_autotune.state;
+}
+
+speed_pid_param_t speed_control_get_pid_param(void)
+{
+    return g_pid_param;
+}
+
+const motor_model_t *speed_control_get_motor_model(void)
+{
+    return &g_motor_model;
+}
+
+void speed_control_background_task(void)
+{
+    if (g_pid_param_save_pending)
+    {
+        g_pid_param_save_pending = false;
+        speed_pid_param_t param = g_pid_param;
+        bool ok = bsp_flash_param_save(BSP_FLASH_PARAM_MOTOR_PID, &param, sizeof(param));
+        printf("Autotune: Ku=%.3f Tu=%.3fs -> Kp=%.3f Ki=%.3f Kd=%.3f, flash %s\n",
+               param.ku, param.tu_s, param.kp, param.ki, param.kd, ok ? "saved" : "save FAILED");
+    }
+#if CURRENT_CONTROL_ENABLE
+    // 电流采样标定超时由速度环切到 BYPASS，控制任务中不打印，在这里提示一次
+    static bool current_bypass_reported = false;
+    if (!current_bypass_reported && CURRENT_STATE_BYPASS == current_control_get_state())
+    {
+        current_bypass_reported = true;
+        printf("[CURRENT] calibration timeout, ADC not triggered, bypass current loop\r\n");
+    }
+#endif
+}
+
+float speed_control_get_total_distance_cm(void)
+{
+    // 与速度保持同一符号约定 (编码器安装方向取反)
+    return -(float)encoder_get_total_counts() * g_cm_per_count;
+}
+
+int32_t speed_control_get_period_counts(void)
+{
+    return -encoder_get_period_delta();
+}
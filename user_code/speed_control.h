@@ -12,6 +12,9 @@
 #include "bsp_encoder.h"
 #include "motion_control.h"
 #include "pid.h"
+#include "motor_model.h"
+#include "current_control.h"
+#include "traction_control.h"
 
 // ================== 配置与宏定义 ==================
 
@@ -27,6 +30,63 @@
 #define MOTOR_PID_KP            (0.4f)
 #define MOTOR_PID_KI            (0.15f)
 #define MOTOR_PID_KD            (0.8f)
+#define MOTOR_PID_KB            (0.3f)    // 反算抗饱和增益，约取 Ki/Kp
+#define MOTOR_PID_D_FILTER      (0.3f)    // 微分低通系数 alpha = Ts/(Tf+Ts)，0.3 约对应 Tf = 23ms
+#define MOTOR_PID_SP_WEIGHT_D   (0.0f)    // D 项设定值权重，0 = 微分先行，设定值突变不产生冲击
+
+// ---- 前馈与输出限制 ----
+#define MOTOR_FF_STATIC         (0.0f)    // 静摩擦前馈 (输出百分比)，克服起步死区
+#define MOTOR_FF_VELOCITY       (0.0f)    // 速度前馈 (输出百分比 / (cm/s))
+#define MOTOR_OUTPUT_MAX        (100.0f)  // 输出限幅 (百分比)
+#define MOTOR_OUTPUT_RATE_LIMIT (10.0f)   // 每个控制周期输出最大变化量 (百分比)，0 为不限制
+
+// ---- 速度轨迹规划 (加速度 + 加加速度限制) ----
+#define SPEED_PROFILE_MAX_ACCEL      (150.0f)  // 最大加速度 (cm/s²)
+#define SPEED_PROFILE_MAX_JERK       (600.0f)  // 最大加加速度 (cm/s³)
+#define MOTOR_FF_ACCEL               (0.0f)    // 模型无效时的加速度前馈增益 (输出百分比 / (cm/s²))
+
+// ---- 在线电机模型 (RLS) 与自适应 ----
+#define MOTOR_MODEL_ENABLE           (1)       // 是否在速度环中运行 RLS 辨识
+#define MOTOR_MODEL_LAMBDA           (0.995f)  // 遗忘因子，记忆长度约 200 个周期 (2 秒)
+#define MOTOR_MODEL_MIN_OUTPUT       (1.0f)    // 输出与速度都低于阈值时不更新 (静止时无激励)
+#define MOTOR_MODEL_MIN_SPEED        (1.0f)
+#define MOTOR_MODEL_FF_GAIN          (0.8f)    // 模型前馈的施加比例，留余量给 PID，0 为关闭
+#define MOTOR_GAIN_SCHEDULE_ENABLE   (0)       // [请验证] 按 K_nominal / K_estimated 缩放 PID 增益，保持回路增益不变，确认实车上模型估计可信后再置 1
+#define MOTOR_GAIN_SCHEDULE_MIN      (0.5f)
+#define MOTOR_GAIN_SCHEDULE_MAX      (2.0f)
+
+// ---- 电流内环 ----
+#define CURRENT_CONTROL_ENABLE       (0)       // [请确认硬件] 速度环输出经电流模块限流后再施加，核对 current_control.h 中的引脚与 JEXTSEL 后再置 1
+
+// ---- 牵引力控制 ----
+#define TRACTION_CONTROL_ENABLE      (0)       // [请标定] 按编码器与 GNSS 速度之差估计打滑，打滑时限制输出与加速度，标定 TRACTION_GNSS_DELAY_TICKS 后再置 1
+
+// ---- 继电反馈自整定 (Åström–Hägglund) ----
+#define MOTOR_AUTOTUNE_RELAY_AMP     (15.0f)   // 继电幅值 d (输出百分比)
+#define MOTOR_AUTOTUNE_HYSTERESIS    (2.0f)    // 继电滞环 h (cm/s)，需大于速度噪声
+#define MOTOR_AUTOTUNE_SKIP_CYCLES   (2)       // 丢弃前几个振荡周期，等待进入稳定极限环
+#define MOTOR_AUTOTUNE_MEAS_CYCLES   (4)       // 参与平均的振荡周期数
+#define MOTOR_AUTOTUNE_TIMEOUT_MS    (8000)    // 超时未完成则放弃，电机停止
+#define MOTOR_AUTOTUNE_MIN_SPEED_CMPS (10.0f)  // 按键触发时以当前规划速度为工作点，低于此速度 (静摩擦区) 不启动
+// 整定规则 (Ziegler-Nichols "some overshoot")：Kp = c_p*Ku, Ti = c_i*Tu, Td = c_d*Tu
+#define MOTOR_AUTOTUNE_RULE_KP       (0.33f)
+#define MOTOR_AUTOTUNE_RULE_TI       (0.5f)
+#define MOTOR_AUTOTUNE_RULE_TD       (0.33f)
+
+typedef enum
+{
+    SPEED_AUTOTUNE_IDLE,        // 未进行自整定
+    SPEED_AUTOTUNE_RUNNING,     // 继电实验进行中，PID 被旁路
+    SPEED_AUTOTUNE_DONE,        // 完成，新增益已生效 (等待后台任务写入 FLASH)
+    SPEED_AUTOTUNE_FAILED,      // 超时或振荡幅值无效，沿用原增益
+} speed_autotune_state_e;
+
+typedef struct
+{
+    float kp, ki, kd;           // 每控制周期增益，与 MOTOR_PID_KP/KI/KD 含义相同
+    float ku;                   // 辨识出的临界增益 (输出百分比 / (cm/s))
+    float tu_s;                 // 辨识出的临界周期 (秒)
+} speed_pid_param_t;
 
 // ================== API函数声明 ==================
 
@@ -37,19 +97,101 @@
  */
 void speed_control_init(void);
 
+/**
+ * @brief  速度闭环控制任务: 编码器采样、轨迹规划、PID 与输出
+ * @note   由 scheduler 以 CONTROL_PERIOD_MS 周期在 CONTROL 等级调度，不要在其他地方调用
+ */
+void speed_control_task(void);
+
+/**
+ * @brief  速度环调试打印任务 (目标/当前速度、误差、输出)
+ * @note   由 scheduler 在 BACKGROUND 等级低频调度，打印不再占用控制中断时间
+ */
+void speed_control_report_task(void);
+
 /**
  * @brief  设置电机目标速度
  * @param  target_speed_cmps: 目标速度 (单位: 厘米/秒 cm/s)
  * @retval None
- * @note   由于是单电机驱动四轮，我们只需要一个目标速度
+ * @note   由于是单电机驱动四轮，我们只需要一个目标速度。
+ *         设定值不会阶跃，而是由轨迹规划器按加速度、加加速度限制每个控制周期平滑逼近。
+ *         目标通过 TOPIC_SPEED_COMMAND 发布，下一个控制周期生效；该话题只允许一个任务调用本函数。
  */
 void speed_control_set_speed(float target_speed_cmps);
 
+/**
+ * @brief  设置速度轨迹规划的加速度与加加速度限制
+ * @param  max_accel_cmps2: 最大加速度 (cm/s²)
+ * @param  max_jerk_cmps3: 最大加加速度 (cm/s³)
+ * @retval None
+ */
+void speed_control_set_profile_limits(float max_accel_cmps2, float max_jerk_cmps3);
+
+/**
+ * @brief  获取规划器当前输出的速度 (即 PID 实际跟踪的设定值)
+ * @return float: 规划速度 (cm/s)
+ */
+float speed_control_get_planned_speed(void);
+
+/**
+ * @brief  获取规划器当前输出的加速度
+ * @return float: 规划加速度 (cm/s²)
+ */
+float speed_control_get_planned_accel(void);
+
 /**
  * @brief  获取当前计算出的电机速度
  * @return float: 当前速度 (单位: 厘米/秒 cm/s)
  */
 float speed_control_get_current_speed(void);
 
+/**
+ * @brief  启动速度环继电反馈自整定
+ * @param  setpoint_cmps: 实验工作点速度 (cm/s)，继电围绕该速度切换
+ * @retval None
+ * @note   实验以当前输出为偏置，输出在 偏置±MOTOR_AUTOTUNE_RELAY_AMP 间切换，
+ *         因此应先用 speed_control_set_speed(setpoint_cmps) 让车稳定运行在工作点附近再启动。
+ *         通常 2~3 秒完成。请在车轮悬空或场地安全的情况下进行。
+ *         主程序中 KEY_1 长按即以当前规划速度为工作点调用本函数 (见 src/main_navigation_test.c)。
+ */
+void speed_control_autotune_start(float setpoint_cmps);
+
+/**
+ * @brief  获取自整定状态
+ */
+speed_autotune_state_e speed_control_autotune_get_state(void);
+
+/**
+ * @brief  获取当前生效的 PID 参数 (自整定结果或 FLASH 中保存的参数)
+ */
+speed_pid_param_t speed_control_get_pid_param(void);
+
+/**
+ * @brief  获取在线辨识的电机模型 (只读)
+ * @note   用 motor_model_get_gain / get_time_constant / get_friction_output 查看辨识结果
+ */
+const motor_model_t *speed_control_get_motor_model(void);
+
+/**
+ * @brief  速度控制后台任务
+ * @note   在主循环中周期调用。自整定完成后在此把新增益写入用户 FLASH，
+ *         FLASH 擦写耗时较长，因此不放在控制中断里执行。
+ *         电流采样标定超时进入 BYPASS 时也在此输出一次提示。
+ */
+void speed_control_background_task(void);
+
+/**
+ * @brief  获取上电以来的累计行驶距离 (里程)
+ * @return float: 累计距离 (单位: 厘米 cm)，后退为负
+ * @note   由编码器 64 位累加计数换算，不受控制周期采样误差影响，可直接用于航位推算
+ */
+float speed_control_get_total_distance_cm(void);
+
+/**
+ * @brief  获取最近一个控制周期内的编码器计数增量
+ * @return int32_t: 本周期计数 (已按前进为正做符号修正)
+ */
+int32_t speed_control_get_period_counts(void);
+
 
 #endif /* USER_CODE_SPEED_CONTROL_H_ */
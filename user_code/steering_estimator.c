@@ -0,0 +1,203 @@
+/*
+ * steering_estimator.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ */
+#include "steering_estimator.h"
+#include "bsp_flash_param.h"
+#include "zf_libraries_headfile.h"
+#include <math.h>
+
+#define STEER_EST_DEG_TO_RAD    (3.14159265f / 180.0f)
+#define STEER_EST_RAD_TO_DEG    (180.0f / 3.14159265f)
+
+// ================== 内部变量 ==================
+static float    g_theta[2];                 // [k1, k0]
+static float    g_P[2][2];
+static uint32_t g_samples = 0;
+static volatile bool g_valid = false;
+
+static bool     g_heading_prev_valid = false;
+static float    g_heading_prev_deg = 0.0f;
+static uint8_t  g_heading_prev_source = 0;
+
+static steering_estimator_param_t g_saved_param;    // 最近一次写入 (或读出) FLASH 的结果
+static uint32_t g_updates_since_save = 0;
+static bool     g_save_pending = false;
+
+// ================== 内部辅助函数 ==================
+
+static float steering_estimator_gain_of(float k1)
+{
+    return k1 * STEER_EST_WHEELBASE_NOMINAL;
+}
+
+static float steering_estimator_offset_of(float k1, float k0)
+{
+    return -atanf(k0 / k1) * STEER_EST_RAD_TO_DEG;
+}
+
+static bool steering_estimator_check_valid(void)
+{
+    float gain_abs = fabsf(steering_estimator_gain_of(g_theta[0]));
+    return (g_samples >= STEER_EST_MIN_SAMPLES) && (gain_abs >= STEER_EST_GAIN_MIN) && (gain_abs <= STEER_EST_GAIN_MAX);
+}
+
+/**
+ * @brief  2 参数 RLS 更新，y = k1 * phi0 + k0
+ */
+static void steering_estimator_rls(float phi0, float y)
+{
+    const float phi[2] = { phi0, 1.0f };
+
+    float Pphi[2];
+    Pphi[0] = g_P[0][0] * phi[0] + g_P[0][1] * phi[1];
+    Pphi[1] = g_P[1][0] * phi[0] + g_P[1][1] * phi[1];
+
+    const float inv_denom = 1.0f / (STEER_EST_LAMBDA + phi[0] * Pphi[0] + phi[1] * Pphi[1]);
+    const float k[2] = { Pphi[0] * inv_denom, Pphi[1] * inv_denom };
+
+    const float error = y - (phi[0] * g_theta[0] + phi[1] * g_theta[1]);
+    g_theta[0] += k[0] * error;
+    g_theta[1] += k[1] * error;
+
+    const float inv_lambda = 1.0f / STEER_EST_LAMBDA;
+    g_P[0][0] = (g_P[0][0] - k[0] * Pphi[0]) * inv_lambda;
+    g_P[0][1] = (g_P[0][1] - k[0] * Pphi[1]) * inv_lambda;
+    g_P[1][1] = (g_P[1][1] - k[1] * Pphi[1]) * inv_lambda;
+    g_P[1][0] = g_P[0][1];
+
+    // 直线行驶时 tan(delta) 几乎不变，k1 方向缺少激励，遗忘因子会让协方差指数增长
+    const float trace = g_P[0][0] + g_P[1][1];
+    if (trace > STEER_EST_P_TRACE_MAX)
+    {
+        const float scale = STEER_EST_P_TRACE_MAX / trace;
+        g_P[0][0] *= scale;
+        g_P[0][1] *= scale;
+        g_P[1][0] *= scale;
+        g_P[1][1] *= scale;
+    }
+
+    g_samples++;
+}
+
+// ================== API函数实现 ==================
+
+void steering_estimator_init(void)
+{
+    // 标称模型: kappa = tan(delta) / L，无零偏
+    g_theta[0] = 1.0f / STEER_EST_WHEELBASE_NOMINAL;
+    g_theta[1] = 0.0f;
+    g_samples = 0;
+    float p_init = STEER_EST_P_INIT;
+
+    steering_estimator_param_t stored_param;
+    if (bsp_flash_param_load(BSP_FLASH_PARAM_STEERING_EST, &stored_param, sizeof(stored_param))
+        && fabsf(steering_estimator_gain_of(stored_param.k1)) >= STEER_EST_GAIN_MIN
+        && fabsf(steering_estimator_gain_of(stored_param.k1)) <= STEER_EST_GAIN_MAX)
+    {
+        g_theta[0] = stored_param.k1;
+        g_theta[1] = stored_param.k0;
+        g_samples = stored_param.samples;
+        p_init = STEER_EST_P_INIT * 0.1f;   // 已有可信初值，协方差取小一些，避免开局几帧把结果带偏
+        printf("Steering estimate loaded from flash: offset=%.2fdeg gain=%.3f L=%.3fm\n",
+               steering_estimator_offset_of(g_theta[0], g_theta[1]),
+               steering_estimator_gain_of(g_theta[0]), 1.0f / g_theta[0]);
+    }
+    g_saved_param.k1 = g_theta[0];
+    g_saved_param.k0 = g_theta[1];
+    g_saved_param.samples = g_samples;
+
+    g_P[0][0] = p_init;
+    g_P[0][1] = 0.0f;
+    g_P[1][0] = 0.0f;
+    g_P[1][1] = p_init;
+
+    g_heading_prev_valid = false;
+    g_updates_since_save = 0;
+    g_save_pending = false;
+    g_valid = steering_estimator_check_valid();
+}
+
+void steering_estimator_update(float heading_deg, uint8_t heading_source, float speed_mps, float command_deg)
+{
+    bool usable = g_heading_prev_valid && (heading_source == g_heading_prev_source);
+    float delta_heading = heading_deg - g_heading_prev_deg;
+
+    g_heading_prev_valid = true;
+    g_heading_prev_deg = heading_deg;
+    g_heading_prev_source = heading_source;
+
+    if (!usable || speed_mps < STEER_EST_MIN_SPEED_MPS) return;
+
+    if (delta_heading > 180.0f)  delta_heading -= 360.0f;
+    if (delta_heading < -180.0f) delta_heading += 360.0f;
+    float yaw_rate_dps = delta_heading / STEER_EST_FRAME_DT_S;
+    if (fabsf(yaw_rate_dps) > STEER_EST_MAX_YAW_RATE_DPS) return;
+
+    float curvature = yaw_rate_dps * STEER_EST_DEG_TO_RAD / speed_mps;
+    steering_estimator_rls(tanf(command_deg * STEER_EST_DEG_TO_RAD), curvature);
+    g_valid = steering_estimator_check_valid();
+
+    // 结果有明显变化且距上次保存足够久，才请求写 FLASH
+    if (++g_updates_since_save >= STEER_EST_SAVE_INTERVAL && g_valid)
+    {
+        float offset_change = fabsf(steering_estimator_offset_of(g_theta[0], g_theta[1])
+                                    - steering_estimator_offset_of(g_saved_param.k1, g_saved_param.k0));
+        float gain_ratio = fabsf(g_theta[0] / g_saved_param.k1 - 1.0f);
+        if (offset_change > STEER_EST_SAVE_OFFSET_DEG || gain_ratio > STEER_EST_SAVE_GAIN_RATIO)
+        {
+            g_saved_param.k1 = g_theta[0];
+            g_saved_param.k0 = g_theta[1];
+            g_saved_param.samples = g_samples;
+            g_updates_since_save = 0;
+            g_save_pending = true;
+        }
+    }
+}
+
+float steering_estimator_correct(float nominal_deg)
+{
+    if (!g_valid) return nominal_deg;
+
+    // 标称模型下的期望曲率，再按辨识模型反解舵机指令
+    float curvature = tanf(nominal_deg * STEER_EST_DEG_TO_RAD) / STEER_EST_WHEELBASE_NOMINAL;
+    return atanf((curvature - g_theta[1]) / g_theta[0]) * STEER_EST_RAD_TO_DEG;
+}
+
+bool steering_estimator_is_valid(void)
+{
+    return g_valid;
+}
+
+float steering_estimator_get_offset_deg(void)
+{
+    return steering_estimator_offset_of(g_theta[0], g_theta[1]);
+}
+
+float steering_estimator_get_gain(void)
+{
+    return steering_estimator_gain_of(g_theta[0]);
+}
+
+float steering_estimator_get_wheelbase_m(void)
+{
+    return 1.0f / g_theta[0];
+}
+
+void steering_estimator_background_task(void)
+{
+    if (!g_save_pending) return;
+
+    // 导航在定时器中断中更新估计，复制期间屏蔽中断
+    uint32 primask = zf_interrupt_global_disable();
+    steering_estimator_param_t param = g_saved_param;
+    g_save_pending = false;
+    zf_interrupt_global_enable(primask);
+
+    bool ok = bsp_flash_param_save(BSP_FLASH_PARAM_STEERING_EST, &param, sizeof(param));
+    printf("Steering estimate: offset=%.2fdeg gain=%.3f L=%.3fm, flash %s\n",
+           steering_estimator_offset_of(param.k1, param.k0), steering_estimator_gain_of(param.k1),
+           1.0f / param.k1, ok ? "saved" : "save FAILED");
+}
@@ -0,0 +1,98 @@
+/*
+ * steering_estimator.h
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] 行驶中在线估计转向零偏、转向增益与等效轴距。
+ *            实际曲率由 RTK 航向变化率与对地速度得到:  kappa = yaw_rate / v  (1/m，航向顺时针为正)
+ *            自行车模型下曲率与舵机指令角的关系写成线性回归:
+ *                kappa = k1 * tan(delta_cmd) + k0
+ *            用带遗忘因子的 2 参数 RLS 辨识 [k1, k0]，对应的物理量:
+ *                等效轴距    L_eff  = 1 / k1                     (舵机角度标定准确时即为实际轴距)
+ *                相对增益    gain   = k1 * STEER_EST_WHEELBASE_NOMINAL  (1.0 表示标称模型准确，负值表示转向方向装反)
+ *                转向零偏    offset = -atan(k0 / k1)             (度，让车走直线所需的指令角)
+ *            收敛后导航层按辨识结果把期望曲率反算为舵机指令，零偏、增益和方向都被自动修正；
+ *            未收敛时退回标称模型 kappa = tan(delta) / L_nominal，与原先的 Pure Pursuit 完全一致。
+ *            结果由后台任务定期写入 FLASH，下次上电以此为初值。
+ */
+
+#ifndef USER_CODE_STEERING_ESTIMATOR_H_
+#define USER_CODE_STEERING_ESTIMATOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+#define STEER_EST_WHEELBASE_NOMINAL (0.22f)     // [请测量] 标称轴距 (m)，未收敛时使用
+#define STEER_EST_FRAME_DT_S        (0.1f)      // RTK 帧间隔 (s)，导航每收到一帧更新一次
+#define STEER_EST_LAMBDA            (0.995f)    // 遗忘因子，10Hz 下记忆长度约 20 秒
+#define STEER_EST_P_INIT            (10.0f)     // 无 FLASH 记录时的协方差初值
+#define STEER_EST_P_TRACE_MAX       (100.0f)    // 协方差迹上限，直线行驶激励不足时防止协方差爆炸
+#define STEER_EST_MIN_SPEED_MPS     (0.15f)     // 低于此速度航向变化率噪声太大，不更新
+#define STEER_EST_MAX_YAW_RATE_DPS  (120.0f)    // 超过此航向变化率视为航向跳变 (测向失锁/切换)，丢弃
+#define STEER_EST_MIN_SAMPLES       (100)       // 至少更新这么多次 (约 10 秒行驶) 才使用辨识结果
+#define STEER_EST_GAIN_MIN          (0.5f)      // |相对增益| 在此范围外视为辨识异常，不使用
+#define STEER_EST_GAIN_MAX          (2.0f)
+#define STEER_EST_SAVE_INTERVAL     (600)       // 两次写 FLASH 之间至少间隔的更新次数 (约 60 秒)
+#define STEER_EST_SAVE_OFFSET_DEG   (0.2f)      // 零偏或增益变化超过阈值才写 FLASH，减少擦写
+#define STEER_EST_SAVE_GAIN_RATIO   (0.02f)
+
+// 写入 FLASH 的辨识结果
+typedef struct
+{
+    float    k1;
+    float    k0;
+    uint32_t samples;
+} steering_estimator_param_t;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化，FLASH 中有记录时以其为初值
+ */
+void steering_estimator_init(void);
+
+/**
+ * @brief  用一帧 RTK 数据更新估计 (每收到一帧有效定位调用一次)
+ * @param  heading_deg: 航向 (度，真北为 0，顺时针为正)
+ * @param  heading_source: 航向来源编号 (例如 1-双天线 0-地面航向)，来源切换时本帧不参与估计
+ * @param  speed_mps: 对地速度 (m/s)
+ * @param  command_deg: 上一帧到本帧期间施加的舵机指令角 (度)
+ */
+void steering_estimator_update(float heading_deg, uint8_t heading_source, float speed_mps, float command_deg);
+
+/**
+ * @brief  把标称模型下的转向角换算为修正后的舵机指令角
+ * @param  nominal_deg: 按标称轴距、零偏为 0、增益为 1 计算出的舵机角度 (度)
+ * @return float: 修正后的舵机指令角 (度)，估计未收敛时原样返回
+ */
+float steering_estimator_correct(float nominal_deg);
+
+/**
+ * @brief  辨识结果是否可用
+ */
+bool steering_estimator_is_valid(void);
+
+/**
+ * @brief  转向零偏 (度)，即让车走直线所需的舵机指令角
+ */
+float steering_estimator_get_offset_deg(void);
+
+/**
+ * @brief  相对转向增益，1.0 表示与标称模型一致，负值表示转向方向与标称相反
+ */
+float steering_estimator_get_gain(void);
+
+/**
+ * @brief  等效轴距 (m)
+ */
+float steering_estimator_get_wheelbase_m(void);
+
+/**
+ * @brief  后台任务，在主循环中调用，负责把辨识结果写入 FLASH
+ */
+void steering_estimator_background_task(void);
+
+#endif /* USER_CODE_STEERING_ESTIMATOR_H_ */
@@ -0,0 +1,152 @@
+/*
+ * topic.c
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ */
+#include "topic.h"
+#include "scheduler.h"
+#include <string.h>
+
+// ================== 内部类型 ==================
+
+typedef struct
+{
+    volatile uint32_t lock;             // 序号锁，奇数表示写入中
+    volatile uint32_t sequence;         // 本槽数据的发布序号
+    volatile uint32_t timestamp_ms;
+} topic_slot_t;
+
+typedef struct
+{
+    volatile uint32_t sequence;         // 已发布次数
+    volatile uint8_t  active;           // 当前槽 (最近一次完整发布的槽)
+    topic_slot_t      slot[2];
+} topic_state_t;
+
+typedef struct
+{
+    uint16_t size;
+    void    *buffer[2];
+} topic_desc_t;
+
+// ================== 话题存储 (静态分配) ==================
+static topic_wheel_speed_t   g_wheel_speed_buffer[2];
+static topic_speed_command_t g_speed_command_buffer[2];
+static gnss_info_struct      g_gnss_fix_buffer[2];
+static topic_steering_t      g_steering_buffer[2];
+
+static const topic_desc_t g_topic_table[TOPIC_NUM] =
+{
+    [TOPIC_WHEEL_SPEED]   = {sizeof(topic_wheel_speed_t),   {&g_wheel_speed_buffer[0],   &g_wheel_speed_buffer[1]}},
+    [TOPIC_SPEED_COMMAND] = {sizeof(topic_speed_command_t), {&g_speed_command_buffer[0], &g_speed_command_buffer[1]}},
+    [TOPIC_GNSS_FIX]      = {sizeof(gnss_info_struct),      {&g_gnss_fix_buffer[0],      &g_gnss_fix_buffer[1]}},
+    [TOPIC_STEERING]      = {sizeof(topic_steering_t),      {&g_steering_buffer[0],      &g_steering_buffer[1]}},
+};
+
+static topic_state_t g_topic_state[TOPIC_NUM];
+
+// ================== API函数实现 ==================
+
+void topic_init(void)
+{
+    for (uint8_t i = 0; i < TOPIC_NUM; i++)
+    {
+        topic_state_t *state = &g_topic_state[i];
+        state->sequence = 0;
+        state->active = 0;
+        for (uint8_t s = 0; s < 2; s++)
+        {
+            state->slot[s].lock = 0;
+            state->slot[s].sequence = 0;
+            state->slot[s].timestamp_ms = 0;
+        }
+    }
+}
+
+void topic_publish(topic_id_e id, const void *data)
+{
+    if (id >= TOPIC_NUM || NULL == data) return;
+
+    const topic_desc_t *desc = &g_topic_table[id];
+    topic_state_t *state = &g_topic_state[id];
+    const uint8_t next = (uint8_t)(state->active ^ 1U);
+    topic_slot_t *slot = &state->slot[next];
+    const uint32_t sequence = state->sequence + 1;
+
+    slot->lock++;
+    ZF_DMB();
+    memcpy(desc->buffer[next], data, desc->size);
+    slot->sequence = sequence;
+    slot->timestamp_ms = scheduler_get_tick_ms();
+    ZF_DMB();
+    slot->lock++;
+    ZF_DMB();
+
+    // 槽写完后才切换，读者任何时刻看到的当前槽都是完整的
+    state->active = next;
+    state->sequence = sequence;
+}
+
+bool topic_read_begin(topic_id_e id, topic_view_t *view)
+{
+    if (id >= TOPIC_NUM || NULL == view) return false;
+
+    const topic_state_t *state = &g_topic_state[id];
+    for (uint8_t retry = 0; retry < TOPIC_READ_RETRY_MAX; retry++)
+    {
+        if (0 == state->sequence) return false;
+
+        const uint8_t index = state->active;
+        const uint32_t lock = state->slot[index].lock;
+        if (lock & 1U) continue;    // 取到当前槽编号后被写者抢占并已绕回本槽
+        ZF_DMB();
+
+        view->data = g_topic_table[id].buffer[index];
+        view->sequence = state->slot[index].sequence;
+        view->timestamp_ms = state->slot[index].timestamp_ms;
+        view->slot = index;
+        view->slot_lock = lock;
+        return true;
+    }
+    return false;
+}
+
+bool topic_read_end(topic_id_e id, const topic_view_t *view)
+{
+    if (id >= TOPIC_NUM || NULL == view || view->slot > 1) return false;
+
+    ZF_DMB();
+    return g_topic_state[id].slot[view->slot].lock == view->slot_lock;
+}
+
+bool topic_read(topic_id_e id, void *data, uint32_t *sequence, uint32_t *timestamp_ms)
+{
+    if (id >= TOPIC_NUM || NULL == data) return false;
+
+    for (uint8_t retry = 0; retry < TOPIC_READ_RETRY_MAX; retry++)
+    {
+        topic_view_t view;
+        if (!topic_read_begin(id, &view)) return false;
+
+        memcpy(data, view.data, g_topic_table[id].size);
+        if (!topic_read_end(id, &view)) continue;
+
+        if (NULL != sequence) *sequence = view.sequence;
+        if (NULL != timestamp_ms) *timestamp_ms = view.timestamp_ms;
+        return true;
+    }
+    return false;
+}
+
+uint32_t topic_get_sequence(topic_id_e id)
+{
+    if (id >= TOPIC_NUM) return 0;
+    return g_topic_state[id].sequence;
+}
+
+uint16_t topic_get_size(topic_id_e id)
+{
+    if (id >= TOPIC_NUM) return 0;
+    return g_topic_table[id].size;
+}
@@ -0,0 +1,120 @@
+/*
+ * topic.h
+ *
+ *  Created on: 2025年7月28日
+ *      Author: 20766
+ *
+ *  [文件说明] 中断/任务之间共享状态的发布-订阅话题 (黑板)。
+ *            每个话题只有一个写者 (见下方话题列表的 "写者")，读者数量不限，读写均不关中断、不阻塞。
+ *            每个话题有两个固定的数据槽，写者总是写入非当前槽，写完后再切换当前槽，
+ *            每个槽带序号锁 (seqlock): 写入期间序号为奇数，写完加到偶数。
+ *              - 读者优先级高于写者: 当前槽不会被正在进行的写入触碰，读到的总是完整快照；
+ *              - 读者被写者抢占: 只有写者连续发布两次才会写回读者所在的槽，序号变化即可检测并重读。
+ *            读取方式:
+ *              - topic_read             : 拷贝到调用者的结构体，内部自动校验重试；
+ *              - topic_read_begin / end : 零拷贝，直接访问槽内数据，用完后以 end 的返回值确认期间未被覆盖。
+ *            每次发布记录发布序号 (从 1 开始递增) 与调度器节拍时间戳，读者据此判断数据是否更新、是否过期。
+ */
+
+#ifndef USER_CODE_TOPIC_H_
+#define USER_CODE_TOPIC_H_
+
+#include "zf_libraries_headfile.h"
+#include "bsp_rtk.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+#define TOPIC_READ_RETRY_MAX    (4)     // 拷贝读取的最大重试次数 (只有写者在一次读取内连续发布两次才需要重试)
+
+// ---- 话题数据类型 ----
+typedef struct
+{
+    float current_cmps;                 // 编码器测得的车轮速度
+    float planned_cmps;                 // 轨迹规划速度 (PID 设定值)
+    float planned_accel_cmps2;          // 轨迹规划加速度
+    float motor_output;                 // 速度环输出 (百分比)
+} topic_wheel_speed_t;
+
+typedef struct
+{
+    float target_cmps;                  // 目标速度，速度环按轨迹规划平滑逼近
+} topic_speed_command_t;
+
+typedef struct
+{
+    float target_deg;                   // 导航期望的车轮转角 (已按估计的零偏/增益修正并限幅)
+    float servo_command_deg;            // 超前补偿后实际下发给舵机的角度
+} topic_steering_t;
+
+// ---- 话题列表 ----
+typedef enum
+{
+    TOPIC_WHEEL_SPEED,      // topic_wheel_speed_t   写者: speed_control_task      (CONTROL,    100Hz)
+    TOPIC_SPEED_COMMAND,    // topic_speed_command_t 写者: speed_control_set_speed (导航任务 / 初始化)
+    TOPIC_GNSS_FIX,         // gnss_info_struct      写者: bsp_rtk_data_task       (BACKGROUND, 10Hz)
+    TOPIC_STEERING,         // topic_steering_t      写者: navigation_run_once     (BACKGROUND, 10Hz)
+    TOPIC_NUM,
+} topic_id_e;
+
+// 零拷贝读取句柄，由 topic_read_begin 填写
+typedef struct
+{
+    const void *data;                   // 指向话题槽内数据，只读
+    uint32_t    sequence;               // 发布序号
+    uint32_t    timestamp_ms;           // 发布时的调度器节拍
+    uint8_t     slot;                   // 以下为内部校验用
+    uint32_t    slot_lock;
+} topic_view_t;
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  清空所有话题 (尚未发布状态)
+ * @note   在任何模块发布之前调用一次 (main 最开始)。
+ */
+void topic_init(void);
+
+/**
+ * @brief  发布一份新数据
+ * @param  id: 话题编号
+ * @param  data: 与话题数据类型一致的结构体指针，按话题大小整体拷贝
+ * @note   每个话题只允许一个执行上下文发布，多个写者需自行互斥。
+ */
+void topic_publish(topic_id_e id, const void *data);
+
+/**
+ * @brief  拷贝读取最新一份数据
+ * @param  id: 话题编号
+ * @param  data: 输出缓冲区，大小不小于话题数据类型
+ * @param  sequence: 输出发布序号，可为 NULL
+ * @param  timestamp_ms: 输出发布时间戳，可为 NULL
+ * @return bool: 尚未发布或重试耗尽时返回 false，此时 data 内容无效
+ */
+bool topic_read(topic_id_e id, void *data, uint32_t *sequence, uint32_t *timestamp_ms);
+
+/**
+ * @brief  零拷贝读取开始: 取得当前槽的只读指针
+ * @return bool: 尚未发布时返回 false
+ */
+bool topic_read_begin(topic_id_e id, topic_view_t *view);
+
+/**
+ * @brief  零拷贝读取结束: 确认 begin 之后槽内数据未被改写
+ * @return bool: false 表示期间数据已被覆盖，基于 view->data 的结果应丢弃并重读
+ */
+bool topic_read_end(topic_id_e id, const topic_view_t *view);
+
+/**
+ * @brief  获取话题的发布序号 (已发布次数)，0 表示尚未发布
+ * @note   读者保存上次处理的序号，与之比较即可判断是否有新数据。
+ */
+uint32_t topic_get_sequence(topic_id_e id);
+
+/**
+ * @brief  获取话题数据大小 (字节)
+ */
+uint16_t topic_get_size(topic_id_e id);
+
+#endif /* USER_CODE_TOPIC_H_ */
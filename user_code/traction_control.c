@@ -0,0 +1,141 @@
+/*
+ * traction_control.c
+ *
+ *  Created on: 2025年7月26日
+ *      Author: 20766
+ */
+#include "traction_control.h"
+#include "zf_libraries_headfile.h"
+#include <math.h>
+
+// ================== 内部变量 ==================
+static float    g_wheel_history[TRACTION_HISTORY_SIZE];  // |车轮速度| 环形缓冲
+static uint8_t  g_history_head = 0;                      // 下一个写入位置
+static uint8_t  g_history_count = 0;
+
+static volatile float g_ground_speed_cmps = 0.0f;
+static volatile float g_slip_filtered = 0.0f;
+static volatile bool  g_slipping = false;
+static volatile uint16_t g_ticks_since_ground = TRACTION_GROUND_TIMEOUT_TICKS;
+static float g_output_ceiling = TRACTION_OUTPUT_MAX;
+
+// ================== 内部辅助函数 ==================
+
+/**
+ * @brief  计算与当前 GNSS 速度对应时刻的车轮速度均值 (已扣除 GNSS 延迟)
+ * @return float: 平均 |车轮速度|，历史不足时返回 -1
+ */
+static float traction_control_delayed_wheel_speed(void)
+{
+    if (g_history_count < TRACTION_GNSS_DELAY_TICKS + TRACTION_WINDOW_TICKS) return -1.0f;
+
+    float sum = 0.0f;
+    uint8_t index = (uint8_t)((g_history_head + TRACTION_HISTORY_SIZE - TRACTION_GNSS_DELAY_TICKS - TRACTION_WINDOW_TICKS)
+                              % TRACTION_HISTORY_SIZE);
+    for (uint8_t i = 0; i < TRACTION_WINDOW_TICKS; i++)
+    {
+        sum += g_wheel_history[index];
+        index = (uint8_t)((index + 1) % TRACTION_HISTORY_SIZE);
+    }
+    return sum / (float)TRACTION_WINDOW_TICKS;
+}
+
+// ================== API函数实现 ==================
+
+void traction_control_init(void)
+{
+    for (uint8_t i = 0; i < TRACTION_HISTORY_SIZE; i++)
+    {
+        g_wheel_history[i] = 0.0f;
+    }
+    g_history_head = 0;
+    g_history_count = 0;
+    g_ground_speed_cmps = 0.0f;
+    g_slip_filtered = 0.0f;
+    g_slipping = false;
+    g_ticks_since_ground = TRACTION_GROUND_TIMEOUT_TICKS;
+    g_output_ceiling = TRACTION_OUTPUT_MAX;
+}
+
+float traction_control_step(float wheel_speed_cmps, float motor_output)
+{
+    // 1. 记录车轮速度
+    g_wheel_history[g_history_head] = fabsf(wheel_speed_cmps);
+    g_history_head = (uint8_t)((g_history_head + 1) % TRACTION_HISTORY_SIZE);
+    if (g_history_count < TRACTION_HISTORY_SIZE) g_history_count++;
+
+    // 2. GNSS 速度超时，估计不可信，视为未打滑
+    if (g_ticks_since_ground < TRACTION_GROUND_TIMEOUT_TICKS)
+    {
+        g_ticks_since_ground++;
+    }
+    else
+    {
+        g_slipping = false;
+        g_slip_filtered = 0.0f;
+    }
+
+    // 3. 打滑时从当前实际输出开始收紧上限，恢复后缓慢放开
+    if (g_slipping)
+    {
+        g_output_ceiling = fminf(g_output_ceiling, fabsf(motor_output)) - TRACTION_CUT_RATE;
+        if (g_output_ceiling < TRACTION_OUTPUT_MIN) g_output_ceiling = TRACTION_OUTPUT_MIN;
+    }
+    else if (g_output_ceiling < TRACTION_OUTPUT_MAX)
+    {
+        g_output_ceiling += TRACTION_RECOVER_RATE;
+        if (g_output_ceiling > TRACTION_OUTPUT_MAX) g_output_ceiling = TRACTION_OUTPUT_MAX;
+    }
+
+    return g_output_ceiling;
+}
+
+void traction_control_update_ground(float ground_speed_cmps)
+{
+    if (ground_speed_cmps < 0.0f) ground_speed_cmps = 0.0f;
+
+    // 与速度环中断可能互相抢占，读取历史期间屏蔽中断 (仅 TRACTION_WINDOW_TICKS 次加法)
+    uint32 primask = zf_interrupt_global_disable();
+    float wheel = traction_control_delayed_wheel_speed();
+    g_ground_speed_cmps = ground_speed_cmps;
+    g_ticks_since_ground = 0;
+    zf_interrupt_global_enable(primask);
+
+    float slip = 0.0f;
+    if (wheel >= TRACTION_MIN_SPEED_CMPS)
+    {
+        slip = (wheel - ground_speed_cmps) / wheel;
+        if (slip < -1.0f) slip = -1.0f;
+        if (slip > 1.0f)  slip = 1.0f;
+    }
+    g_slip_filtered += TRACTION_SLIP_FILTER_ALPHA * (slip - g_slip_filtered);
+
+    if (!g_slipping && g_slip_filtered > TRACTION_SLIP_ENTER)
+    {
+        g_slipping = true;
+    }
+    else if (g_slipping && g_slip_filtered < TRACTION_SLIP_EXIT)
+    {
+        g_slipping = false;
+    }
+}
+
+float traction_control_get_slip(void)
+{
+    return g_slip_filtered;
+}
+
+float traction_control_get_ground_speed(void)
+{
+    return g_ground_speed_cmps;
+}
+
+bool traction_control_is_slipping(void)
+{
+    return g_slipping;
+}
+
+float traction_control_get_accel_scale(void)
+{
+    return g_slipping ? TRACTION_ACCEL_SCALE_SLIP : 1.0f;
+}
@@ -0,0 +1,82 @@
+/*
+ * traction_control.h
+ *
+ *  Created on: 2025年7月26日
+ *      Author: 20766
+ *
+ *  [文件说明] 车轮打滑估计与牵引力限制。
+ *            编码器测的是车轮转速，GNSS 多普勒速度 (gnss_info.speed) 测的是对地速度，
+ *            两者之差即为打滑:  slip = (|v_wheel| - v_ground) / |v_wheel|
+ *            GNSS 速度有输出延迟，因此车轮速度先存入环形缓冲，取 TRACTION_GNSS_DELAY_TICKS 之前、
+ *            长度为 TRACTION_WINDOW_TICKS 的平均值与之比较，避免加速过程被误判为打滑。
+ *            检测到打滑后逐周期收紧电机输出上限并降低轨迹规划加速度，恢复抓地后再缓慢放开。
+ *            位置差分速度与多普勒速度来源相同但噪声更大，这里不使用。
+ */
+
+#ifndef USER_CODE_TRACTION_CONTROL_H_
+#define USER_CODE_TRACTION_CONTROL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ================== 配置与宏定义 ==================
+
+// ---- 打滑估计 ----
+#define TRACTION_HISTORY_SIZE         (32)      // 车轮速度历史 (控制周期数)，需大于 DELAY + WINDOW
+#define TRACTION_GNSS_DELAY_TICKS     (15)      // [请标定] GNSS 速度相对编码器的延迟 (控制周期数，10ms/个)
+#define TRACTION_WINDOW_TICKS         (10)      // 与一次 GNSS 速度比较的车轮速度平均窗口 (对应 10Hz 更新)
+#define TRACTION_MIN_SPEED_CMPS       (10.0f)   // 车轮速度低于此值时不计算打滑 (分母过小)
+#define TRACTION_SLIP_FILTER_ALPHA    (0.5f)    // 打滑率一阶低通 (按 GNSS 更新频率)
+#define TRACTION_SLIP_ENTER           (0.25f)   // 打滑率超过此值判定为打滑
+#define TRACTION_SLIP_EXIT            (0.12f)   // 打滑率低于此值判定为恢复抓地
+#define TRACTION_GROUND_TIMEOUT_TICKS (50)      // 超过这么多控制周期没有 GNSS 速度则估计失效，限制逐步解除
+
+// ---- 牵引力限制 ----
+#define TRACTION_OUTPUT_MAX           (100.0f)  // 输出上限的最大值 (与速度环输出同量纲，百分比)
+#define TRACTION_OUTPUT_MIN           (15.0f)   // 打滑时输出上限最低降到此值，保证仍能脱困
+#define TRACTION_CUT_RATE             (2.0f)    // 打滑时每个控制周期收紧的输出上限 (百分比)
+#define TRACTION_RECOVER_RATE         (0.5f)    // 恢复抓地后每个控制周期放开的输出上限 (百分比)
+#define TRACTION_ACCEL_SCALE_SLIP     (0.3f)    // 打滑时轨迹规划最大加速度的缩放系数
+
+// ================== API函数声明 ==================
+
+/**
+ * @brief  初始化打滑估计与牵引力限制
+ */
+void traction_control_init(void);
+
+/**
+ * @brief  控制周期更新 (在速度环中断中调用)
+ * @param  wheel_speed_cmps: 编码器测得的车轮速度 (cm/s)，带符号
+ * @param  motor_output: 上一周期的电机输出 (百分比)，带符号
+ * @return float: 本周期允许的电机输出上限 (百分比，正值，对称使用)
+ */
+float traction_control_step(float wheel_speed_cmps, float motor_output);
+
+/**
+ * @brief  GNSS 对地速度更新 (每收到一帧有效定位调用一次)
+ * @param  ground_speed_cmps: 对地速度 (cm/s)，非负
+ */
+void traction_control_update_ground(float ground_speed_cmps);
+
+/**
+ * @brief  获取滤波后的打滑率，0 为无打滑，1 为车轮空转
+ */
+float traction_control_get_slip(void);
+
+/**
+ * @brief  获取最近一次 GNSS 对地速度 (cm/s)
+ */
+float traction_control_get_ground_speed(void);
+
+/**
+ * @brief  当前是否处于打滑状态
+ */
+bool traction_control_is_slipping(void);
+
+/**
+ * @brief  获取轨迹规划加速度缩放系数 (0 - 1)
+ */
+float traction_control_get_accel_scale(void);
+
+#endif /* USER_CODE_TRACTION_CONTROL_H_ */